@@ -0,0 +1,70 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "CommunicationModelAPI.h"
+
+/**
+ * @brief 干扰频段与信道频段重叠查询耗时
+ *
+ * 5000个干扰频段分布在30-3000MHz，带宽0.1-5MHz；信道为同一范围内25kHz间隔的栅格。
+ * 分别统计逐对比较与扫描线索引求出全部重叠配对的耗时。
+ */
+
+namespace {
+
+double measureSeconds(const std::function<void()>& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main() {
+    const int jammerCount = 5000;
+    const double channelSpacing = 0.025;
+    const int channelCount = static_cast<int>((3000.0 - 30.0) / channelSpacing);
+
+    std::vector<CommunicationFrequencyBand> jammers(jammerCount);
+    for (int j = 0; j < jammerCount; ++j) {
+        jammers[j].frequency = 1515.0 + 1480.0 * std::sin(1.3 * j);
+        jammers[j].bandwidth = 0.1 + 4.9 * (0.5 + 0.5 * std::cos(0.7 * j));
+    }
+    std::vector<CommunicationFrequencyBand> channels(channelCount);
+    for (int c = 0; c < channelCount; ++c) {
+        channels[c].frequency = 30.0 + channelSpacing * (c + 0.5);
+        channels[c].bandwidth = channelSpacing;
+    }
+
+    size_t pairwiseCount = 0;
+    double pairwiseSeconds = measureSeconds([&]() {
+        for (const CommunicationFrequencyBand& jammer : jammers) {
+            for (const CommunicationFrequencyBand& channel : channels) {
+                const double low = std::max(jammer.frequency - jammer.bandwidth / 2.0,
+                                            channel.frequency - channel.bandwidth / 2.0);
+                const double high = std::min(jammer.frequency + jammer.bandwidth / 2.0,
+                                             channel.frequency + channel.bandwidth / 2.0);
+                pairwiseCount += high > low ? 1 : 0;
+            }
+        }
+    });
+
+    CommunicationModelAPI api;
+    std::vector<CommunicationBandOverlap> overlaps;
+    double indexSeconds = measureSeconds([&]() {
+        api.calculateBandOverlaps(jammers, channels, overlaps);
+    });
+
+    std::cout << "频段重叠查询耗时 (" << jammerCount << "个干扰频段, " << channelCount << "个信道)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  逐对比较:             " << std::setw(8) << pairwiseSeconds * 1e3 << " ms, 重叠配对 "
+              << pairwiseCount << std::endl;
+    std::cout << "  扫描线索引:           " << std::setw(8) << indexSeconds * 1e3 << " ms, 重叠配对 "
+              << overlaps.size() << std::endl;
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include "CommunicationModelAPI.h"
+
+/**
+ * @brief 跳频碰撞仿真耗时
+ *
+ * 256个信道、跳频速率10kHz的跳频网与一部扫频干扰和一部脉冲干扰对抗，
+ * 统计单线程与多线程下每秒处理的跳数。
+ */
+
+namespace {
+
+double measureSeconds(const std::function<void()>& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main() {
+    CommunicationModelAPI api(CommunicationScenario::ANTI_JAM_COMMUNICATION);
+    const double frequency = api.getEnvironment().frequency;
+    CommunicationAntiJamModel* antiJam = api.getAntiJamModel();
+    antiJam->setHoppingChannels(256);
+    antiJam->setChannelSpacing(0.5);
+    antiJam->setHoppingRate(10000.0);
+    antiJam->setDwellTime(0.08);
+
+    CommunicationTimingJammer sweep;
+    sweep.type = JammerType::SWEEP_FREQUENCY;
+    sweep.frequency = frequency;
+    sweep.bandwidth = 5.0;
+    sweep.pulseWidth = 0.01;
+    sweep.pulseRepetitionRate = 1000.0;
+    sweep.sweepRate = 1000.0;
+    sweep.sweepRange = 128.0;
+    sweep.startOffset = 0.0;
+    CommunicationTimingJammer pulse = sweep;
+    pulse.type = JammerType::PULSE;
+    pulse.frequency = frequency + 20.0;
+    pulse.bandwidth = 30.0;
+    pulse.pulseWidth = 0.2;
+
+    CommunicationHoppingConfig config;
+    config.hopCount = 1000000;
+    config.netCount = 64;
+    config.hopsPerPacket = 8;
+    config.toleratedHits = 2;
+    config.jammers = {sweep, pulse};
+
+    std::cout << "跳频碰撞仿真耗时 (" << config.netCount << "个网 × " << config.hopCount << "跳)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (int threads : {1, 0}) {
+        api.setThreadCount(threads);
+        CommunicationHoppingResult result;
+        double seconds = measureSeconds([&]() {
+            api.simulateFrequencyHopping(config, result);
+        });
+        std::cout << "  线程数 " << std::setw(2) << api.getThreadCount() << ": " << std::setw(9) << seconds * 1e3
+                  << " ms, " << std::setw(8) << result.hopCount / seconds / 1e6 << " M跳/s, 命中率 "
+                  << result.getHitRate() * 100.0 << " %, 丢包率 " << result.getPacketLossRate() * 100.0 << " %"
+                  << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <cmath>
+#include "CommunicationModelAPI.h"
+#include "CommunicationJammerAggregator.h"
+
+/**
+ * @brief 多干扰机干扰功率聚合耗时
+ *
+ * 1000个干扰源随机分布在40km × 40km区域内，频率分布在2300-2500MHz，
+ * 分别统计单个接收点的聚合耗时与经API批量计算10000个接收点的耗时。
+ */
+
+namespace {
+
+double measureSeconds(const std::function<void()>& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main() {
+    const int jammerCount = 1000;
+    const int receiverCount = 10000;
+    const int repeatCount = 10000;
+
+    std::vector<CommunicationJammerEmitter> jammers(jammerCount);
+    for (int j = 0; j < jammerCount; ++j) {
+        jammers[j].x = 20.0 * std::sin(1.7 * j);
+        jammers[j].y = 20.0 * std::cos(2.3 * j);
+        jammers[j].frequency = 2400.0 + 100.0 * std::sin(0.9 * j);
+        jammers[j].bandwidth = 1.0 + (j % 10);
+        jammers[j].power = 20.0 + (j % 20);
+    }
+    std::vector<std::pair<double, double>> receivers(receiverCount);
+    for (int i = 0; i < receiverCount; ++i) {
+        receivers[i] = {0.004 * i - 20.0, 10.0 * std::sin(0.01 * i)};
+    }
+
+    CommunicationJammerAggregator aggregator(jammers.data(), jammers.size(), 1);
+    double checksum = 0.0;
+    double singleSeconds = measureSeconds([&]() {
+        for (int r = 0; r < repeatCount; ++r) {
+            const auto& receiver = receivers[static_cast<size_t>(r) % receivers.size()];
+            checksum += aggregator.calculateInterferencePower(receiver.first, receiver.second, 2390.0, 2410.0);
+        }
+    });
+
+    CommunicationModelAPI api;
+    api.setFrequency(2400.0);
+    api.setBandwidth(20.0);
+    std::vector<CommunicationAggregateInterference> results;
+    double batchSeconds = measureSeconds([&]() {
+        api.calculateAggregateInterference(jammers, receivers, results);
+    });
+    checksum += results[receiverCount / 2].signalToInterferenceNoiseRatio;
+
+    std::cout << "多干扰机干扰功率聚合耗时 (" << jammerCount << "个干扰源)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  单个接收点:           " << std::setw(8) << singleSeconds / repeatCount * 1e6 << " us" << std::endl;
+    std::cout << "  每(接收点, 干扰源):   " << std::setw(8)
+              << singleSeconds / repeatCount / jammerCount * 1e9 << " ns" << std::endl;
+    std::cout << "  API批量(" << receiverCount << "个接收点): " << std::setw(8) << batchSeconds * 1e3 << " ms"
+              << std::endl;
+    std::cout << "  校验和: " << checksum << std::endl;
+    return 0;
+}
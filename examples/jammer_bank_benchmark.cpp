@@ -0,0 +1,79 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <cmath>
+#include "CommunicationJammerModel.h"
+#include "CommunicationJammerBank.h"
+
+/**
+ * @brief 多干扰机协同效果计算耗时
+ *
+ * 1200台覆盖全部干扰类型的干扰机，对比逐个调用干扰模型的计算方法
+ * 与按干扰类型分组的干扰机组批量计算的耗时。
+ */
+
+namespace {
+
+double measureSeconds(const std::function<void()>& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main() {
+    const int jammerCount = 1200;
+    const int repeatCount = 200;
+    const JammerType types[] = {JammerType::GAUSSIAN_NOISE, JammerType::NARROWBAND,
+                                JammerType::SWEEP_FREQUENCY, JammerType::PULSE,
+                                JammerType::BARRAGE, JammerType::SPOT};
+
+    std::vector<CommunicationJammerModel> jammers;
+    for (int i = 0; i < jammerCount; ++i) {
+        CommunicationJammerModel jammer(types[i % 6]);
+        jammer.setJammerPower(-10.0 + (i * 7) % 55);
+        jammer.setJammerFrequency(10000.0 + ((i * 13) % 21 - 10) * 15.0);
+        jammer.setTargetDistance(0.5 + (i * 17) % 80);
+        jammers.push_back(jammer);
+    }
+    const CommunicationJammerModel& reference = jammers.front();
+
+    double checksum = 0.0;
+    double scalarSeconds = measureSeconds([&]() {
+        for (int r = 0; r < repeatCount; ++r) {
+            double total = 0.0;
+            for (const CommunicationJammerModel& jammer : jammers) {
+                const double power = jammer.getJammerPower() -
+                    CommunicationDistanceModel::calculateFreeSpacePathLoss(jammer.getTargetDistance(),
+                                                                           jammer.getJammerFrequency() / 1000.0);
+                total += std::pow(10.0, power / 10.0) * jammer.calculateJammerEffectiveness();
+            }
+            checksum += total;
+        }
+    });
+
+    CommunicationJammerBank bank(jammers);
+    double bankSeconds = measureSeconds([&]() {
+        for (int r = 0; r < repeatCount; ++r) {
+            checksum += bank.calculateWeightedJammerPower();
+        }
+    });
+
+    double wrapperSeconds = measureSeconds([&]() {
+        for (int r = 0; r < repeatCount; ++r) {
+            checksum += reference.calculateCombinedJammerEffect(jammers);
+        }
+    });
+
+    std::cout << "多干扰机协同效果计算耗时 (" << jammerCount << "台干扰机)" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  逐个调用干扰模型:       " << std::setw(8) << scalarSeconds / repeatCount * 1e6 << " us" << std::endl;
+    std::cout << "  干扰机组批量计算:       " << std::setw(8) << bankSeconds / repeatCount * 1e6 << " us" << std::endl;
+    std::cout << "  协同效果(含构建机组):   " << std::setw(8) << wrapperSeconds / repeatCount * 1e6 << " us" << std::endl;
+    std::cout << "  校验和: " << std::setprecision(6) << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include "CommunicationModelAPI.h"
+#include "CommunicationLinkEvaluator.h"
+#include "MathConstants.h"
+
+/**
+ * @brief 链路评估性能对比
+ *
+ * 对比三种链路状态计算方式的单次耗时：
+ * 1. 逐指标重复计算（原calculateLinkStatus的调用链，每个派生指标重新计算信噪比）
+ * 2. 单次推导（信号强度、信噪比、误码率、丢包率各计算一次）
+ * 3. 批量接口calculateLinkStatusBatch（含状态描述）
+ * 4. 数值指标批量接口calculateLinkMetricsBatch（不生成字符串、不分配内存）
+ */
+
+namespace {
+
+// 原实现的逐指标调用链：每个指标均从路径损耗开始重新计算
+struct LegacyLinkChain {
+    const CommunicationModelAPI& api;
+    CommunicationEnvironment env;
+
+    double signalStrength() const {
+        return env.transmitPower - api.getDistanceModel()->calculateTotalPathLoss(env.distance, env.frequency);
+    }
+
+    double snr() const {
+        double value = signalStrength() - env.noisePower;
+        JammingEnvironment jammingEnv = api.getJammingEnvironment();
+        if (jammingEnv.isJammed) {
+            value -= api.getJammerModel()->calculateJammerToSignalRatio();
+        }
+        if (api.getScenario() == CommunicationScenario::ANTI_JAM_COMMUNICATION) {
+            value += api.getAntiJamModel()->calculateAntiJamGain();
+        }
+        return value;
+    }
+
+    double ber() const {
+        double linearSnr = std::pow(10.0, snr() / 10.0);
+        double value = MathConstants::BER_COEFFICIENT * std::erfc(std::sqrt(linearSnr));
+        return std::max(MathConstants::MIN_BER, std::min(MathConstants::MAX_BER, value));
+    }
+
+    double throughput() const {
+        double capacity = env.bandwidth * std::log2(1.0 + std::pow(10.0, snr() / 10.0));
+        double efficiency = MathConstants::EFFICIENCY_BASE - MathConstants::BER_EFFICIENCY_FACTOR * ber();
+        efficiency = std::max(MathConstants::MIN_EFFICIENCY, std::min(MathConstants::MAX_EFFICIENCY, efficiency));
+        return capacity * efficiency;
+    }
+
+    double latency() const {
+        return env.distance / MathConstants::SPEED_OF_LIGHT + MathConstants::DEFAULT_PROCESSING_DELAY +
+               ber() * MathConstants::RETRANSMISSION_DELAY_FACTOR;
+    }
+
+    double packetLoss() const {
+        double value = 1.0 - std::pow(1.0 - ber(), MathConstants::PACKET_LENGTH_BITS);
+        return std::max(0.0, std::min(1.0, value));
+    }
+
+    CommunicationLinkStatus evaluate() const {
+        CommunicationLinkStatus status;
+        status.signalStrength = signalStrength();
+        status.signalToNoiseRatio = snr();
+        status.bitErrorRate = ber();
+        status.throughput = throughput();
+        status.latency = latency();
+        status.packetLossRate = packetLoss();
+        status.quality = CommunicationLinkEvaluator::assessQuality(snr(), ber(), packetLoss());
+        status.isConnected = status.signalToNoiseRatio > MathConstants::LOW_SNR_THRESHOLD &&
+                             status.bitErrorRate < MathConstants::CONNECTION_BER_THRESHOLD &&
+                             status.packetLossRate < MathConstants::CONNECTION_PACKET_LOSS_THRESHOLD;
+        return status;
+    }
+};
+
+template <typename Func>
+double measureNanosecondsPerCall(size_t calls, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(calls);
+}
+
+} // namespace
+
+int main() {
+    const size_t sampleCount = 200000;
+
+    CommunicationModelAPI api(CommunicationScenario::JAMMED_COMMUNICATION);
+    CommunicationEnvironment baseEnv = api.getEnvironment();
+    baseEnv.frequency = 2400.0;
+    baseEnv.distance = 5.0;
+    api.setEnvironment(baseEnv);
+
+    // 仅距离变化的样本，保证三种方式的计算口径完全一致
+    std::vector<CommunicationEnvironment> environments(sampleCount, baseEnv);
+    for (size_t i = 0; i < sampleCount; ++i) {
+        environments[i].distance = 0.1 + 50.0 * static_cast<double>(i) / sampleCount;
+    }
+
+    CommunicationLinkEvaluator evaluator(api.getScenario(), api.getEnvironment(), api.getJammingEnvironment(),
+                                         *api.getJammerModel(), *api.getAntiJamModel());
+
+    double checksumLegacy = 0.0;
+    double legacyNs = measureNanosecondsPerCall(sampleCount, [&]() {
+        for (const auto& env : environments) {
+            LegacyLinkChain chain{api, env};
+            checksumLegacy += chain.evaluate().throughput;
+        }
+    });
+
+    double checksumSinglePass = 0.0;
+    double singlePassNs = measureNanosecondsPerCall(sampleCount, [&]() {
+        for (const auto& env : environments) {
+            double signal = env.transmitPower -
+                            evaluator.calculateTotalPathLoss(env.distance, env.frequency, env.environmentType);
+            double snr = signal - env.noisePower - api.calculateJammerToSignalRatio();
+            checksumSinglePass += CommunicationLinkEvaluator::deriveLinkStatus(
+                signal, snr, env.bandwidth, env.distance).throughput;
+        }
+    });
+
+    std::vector<CommunicationLinkStatus> results(sampleCount);
+    double batchNs = measureNanosecondsPerCall(sampleCount, [&]() {
+        api.calculateLinkStatusBatch(environments.data(), environments.size(), results.data());
+    });
+    double checksumBatch = 0.0;
+    for (const auto& status : results) {
+        checksumBatch += status.throughput;
+    }
+
+    std::vector<CommunicationLinkMetrics> metrics(sampleCount);
+    double metricsNs = measureNanosecondsPerCall(sampleCount, [&]() {
+        api.calculateLinkMetricsBatch(environments.data(), environments.size(), metrics.data());
+    });
+
+    std::cout << "链路评估性能对比 (" << sampleCount << " 个样本)" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  逐指标重复计算:   " << std::setw(8) << legacyNs << " ns/次" << std::endl;
+    std::cout << "  单次推导:         " << std::setw(8) << singlePassNs << " ns/次  (加速 "
+              << std::setprecision(2) << legacyNs / singlePassNs << "x)" << std::endl;
+    std::cout << std::setprecision(1);
+    std::cout << "  批量接口(含描述): " << std::setw(8) << batchNs << " ns/次" << std::endl;
+    std::cout << "  批量数值指标:     " << std::setw(8) << metricsNs << " ns/次" << std::endl;
+
+    double relativeError = std::abs(checksumLegacy - checksumSinglePass) / std::max(1.0, std::abs(checksumLegacy));
+    double batchError = std::abs(checksumLegacy - checksumBatch) / std::max(1.0, std::abs(checksumLegacy));
+    std::cout << std::scientific << std::setprecision(2);
+    std::cout << "  结果相对误差: 单次推导 " << relativeError << ", 批量接口 " << batchError << std::endl;
+
+    return (relativeError < 1e-9 && batchError < 1e-9) ? 0 : 1;
+}
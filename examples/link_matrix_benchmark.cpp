@@ -0,0 +1,95 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include "CommunicationModelAPI.h"
+#include "CommunicationLinkEvaluator.h"
+
+/**
+ * @brief 链路矩阵性能对比
+ *
+ * 对比两种N×N链路信噪比矩阵的计算方式（默认N=10000，可通过命令行参数指定）：
+ * 1. 逐对计算：对每个有序节点对开方求距离并调用calculateTotalPathLoss
+ * 2. 分块内核：calculateLinkMatrix（上三角分块、向量化log10、多线程、行主序连续缓冲区）
+ */
+
+namespace {
+
+double measureSeconds(const std::function<void()>& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t nodeCount = 10000;
+    if (argc > 1) {
+        nodeCount = static_cast<size_t>(std::max(2L, std::atol(argv[1])));
+    }
+
+    CommunicationModelAPI api(CommunicationScenario::JAMMED_COMMUNICATION);
+    CommunicationEnvironment env = api.getEnvironment();
+    env.frequency = 2400.0;
+    env.environmentType = EnvironmentType::URBAN_AREA;
+    api.setEnvironment(env);
+
+    std::mt19937 generator(2024);
+    std::uniform_real_distribution<double> coordinate(0.0, 100.0);
+    std::vector<std::pair<double, double>> nodes(nodeCount);
+    for (auto& node : nodes) {
+        node.first = coordinate(generator);
+        node.second = coordinate(generator);
+    }
+
+    CommunicationLinkEvaluator evaluator(api.getScenario(), api.getEnvironment(), api.getJammingEnvironment(),
+                                         *api.getJammerModel(), *api.getAntiJamModel());
+    const double snrOffset = env.transmitPower - env.noisePower - api.calculateJammerToSignalRatio();
+
+    std::vector<float> naive(nodeCount * nodeCount);
+    double naiveSeconds = measureSeconds([&]() {
+        for (size_t i = 0; i < nodeCount; ++i) {
+            for (size_t j = 0; j < nodeCount; ++j) {
+                if (i == j) {
+                    naive[i * nodeCount + j] = 0.0f;
+                    continue;
+                }
+                double distance = std::hypot(nodes[i].first - nodes[j].first, nodes[i].second - nodes[j].second);
+                double loss = evaluator.calculateTotalPathLoss(distance, env.frequency, env.environmentType);
+                naive[i * nodeCount + j] = static_cast<float>(snrOffset - loss);
+            }
+        }
+    });
+
+    CommunicationLinkMatrix matrix;
+    double kernelSeconds = measureSeconds([&]() {
+        api.calculateLinkMatrix(nodes, matrix);
+    });
+
+    double maxError = 0.0;
+    for (size_t k = 0; k < naive.size(); ++k) {
+        maxError = std::max(maxError, static_cast<double>(std::abs(naive[k] - matrix.values[k])));
+    }
+
+    double pairs = static_cast<double>(nodeCount) * static_cast<double>(nodeCount);
+    std::cout << "链路矩阵性能对比 (N = " << nodeCount << ", 线程数 " << api.getThreadCount() << ")" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  逐对计算: " << std::setw(8) << naiveSeconds << " s  ("
+              << std::setprecision(2) << naiveSeconds * 1e9 / pairs << " ns/对)" << std::endl;
+    std::cout << std::setprecision(3);
+    std::cout << "  分块内核: " << std::setw(8) << kernelSeconds << " s  ("
+              << std::setprecision(2) << kernelSeconds * 1e9 / pairs << " ns/对, 加速 "
+              << naiveSeconds / kernelSeconds << "x)" << std::endl;
+    std::cout << "  矩阵内存: " << matrix.values.size() * sizeof(float) / (1024.0 * 1024.0) << " MB" << std::endl;
+    std::cout << std::scientific << std::setprecision(2);
+    std::cout << "  最大绝对误差: " << maxError << " dB" << std::endl;
+
+    return maxError < 1e-3 ? 0 : 1;
+}
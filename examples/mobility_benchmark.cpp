@@ -0,0 +1,79 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <cmath>
+#include "CommunicationModelAPI.h"
+
+/**
+ * @brief 移动场景仿真耗时
+ *
+ * 接收机沿10^6个航迹点的螺旋航迹移动（每个位置停留两个采样周期），
+ * 对比逐点setDistance + calculateLinkStatus、兼容接口与流式接口的耗时。
+ */
+
+namespace {
+
+double measureSeconds(const std::function<void()>& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main() {
+    const size_t positionCount = 500000;
+    std::vector<std::pair<double, double>> trajectory;
+    trajectory.reserve(positionCount * 2);
+    for (size_t i = 0; i < positionCount; ++i) {
+        double angle = 1e-4 * static_cast<double>(i);
+        double radius = 0.1 + 20.0 * static_cast<double>(i) / positionCount;
+        trajectory.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+        trajectory.push_back(trajectory.back());
+    }
+
+    CommunicationModelAPI api(CommunicationScenario::JAMMED_COMMUNICATION);
+    JammingEnvironment jamming = api.getJammingEnvironment();
+    jamming.isJammed = true;
+    jamming.jammerFrequency = api.getEnvironment().frequency;
+    jamming.jammerDistance = 5.0;
+    api.setJammingEnvironment(jamming);
+    api.enableStatusDescription(false);
+
+    std::cout << "移动场景仿真耗时 (航迹点 " << trajectory.size() << ")" << std::endl;
+
+    // 逐点设置距离，仅取前1%航迹点后按比例折算
+    const size_t naiveCount = trajectory.size() / 100;
+    double naive = measureSeconds([&]() {
+        for (size_t i = 0; i < naiveCount; ++i) {
+            api.setDistance(std::hypot(trajectory[i].first, trajectory[i].second));
+            api.calculateLinkStatus();
+        }
+    }) * 100.0;
+    api.setDistance(1.0);
+
+    double legacy = measureSeconds([&]() {
+        api.simulateMobilityScenario(trajectory, 0.1);
+    });
+
+    size_t connected = 0;
+    double streaming = measureSeconds([&]() {
+        api.simulateMobilityScenario(trajectory.data(), trajectory.size(), 0.1,
+            [&](const CommunicationMobilitySample* samples, size_t count) {
+                for (size_t i = 0; i < count; ++i) {
+                    connected += samples[i].metrics.isConnected ? 1 : 0;
+                }
+                return true;
+            });
+    });
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  逐点setDistance（折算）: " << std::setw(9) << naive * 1e3 << " ms" << std::endl;
+    std::cout << "  兼容接口（链路状态列表）: " << std::setw(9) << legacy * 1e3 << " ms" << std::endl;
+    std::cout << "  流式接口:                 " << std::setw(9) << streaming * 1e3 << " ms  (连接样本 "
+              << connected << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <numeric>
+#include <functional>
+#include "CommunicationModelAPI.h"
+#include "MathConstants.h"
+
+/**
+ * @brief 网络连通性分析性能对比
+ *
+ * 节点在正方形区域内均匀分布，区域大小使每个节点平均约有6个单跳邻居。
+ * 对比逐对检查全部节点对与calculateNetworkConnectivity（均匀网格 + 并查集）的耗时，
+ * 并在100k节点规模下单独测量网格算法。
+ */
+
+namespace {
+
+double measureSeconds(const std::function<void()>& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+std::vector<std::pair<double, double>> makeNodes(size_t count, double linkRange, unsigned int seed) {
+    const double averageNeighbors = 6.0;
+    double extent = linkRange * std::sqrt(static_cast<double>(count) * MathConstants::PI / averageNeighbors);
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, extent);
+    std::vector<std::pair<double, double>> nodes(count);
+    for (auto& node : nodes) {
+        node.first = coordinate(generator);
+        node.second = coordinate(generator);
+    }
+    return nodes;
+}
+
+// 逐对检查的参考实现
+double bruteForceConnectivity(const std::vector<std::pair<double, double>>& nodes, double linkRange) {
+    std::vector<size_t> parent(nodes.size());
+    std::iota(parent.begin(), parent.end(), size_t(0));
+    auto find = [&parent](size_t x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    };
+
+    double rangeSquared = linkRange * linkRange;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        for (size_t j = i + 1; j < nodes.size(); ++j) {
+            double dx = nodes[i].first - nodes[j].first;
+            double dy = nodes[i].second - nodes[j].second;
+            if (dx * dx + dy * dy <= rangeSquared) {
+                parent[find(i)] = find(j);
+            }
+        }
+    }
+
+    std::vector<double> sizes(nodes.size(), 0.0);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        sizes[find(i)] += 1.0;
+    }
+    double reachable = 0.0;
+    for (double size : sizes) {
+        reachable += size * (size - 1.0);
+    }
+    double total = static_cast<double>(nodes.size()) * static_cast<double>(nodes.size() - 1);
+    return reachable / total;
+}
+
+} // namespace
+
+int main() {
+    CommunicationModelAPI api;
+    CommunicationEnvironment env = api.getEnvironment();
+    env.frequency = 2400.0;
+    env.environmentType = EnvironmentType::URBAN_AREA;
+    api.setEnvironment(env);
+
+    CommunicationNetworkConnectivity probe;
+    api.analyzeNetworkConnectivity({{0.0, 0.0}}, probe);
+    const double linkRange = probe.linkRange;
+
+    std::cout << "网络连通性分析性能对比 (单跳最大连接距离 " << std::fixed << std::setprecision(3)
+              << linkRange << " km)" << std::endl;
+
+    auto nodes = makeNodes(10000, linkRange, 1);
+    double bruteForceResult = 0.0;
+    double bruteForceSeconds = measureSeconds([&]() {
+        bruteForceResult = bruteForceConnectivity(nodes, linkRange);
+    });
+    double gridResult = 0.0;
+    double gridSeconds = measureSeconds([&]() {
+        gridResult = api.calculateNetworkConnectivity(nodes);
+    });
+
+    std::cout << "  N = 10000" << std::endl;
+    std::cout << "    逐对检查: " << std::setw(9) << bruteForceSeconds * 1e3 << " ms  连通度 "
+              << std::setprecision(6) << bruteForceResult << std::endl;
+    std::cout << std::setprecision(3);
+    std::cout << "    网格索引: " << std::setw(9) << gridSeconds * 1e3 << " ms  连通度 "
+              << std::setprecision(6) << gridResult << "  (加速 " << std::setprecision(1)
+              << bruteForceSeconds / gridSeconds << "x)" << std::endl;
+
+    auto largeNodes = makeNodes(100000, linkRange, 2);
+    CommunicationNetworkConnectivity largeResult;
+    double largeSeconds = measureSeconds([&]() {
+        api.analyzeNetworkConnectivity(largeNodes, largeResult);
+    });
+    std::cout << std::setprecision(3);
+    std::cout << "  N = 100000" << std::endl;
+    std::cout << "    网格索引: " << std::setw(9) << largeSeconds * 1e3 << " ms  连通分量 "
+              << largeResult.componentCount << "  最大分量 " << largeResult.largestComponentSize << std::endl;
+
+    return std::abs(bruteForceResult - gridResult) < 1e-12 ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include "CommunicationModelAPI.h"
+#include "MathConstants.h"
+
+/**
+ * @brief 中继路径规划耗时
+ *
+ * 源、目的节点相距约100km，在无干扰与干扰机位于路径中段两种情况下，
+ * 测量不同最大中继数量下planRelayPath的耗时与结果。
+ */
+
+namespace {
+
+double measureSeconds(const std::function<void()>& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+void runCase(const CommunicationModelAPI& api, const char* title) {
+    const std::pair<double, double> source(0.0, 0.0);
+    const std::pair<double, double> destination(100.0, 10.0);
+
+    std::cout << "  " << title << std::endl;
+    for (int maxRelays : {1, 2, 4, 8}) {
+        CommunicationRelayPlan plan;
+        double seconds = measureSeconds([&]() {
+            api.planRelayPath(source, destination, maxRelays, plan);
+        });
+        std::cout << "    最大中继 " << maxRelays << ": " << std::setw(8) << std::fixed << std::setprecision(2)
+                  << seconds * 1e3 << " ms  ";
+        if (plan.feasible) {
+            std::cout << "中继 " << plan.relayIndices.size() << " 个  瓶颈信噪比 "
+                      << plan.bottleneckSnr << " dB  总长 " << plan.totalDistance << " km" << std::endl;
+        } else {
+            std::cout << "无可行路径" << std::endl;
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    CommunicationModelAPI api;
+    CommunicationEnvironment env = api.getEnvironment();
+    env.frequency = 400.0;
+    env.transmitPower = 40.0;
+    env.environmentType = EnvironmentType::OPEN_FIELD;
+    api.setEnvironment(env);
+
+    CommunicationNetworkConnectivity probe;
+    api.analyzeNetworkConnectivity({{0.0, 0.0}}, probe);
+    std::cout << "中继路径规划耗时 (单跳最大连接距离 " << std::fixed << std::setprecision(2)
+              << probe.linkRange << " km, 候选网格 " << MathConstants::RELAY_LATTICE_RESOLUTION << "x"
+              << MathConstants::RELAY_LATTICE_RESOLUTION << ")" << std::endl;
+    runCase(api, "无干扰");
+
+    api.setScenario(CommunicationScenario::JAMMED_COMMUNICATION);
+    JammingEnvironment jamming = api.getJammingEnvironment();
+    jamming.isJammed = true;
+    jamming.jammerFrequency = env.frequency;
+    jamming.jammerPower = 30.0;
+    jamming.jammerDistance = 50.0;
+    api.setJammingEnvironment(jamming);
+    runCase(api, "干扰机位于(50, 0)");
+
+    return 0;
+}
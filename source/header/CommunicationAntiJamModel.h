@@ -84,15 +84,16 @@ private:
     
     // 内部计算方法
     bool validateParameters() const;
+    bool validateParameters(double systemBandwidth) const;
     double calculateFrequencyHoppingGain() const;
     double calculateDirectSequenceGain() const;
     double calculateTimeHoppingGain() const;
     double calculateAdaptiveFilteringGain() const;
-    double calculateBeamFormingGain() const;
+    double calculateBeamFormingGain(double systemBandwidth) const;
     double calculateDiversityGain() const;
     double calculateErrorCorrectionGain() const;
     double calculateInterferenceCancellationGain() const;
-    double calculateTotalProcessingGain() const;
+    double calculateTotalProcessingGain(double systemBandwidth) const;
     
 public:
     // 构造函数
@@ -156,6 +157,7 @@ public:
     
     // 核心计算方法
     double calculateAntiJamGain() const;                    // 计算抗干扰增益
+    double calculateAntiJamGainForBandwidth(double bandwidth) const; // 按给定系统带宽计算抗干扰增益，不修改模型；带宽无效时按当前带宽计算
     double calculateJammerResistance() const;               // 计算抗干扰能力
     double calculateSignalToJammerRatio() const;            // 计算信干比
     double calculateBitErrorRateWithJamming() const;        // 计算有干扰时误码率
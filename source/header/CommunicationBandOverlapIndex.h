@@ -0,0 +1,48 @@
+#ifndef COMMUNICATION_BAND_OVERLAP_INDEX_H
+#define COMMUNICATION_BAND_OVERLAP_INDEX_H
+
+#include "CommunicationModelAPI.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 信道频段重叠索引
+ *
+ * 构造时将信道频段的下边沿与上边沿分别排序。查询时将干扰频段的边沿排序后与之归并，
+ * 按频率从低到高扫描：维护当前跨越扫描点的干扰频段与信道频段，某一频段开始时与另一类的全部活动频段配对。
+ * 每个重叠配对恰好在后开始的频段处产生一次，N个干扰频段、M个信道、K个重叠配对的查询复杂度为
+ * O(N log N + M + K)，加上构造的O(M log M)。仅边沿相接的频段重叠带宽为0，不计为重叠。
+ */
+class CommunicationBandOverlapIndex {
+private:
+    std::vector<std::pair<double, size_t>> channelStarts_;   // (下边沿, 信道序号)，按下边沿升序
+    std::vector<std::pair<double, size_t>> channelEnds_;     // (上边沿, 信道序号)，按上边沿升序
+    std::vector<double> channelBandwidths_;
+
+public:
+    /**
+     * @brief 由信道频段构造重叠索引
+     * @throws std::invalid_argument 存在无效频段时抛出
+     */
+    explicit CommunicationBandOverlapIndex(const std::vector<CommunicationFrequencyBand>& channels);
+
+    /**
+     * @brief 检查频段参数是否有效
+     * @details 中心频率须为有限值，带宽须为正的有限值，且上边沿高于下边沿
+     */
+    static bool isBandValid(const CommunicationFrequencyBand& band);
+
+    size_t getChannelCount() const { return channelBandwidths_.size(); }
+
+    /**
+     * @brief 查询全部重叠的(干扰频段, 信道)配对
+     * @param jammers 干扰频段
+     * @param overlaps 输出的重叠配对，按干扰频段序号升序
+     * @throws std::invalid_argument 存在无效频段时抛出
+     */
+    void findOverlaps(const std::vector<CommunicationFrequencyBand>& jammers,
+                      std::vector<CommunicationBandOverlap>& overlaps) const;
+};
+
+#endif // COMMUNICATION_BAND_OVERLAP_INDEX_H
@@ -0,0 +1,87 @@
+#ifndef COMMUNICATION_CHANNEL_SIMULATOR_H
+#define COMMUNICATION_CHANNEL_SIMULATOR_H
+
+#include "CommunicationLinkEvaluator.h"
+#include "CommunicationRandomStream.h"
+#include <cstdint>
+
+/**
+ * @brief 时变信道仿真器
+ *
+ * 在评估器基准环境的链路预算上叠加对数正态阴影衰落：第i个样本的阴影损耗为
+ * shadowingStdDev * normal(i)，信号强度与信噪比同时下降该损耗，其余指标由二者重新推导。
+ * 各样本的阴影损耗相互独立且只由(种子, i)决定，样本可按任意分块并行生成。
+ */
+class CommunicationChannelSimulator {
+private:
+    CommunicationRandomStream random_;
+    double baseSignalStrength_;          // 无阴影衰落时的信号强度 (dBm)
+    double baseSnr_;                     // 无阴影衰落时的信噪比 (dB)
+    double bandwidth_;                   // 系统带宽 (MHz)
+    double distance_;                    // 通信距离 (km)
+    double shadowingStdDev_;             // 阴影衰落标准差 (dB)
+    int threadCount_;
+
+    void generateChunk(uint64_t firstIndex, size_t count, double timeStep,
+                       CommunicationChannelSample* samples) const;
+
+public:
+    /**
+     * @brief 构造时变信道仿真器
+     * @param evaluator 链路评估器，取其基准环境的链路预算与环境类型的阴影衰落标准差
+     * @param seed 随机数种子
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     */
+    CommunicationChannelSimulator(const CommunicationLinkEvaluator& evaluator,
+                                  uint64_t seed, int threadCount);
+
+    /**
+     * @brief 计算仿真样本数
+     * @details 样本时刻为0, timeStep, 2*timeStep, ...，不超过duration（含步长容差）
+     * @param duration 仿真时长 (s)
+     * @param timeStep 时间步长 (s)
+     * @param sampleCount 输出的样本数
+     * @return 参数有效且样本数不超过MAX_CHANNEL_SIMULATION_SAMPLES返回true
+     */
+    static bool calculateSampleCount(double duration, double timeStep, uint64_t& sampleCount);
+
+    /**
+     * @brief 计算第index个样本的阴影衰落损耗
+     * @param index 样本下标
+     * @return 阴影衰落损耗 (dB)
+     */
+    double calculateShadowingLoss(uint64_t index) const;
+
+    /**
+     * @brief 计算给定阴影衰落损耗下的链路状态
+     * @param shadowingLoss 阴影衰落损耗 (dB)
+     * @return 链路状态（不含状态描述）
+     */
+    CommunicationLinkStatus evaluateSample(double shadowingLoss) const;
+
+    /**
+     * @brief 流式仿真
+     * @details 每批由各工作线程各生成一块CHANNEL_SIMULATION_CHUNK_SIZE个样本，
+     *          随后在调用线程中按时间顺序逐块交付给回调，内存占用只与线程数有关而与时长无关
+     * @param duration 仿真时长 (s)
+     * @param timeStep 时间步长 (s)
+     * @param callback 样本回调，返回false时停止仿真
+     * @return 参数有效返回true（包括被回调提前停止）
+     */
+    bool simulate(double duration, double timeStep, const CommunicationChannelSampleCallback& callback) const;
+
+    /**
+     * @brief 从指定样本起继续流式仿真
+     * @details 每交付一块即把nextSample推进到该块之后，回调返回false时停在已交付的位置，
+     *          之后以同一nextSample再次调用即可无缝续跑
+     * @param duration 仿真时长 (s)
+     * @param timeStep 时间步长 (s)
+     * @param nextSample 首个待生成的样本下标，返回时为首个未交付的样本下标
+     * @param callback 样本回调，返回false时停止仿真
+     * @return 参数有效且nextSample不超过样本数返回true（包括被回调提前停止）
+     */
+    bool simulate(double duration, double timeStep, uint64_t& nextSample,
+                  const CommunicationChannelSampleCallback& callback) const;
+};
+
+#endif // COMMUNICATION_CHANNEL_SIMULATOR_H
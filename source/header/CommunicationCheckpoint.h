@@ -0,0 +1,171 @@
+#ifndef COMMUNICATION_CHECKPOINT_H
+#define COMMUNICATION_CHECKPOINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief 二进制检查点格式
+ *
+ * 检查点由定长文件头与若干节组成。文件头依次为魔数、格式版本、文件头长度、字节序标记、节数、
+ * 数据区长度与数据区的FNV-1a校验和；每节以(标签, 布局长度, 节长度)开头，节长度按8字节对齐。
+ * 各节逐字段写入定长数值（枚举写为int32_t，布尔写为uint8_t），不写入结构体的对齐填充，
+ * 同一状态总是写出相同的字节；布局长度记录节内定长字段的字节数，读取时与当前版本比较。
+ * 读取方跳过不认识的节，新版本可以追加节而不破坏旧版本写出的检查点。
+ */
+class CommunicationCheckpointFormat {
+public:
+    static constexpr uint32_t MAGIC = 0x4B434D43;        // "CMCK"
+    static constexpr uint16_t VERSION = 1;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr size_t HEADER_SIZE = 32;
+    static constexpr size_t SECTION_HEADER_SIZE = 16;
+
+    // 节标签
+    static constexpr uint32_t SECTION_SETTINGS = 1;          // 场景与运行选项
+    static constexpr uint32_t SECTION_ENVIRONMENT = 2;       // 通信环境
+    static constexpr uint32_t SECTION_JAMMING = 3;           // 干扰环境
+    static constexpr uint32_t SECTION_SIGNAL_MODEL = 4;
+    static constexpr uint32_t SECTION_DISTANCE_MODEL = 5;
+    static constexpr uint32_t SECTION_RECEIVE_MODEL = 6;
+    static constexpr uint32_t SECTION_JAMMER_MODEL = 7;
+    static constexpr uint32_t SECTION_ANTI_JAM_MODEL = 8;
+    static constexpr uint32_t SECTION_CHANNEL_PROGRESS = 9;  // 时变信道仿真进度
+    static constexpr uint32_t SECTION_MONTE_CARLO_PROGRESS = 10; // 蒙特卡洛分析进度与累加器
+    static constexpr uint32_t SECTION_RANDOM = 11;           // 随机数主种子
+
+    /**
+     * @brief 计算FNV-1a 64位校验和
+     */
+    static uint64_t calculateChecksum(const uint8_t* data, size_t size);
+};
+
+/**
+ * @brief 检查点写入器
+ *
+ * 向调用方提供的缓冲区追加文件头与各节，finish()回填节数、数据区长度与校验和。
+ */
+class CommunicationCheckpointWriter {
+private:
+    std::vector<uint8_t>& buffer_;
+    size_t sectionStart_;                // 当前节的节头位置，不在节内时为0
+    uint32_t sectionCount_;
+
+    void append(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+
+public:
+    /**
+     * @brief 清空缓冲区并写入文件头占位
+     */
+    explicit CommunicationCheckpointWriter(std::vector<uint8_t>& buffer);
+
+    /**
+     * @brief 开始一节
+     * @param tag 节标签
+     * @param layoutSize 节内定长字段的字节数，读取时用于检查数据布局
+     */
+    void beginSection(uint32_t tag, uint32_t layoutSize);
+
+    /**
+     * @brief 结束当前节，补齐到8字节并回填节长度
+     */
+    void endSection();
+
+    /**
+     * @brief 以原始内存写入一个可按字节复制的对象
+     * @details 对象不能含对齐填充，否则未初始化的填充字节会写入检查点
+     */
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "检查点只能直接写入可按字节复制的类型");
+        append(&value, sizeof(T));
+    }
+
+    /**
+     * @brief 写入数组：先写元素个数，再写全部元素的原始内存
+     */
+    template <typename T>
+    void writeArray(const T* values, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "检查点只能直接写入可按字节复制的类型");
+        write(static_cast<uint64_t>(count));
+        if (count > 0) append(values, count * sizeof(T));
+    }
+
+    /**
+     * @brief 回填文件头
+     */
+    void finish();
+};
+
+/**
+ * @brief 检查点读取器
+ *
+ * 构造时校验文件头、字节序与校验和；之后按标签定位各节并顺序读取，
+ * 任何越界或布局不符都返回false而不会读出节外数据。
+ */
+class CommunicationCheckpointReader {
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t position_;
+    size_t sectionEnd_;
+    uint16_t version_;
+    bool valid_;
+
+    bool findSection(uint32_t tag, size_t& offset) const;
+
+    bool take(void* out, size_t size) {
+        if (size > sectionEnd_ - position_) return false;
+        if (size > 0) std::memcpy(out, data_ + position_, size);
+        position_ += size;
+        return true;
+    }
+
+public:
+    CommunicationCheckpointReader(const uint8_t* data, size_t size);
+
+    /**
+     * @brief 文件头与校验和是否有效
+     */
+    bool isValid() const { return valid_; }
+    uint16_t getVersion() const { return version_; }
+
+    /**
+     * @brief 定位到指定标签的节
+     * @param tag 节标签
+     * @param layoutSize 期望的布局长度
+     * @return 找到该节且布局长度一致返回true
+     */
+    bool openSection(uint32_t tag, uint32_t layoutSize);
+
+    /**
+     * @brief 检查点中是否包含指定标签的节
+     */
+    bool hasSection(uint32_t tag) const;
+
+    template <typename T>
+    bool read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "检查点只能直接读取可按字节复制的类型");
+        return take(&value, sizeof(T));
+    }
+
+    /**
+     * @brief 读取writeArray写入的数组
+     */
+    template <typename T>
+    bool readArray(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "检查点只能直接读取可按字节复制的类型");
+        uint64_t count = 0;
+        if (!read(count) || count > (sectionEnd_ - position_) / sizeof(T)) return false;
+        values.resize(static_cast<size_t>(count));
+        return take(values.data(), static_cast<size_t>(count) * sizeof(T));
+    }
+};
+
+#endif // COMMUNICATION_CHECKPOINT_H
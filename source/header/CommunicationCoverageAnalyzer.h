@@ -0,0 +1,62 @@
+#ifndef COMMUNICATION_COVERAGE_ANALYZER_H
+#define COMMUNICATION_COVERAGE_ANALYZER_H
+
+#include "CommunicationLinkEvaluator.h"
+
+/**
+ * @brief 覆盖区域分析器
+ *
+ * 发射机位于原点，干扰机位于(jammerX, jammerY)。接收点的信噪比由链路预算的距离系数
+ * 与接收点到干扰机的距离共同决定，可用性按calculatePerformance的Logistic映射由信噪比求出，
+ * 因此"可用性不低于阈值"等价于"信噪比不低于对应的信噪比阈值"。
+ */
+class CommunicationCoverageAnalyzer {
+private:
+    PositionalLinkCoefficients coefficients_;
+    double jammerX_;                       // 干扰机位置 (km)
+    double jammerY_;
+
+    double calculateCoverageExtent(double snrThreshold) const;
+
+public:
+    /**
+     * @brief 构造覆盖区域分析器
+     * @param evaluator 链路评估器，取其基准环境作为通信参数
+     * @param jammerX 干扰机横坐标 (km)
+     * @param jammerY 干扰机纵坐标 (km)
+     */
+    CommunicationCoverageAnalyzer(const CommunicationLinkEvaluator& evaluator, double jammerX, double jammerY);
+
+    /**
+     * @brief 由可用性阈值求信噪比阈值
+     * @param availability 可用性阈值，取值(0, 1)
+     * @return 信噪比阈值 (dB)
+     */
+    static double availabilityToSnr(double availability);
+
+    /**
+     * @brief 计算平面上一点的信噪比
+     * @details 到发射机或干扰机的距离小于MIN_DISTANCE_LIMIT时按MIN_DISTANCE_LIMIT计算
+     * @param x 横坐标 (km)
+     * @param y 纵坐标 (km)
+     * @return 信噪比 (dB)
+     */
+    double calculateSnrAt(double x, double y) const;
+
+    /**
+     * @brief 提取覆盖等值线
+     * @details 先以COVERAGE_CONTOUR_MIN_DEPTH层均匀网格覆盖分析区域，
+     *          只细分角点覆盖状态不一致的单元（以及包含发射机或干扰机的单元）直至maxDepth层，
+     *          再对最细层的跨越单元执行marching squares，沿等值线追踪相邻单元补齐穿过粗单元的部分，
+     *          最后按共享边拼接为折线。
+     *          采样点按格点坐标缓存，相邻单元共享的角点只求值一次，
+     *          求值次数与等值线长度成正比，而与分析区域面积无关
+     * @param threshold 可用性阈值，取值(0, 1)
+     * @param maxDepth 四叉树最大层级，取值[COVERAGE_CONTOUR_MIN_DEPTH, COVERAGE_CONTOUR_MAX_DEPTH]
+     * @param contour 输出的覆盖等值线
+     * @return 参数有效返回true
+     */
+    bool extractContour(double threshold, int maxDepth, CommunicationCoverageContour& contour) const;
+};
+
+#endif // COMMUNICATION_COVERAGE_ANALYZER_H
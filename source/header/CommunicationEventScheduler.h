@@ -0,0 +1,78 @@
+#ifndef COMMUNICATION_EVENT_SCHEDULER_H
+#define COMMUNICATION_EVENT_SCHEDULER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 离散事件调度器
+ *
+ * 以数组存储的二叉最小堆按(时刻, 入队序号)排序待处理事件：时刻相同的事件按入队先后出队，
+ * 因此相同输入下的事件序列完全确定。事件只携带事件源编号与类型，
+ * 事件源的状态由调用方按编号维护，堆元素为24字节的平凡类型，入队与出队均为O(log n)且不分配内存。
+ */
+class CommunicationEventScheduler {
+public:
+    /**
+     * @brief 调度事件
+     */
+    struct Event {
+        double time;                     // 事件时刻 (s)
+        uint64_t sequence;               // 入队序号，时刻相同时决定先后
+        uint32_t source;                 // 事件源编号
+        uint32_t kind;                   // 事件类型，由事件源定义
+    };
+
+private:
+    std::vector<Event> heap_;
+    uint64_t nextSequence_;
+
+    static bool earlier(const Event& a, const Event& b) {
+        return a.time < b.time || (a.time == b.time && a.sequence < b.sequence);
+    }
+
+public:
+    CommunicationEventScheduler();
+
+    /**
+     * @brief 预留堆容量
+     * @param capacity 同时待处理的最大事件数
+     */
+    void reserve(size_t capacity);
+
+    /**
+     * @brief 加入一个事件
+     * @param time 事件时刻 (s)
+     * @param source 事件源编号
+     * @param kind 事件类型
+     */
+    void schedule(double time, uint32_t source, uint32_t kind);
+
+    /**
+     * @brief 取出最早的事件
+     * @param event 输出的事件
+     * @return 队列为空时返回false
+     */
+    bool popNext(Event& event);
+
+    /**
+     * @brief 查看最早的事件（队列不得为空）
+     */
+    const Event& peek() const { return heap_.front(); }
+
+    bool empty() const { return heap_.empty(); }
+    size_t size() const { return heap_.size(); }
+
+    /**
+     * @brief 获取累计入队的事件数
+     */
+    uint64_t getScheduledCount() const { return nextSequence_; }
+
+    /**
+     * @brief 清空队列并重置入队序号
+     */
+    void clear();
+};
+
+#endif // COMMUNICATION_EVENT_SCHEDULER_H
@@ -0,0 +1,78 @@
+#ifndef COMMUNICATION_HOPPING_SIMULATOR_H
+#define COMMUNICATION_HOPPING_SIMULATOR_H
+
+#include "CommunicationModelAPI.h"
+#include "CommunicationRandomStream.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief 跳频与干扰碰撞的时隙仿真器
+ *
+ * 第i跳占用时隙[i / 跳频速率, i / 跳频速率 + 驻留时间)，信道由计数器随机数均匀选取。
+ * 每个时隙内受干扰的信道表示为按信道编号排列的位集：扫频干扰取驻留期间扫过的频段，
+ * 脉冲干扰仅在驻留期间有脉冲时占用其频段。仿真以64个时隙为一块，先为全部跳频网共享地构造
+ * 各时隙的干扰位集，再把每个网在块内各跳是否命中打包为一个64位字，命中数与数据包内的命中数
+ * 均由popcount求得。时间轴按块分给工作线程，各计数为整数，结果与线程数无关。
+ */
+class CommunicationHoppingSimulator {
+private:
+    CommunicationRandomStream random_;
+    double lowestEdge_;                  // 0号信道的下边沿 (MHz)
+    double channelSpacing_;              // 信道间隔 (MHz)
+    double hopPeriod_;                   // 跳频周期 (s)
+    double dwellTime_;                   // 驻留时间 (s)，不超过跳频周期
+    int channelCount_;
+    int threadCount_;
+
+    void markFrequencyRange(double low, double high, uint64_t* words) const;
+
+public:
+    /**
+     * @brief 构造跳频碰撞仿真器
+     * @param centerFrequency 跳频频带中心频率 (MHz)
+     * @param channelCount 跳频信道数
+     * @param channelSpacing 信道间隔 (MHz)，即每个信道的带宽
+     * @param hoppingRate 跳频速率 (Hz)
+     * @param dwellTime 驻留时间 (ms)
+     * @param seed 随机数种子
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     * @throws std::invalid_argument 跳频参数超出抗干扰参数配置的有效范围时抛出
+     */
+    CommunicationHoppingSimulator(double centerFrequency, int channelCount, double channelSpacing,
+                                  double hoppingRate, double dwellTime, uint64_t seed, int threadCount);
+
+    /**
+     * @brief 检查仿真配置是否有效
+     */
+    static bool isConfigValid(const CommunicationHoppingConfig& config);
+
+    /**
+     * @brief 获取信道位集的64位字数
+     */
+    size_t getWordCount() const { return (static_cast<size_t>(channelCount_) + 63) / 64; }
+
+    /**
+     * @brief 获取第net个跳频网第hop跳所在的信道
+     */
+    int selectChannel(uint64_t net, uint64_t hop) const;
+
+    /**
+     * @brief 计算第hop跳驻留期间受干扰的信道位集
+     * @param jammers 干扰源
+     * @param hop 跳序号
+     * @param words 输出位集，长度为getWordCount()，第c位表示信道c受干扰
+     */
+    void calculateJammedChannels(const std::vector<CommunicationTimingJammer>& jammers, uint64_t hop,
+                                 uint64_t* words) const;
+
+    /**
+     * @brief 执行碰撞仿真
+     * @param config 仿真配置，jammers为空时信道不受干扰
+     * @param result 输出的仿真结果
+     * @return 配置有效返回true
+     */
+    bool run(const CommunicationHoppingConfig& config, CommunicationHoppingResult& result) const;
+};
+
+#endif // COMMUNICATION_HOPPING_SIMULATOR_H
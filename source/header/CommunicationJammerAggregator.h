@@ -0,0 +1,71 @@
+#ifndef COMMUNICATION_JAMMER_AGGREGATOR_H
+#define COMMUNICATION_JAMMER_AGGREGATOR_H
+
+#include "CommunicationModelAPI.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 多干扰机干扰功率聚合器
+ *
+ * 干扰源按列（结构数组）保存位置、频带边沿与谱增益。第j个干扰源落入接收带宽的功率为
+ * 谱增益_j × 重叠带宽 / 距离²（mW），其中谱增益 = 10^((功率 - 20·log10(频率) - FSPL_CONSTANT) / 10) / 带宽
+ * 在构造时一次算出，逐接收点求和时只剩乘除与min/max，循环体无分支、无库函数调用，便于编译器向量化。
+ * 各接收点的求和顺序固定，批量计算按接收点分给工作线程，结果与线程数无关。
+ */
+class CommunicationJammerAggregator {
+private:
+    std::vector<double> x_;              // 横坐标 (km)
+    std::vector<double> y_;              // 纵坐标 (km)
+    std::vector<double> lowEdge_;        // 频带下边沿 (MHz)
+    std::vector<double> highEdge_;       // 频带上边沿 (MHz)
+    std::vector<double> spectralGain_;   // 1km处单位带宽的接收功率 (mW/MHz)
+    int threadCount_;
+
+public:
+    /**
+     * @brief 构造干扰功率聚合器
+     * @param jammers 干扰源数组
+     * @param count 干扰源数量，可以为0
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     * @throws std::invalid_argument 存在无效干扰源时抛出
+     */
+    CommunicationJammerAggregator(const CommunicationJammerEmitter* jammers, size_t count, int threadCount);
+
+    /**
+     * @brief 检查干扰源参数是否有效
+     * @details 坐标与功率须为有限值，频率与带宽须为正
+     */
+    static bool isEmitterValid(const CommunicationJammerEmitter& jammer);
+
+    size_t getJammerCount() const { return x_.size(); }
+
+    /**
+     * @brief 计算单个接收点的干扰总功率
+     * @param x 接收点横坐标 (km)
+     * @param y 接收点纵坐标 (km)
+     * @param lowEdge 接收带宽下边沿 (MHz)
+     * @param highEdge 接收带宽上边沿 (MHz)
+     * @param activeCount 输出频带与接收带宽重叠的干扰源数，可为空
+     * @return 落入接收带宽的干扰总功率 (mW)，干扰距离不小于MIN_DISTANCE_LIMIT
+     */
+    double calculateInterferencePower(double x, double y, double lowEdge, double highEdge,
+                                      uint32_t* activeCount = nullptr) const;
+
+    /**
+     * @brief 批量计算各接收点的干扰总功率
+     * @param receivers 接收点坐标 (km)
+     * @param count 接收点数量
+     * @param lowEdge 接收带宽下边沿 (MHz)
+     * @param highEdge 接收带宽上边沿 (MHz)
+     * @param powers 输出的干扰总功率 (mW)，长度不小于count
+     * @param activeCounts 输出的重叠干扰源数，可为空
+     */
+    void calculateInterferencePowerBatch(const std::pair<double, double>* receivers, size_t count,
+                                         double lowEdge, double highEdge,
+                                         double* powers, uint32_t* activeCounts = nullptr) const;
+};
+
+#endif // COMMUNICATION_JAMMER_AGGREGATOR_H
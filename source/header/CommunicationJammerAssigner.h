@@ -0,0 +1,58 @@
+#ifndef COMMUNICATION_JAMMER_ASSIGNER_H
+#define COMMUNICATION_JAMMER_ASSIGNER_H
+
+#include "CommunicationModelAPI.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 干扰机-目标分配器
+ *
+ * 由干扰模型模板生成各干扰机的干扰模型，按目标并行构建干扰有效性矩阵：
+ * 每个目标的一列经CommunicationJammerBank批量计算，干扰距离取干扰机与目标的平面距离（限制在干扰模型的有效作用距离内），
+ * 不修改任何干扰模型。矩阵构建后按分配方式求解，结果与线程数无关。
+ */
+class CommunicationJammerAssigner {
+private:
+    std::vector<CommunicationJammerModel> jammers_;
+    std::vector<std::pair<double, double>> jammerPositions_;
+    std::vector<CommunicationAssignmentTarget> targets_;
+    int threadCount_;
+
+    void assignOneToOne(CommunicationAssignmentResult& result) const;
+    void assignWithPowerBudget(double powerBudget, int maxTargetsPerJammer,
+                               CommunicationAssignmentResult& result) const;
+
+public:
+    /**
+     * @brief 构造干扰分配器
+     * @param jammerModel 干扰模型模板，提供干扰机的其余干扰参数
+     * @param jammers 干扰机列表
+     * @param targets 目标通信网列表
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     * @throws std::invalid_argument 存在无效干扰机或目标时抛出
+     */
+    CommunicationJammerAssigner(const CommunicationJammerModel& jammerModel,
+                                const std::vector<CommunicationAssignmentJammer>& jammers,
+                                const std::vector<CommunicationAssignmentTarget>& targets, int threadCount);
+
+    size_t getJammerCount() const { return jammers_.size(); }
+    size_t getTargetCount() const { return targets_.size(); }
+
+    /**
+     * @brief 并行计算干扰有效性矩阵
+     * @param matrix 输出的行主序干扰有效性矩阵，长度不小于干扰机数×目标数
+     */
+    void calculateEffectivenessMatrix(double* matrix) const;
+
+    /**
+     * @brief 构建干扰有效性矩阵并按配置求解分配
+     * @param config 分配配置
+     * @param result 输出的分配结果
+     * @return 配置有效时返回true
+     */
+    bool assign(const CommunicationAssignmentConfig& config, CommunicationAssignmentResult& result) const;
+};
+
+#endif // COMMUNICATION_JAMMER_ASSIGNER_H
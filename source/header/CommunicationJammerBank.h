@@ -0,0 +1,104 @@
+#ifndef COMMUNICATION_JAMMER_BANK_H
+#define COMMUNICATION_JAMMER_BANK_H
+
+#include "CommunicationJammerModel.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief 按干扰类型分组的干扰机组
+ *
+ * 以列（结构数组）保存多台干扰机的参数，同一干扰类型的干扰机存放在同一组内。
+ * 计算时逐组执行该类型的干扰效果公式：组内循环没有按类型的分支，
+ * 对数与10的幂由CommunicationVectorMath批量求值，便于编译器向量化。
+ * 各干扰机的计算结果与CommunicationJammerModel::calculateJammerEffectiveness()
+ * 及calculateJammerEffectivePower()在数值上一致（相对误差约1e-14）。
+ */
+class CommunicationJammerBank {
+private:
+    // 六种干扰类型各占一组，末组存放枚举范围外的类型，其干扰有效性为0
+    static constexpr int JAMMER_TYPE_COUNT = 6;
+    static constexpr int GROUP_COUNT = JAMMER_TYPE_COUNT + 1;
+
+    /**
+     * @brief 单一干扰类型的参数列
+     */
+    struct Group {
+        std::vector<double> jammerPower;         // 干扰功率 (dBm)
+        std::vector<double> jammerFrequency;     // 干扰中心频率 (kHz)
+        std::vector<double> jammerBandwidth;     // 干扰带宽 (kHz)
+        std::vector<double> targetFrequency;     // 目标信号频率 (kHz)
+        std::vector<double> targetBandwidth;     // 目标信号带宽 (kHz)
+        std::vector<double> targetPower;         // 目标信号功率 (dBm)
+        std::vector<double> distance;            // 干扰机到目标距离 (km)
+        std::vector<double> atmosphericLoss;     // 大气损耗 (dB)
+        std::vector<double> dutyCycle;           // 占空比，脉冲干扰使用
+        std::vector<double> sweepRange;          // 扫频范围 (MHz)，扫频干扰使用
+        std::vector<size_t> indices;             // 干扰机在加入顺序中的序号
+    };
+
+    Group groups_[GROUP_COUNT];
+    size_t size_;
+
+    static int getGroupIndex(JammerType type);
+    static void evaluateGroup(int groupIndex, const Group& group, size_t begin, size_t end,
+                              double* effectiveness, double* effectivePower);
+
+public:
+    CommunicationJammerBank();
+
+    /**
+     * @brief 由干扰模型列表构造干扰机组
+     */
+    explicit CommunicationJammerBank(const std::vector<CommunicationJammerModel>& jammers);
+
+    /**
+     * @brief 加入一台干扰机
+     * @details 拷贝干扰模型当前的干扰机参数与目标信号参数，之后对模型的修改不影响干扰机组
+     */
+    void add(const CommunicationJammerModel& jammer);
+
+    /**
+     * @brief 加入一台干扰机并指定其干扰的目标
+     * @details 干扰机参数取自干扰模型，目标信号参数与干扰距离取给定值，不修改干扰模型
+     * @param targetFrequency 目标信号频率，单位与干扰模型的目标信号频率相同
+     * @param targetBandwidth 目标信号带宽，单位与干扰模型的目标信号带宽相同
+     * @param targetPower 目标信号功率 (dBm)
+     * @param distance 干扰机到目标距离 (km)，须为正
+     */
+    void add(const CommunicationJammerModel& jammer, double targetFrequency, double targetBandwidth,
+             double targetPower, double distance);
+
+    /**
+     * @brief 清空干扰机组，保留已分配的容量以便重复使用
+     */
+    void clear();
+    size_t size() const { return size_; }
+
+    /**
+     * @brief 获取指定干扰类型的干扰机数量
+     */
+    size_t getGroupSize(JammerType type) const;
+
+    /**
+     * @brief 计算各干扰机的干扰有效性与到达目标的有效干扰功率
+     * @param effectiveness 输出的干扰有效性，按加入顺序排列，长度不小于size()
+     * @param effectivePower 输出的有效干扰功率 (dBm)，按加入顺序排列，可为空
+     */
+    void calculateEffectiveness(double* effectiveness, double* effectivePower = nullptr) const;
+
+    /**
+     * @brief 计算按干扰有效性加权的干扰总功率
+     * @return Σ 10^(有效干扰功率/10) × 干扰有效性 (mW)
+     */
+    double calculateWeightedJammerPower() const;
+
+    /**
+     * @brief 计算多干扰机协同效果
+     * @param targetPower_dBm 目标信号功率 (dBm)
+     * @return 协同效果(0-1)，与CommunicationJammerModel::calculateCombinedJammerEffect()的定义相同
+     */
+    double calculateCombinedEffect(double targetPower_dBm) const;
+};
+
+#endif // COMMUNICATION_JAMMER_BANK_H
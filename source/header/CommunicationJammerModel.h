@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <vector>
 #include <cmath>
+#include <algorithm>
 #include "CommunicationDistanceModel.h"
 
 // 干扰类型枚举
@@ -34,7 +35,21 @@ enum class JammerEffectLevel {
     COMPLETE_DENIAL   // 完全拒止
 };
 
+// 干扰有效性随目标距离的变化规律：有效性(d) = min(ceiling, coefficient × d^(-exponent))，d单位km
+struct JammerDistanceLaw {
+    double coefficient;   // 1km处未饱和的干扰有效性
+    double exponent;      // 距离指数，为0时干扰有效性与距离无关
+    double ceiling;       // 干扰有效性上限
+
+    double evaluate(double distance_km) const {
+        return std::min(ceiling, coefficient * std::pow(distance_km, -exponent));
+    }
+};
+
 class CommunicationJammerModel {
+    // 干扰机组按列读取各干扰模型的参数
+    friend class CommunicationJammerBank;
+
 private:
     // 干扰机基本参数
     JammerType jammerType;        // 干扰类型
@@ -133,12 +148,15 @@ public:
     double getDutyCycle() const;
     double getSweepRate() const;
     double getSweepRange() const;
+    double getPropagationLoss() const;
+    double getAtmosphericLoss() const;
 
 
 
     // 核心计算方法
     double calculatePulsePeakPower(double averagePower, double dutyCycle) const;    //计算脉冲干扰的峰值功率
     double calculateJammerToSignalRatio() const;    // 计算干扰干信比(dB)
+    double calculateJammerToSignalRatioForTarget(double targetFreq_kHz) const; // 按给定目标频率计算干信比，不修改模型；频率无效时按当前目标频率计算
     double calculateJammerEffectiveness() const;     // 计算干扰有效性(0-1)
     double calculateCommunicationDegradation() const; // 计算通信性能下降率(0-1)
     JammerEffectLevel evaluateJammerEffect() const;  // 评估干扰效果等级
@@ -165,13 +183,14 @@ public:
     double calculateJammingRange() const;            // 计算干扰有效覆盖范围(km)
     double calculateJammingArea() const;             // 计算干扰覆盖面积(m²)
     double calculateJammerCoverage() const;          // 计算干扰覆盖范围(km²)
+    JammerDistanceLaw calculateEffectivenessDistanceLaw() const; // 干扰有效性随目标距离的变化规律
     bool isTargetInJammerRange() const;             // 判断目标是否在干扰范围内
     
     // 干扰功率需求计算
     double calculateRequiredJammerPower(double desired_js_ratio) const; // 计算所需干扰功率
     double calculateOptimalJammerFrequency() const;  // 计算最优干扰频率
     
-    // 多干扰机协同效果
+    // 多干扰机协同效果（经CommunicationJammerBank按干扰类型分组计算）
     double calculateCombinedJammerEffect(const std::vector<CommunicationJammerModel>& jammers) const;
     
     // 获取信息字符串
@@ -0,0 +1,230 @@
+#ifndef COMMUNICATION_LINK_EVALUATOR_H
+#define COMMUNICATION_LINK_EVALUATOR_H
+
+#include "CommunicationModelAPI.h"
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief 链路预算的距离系数
+ *
+ * 除距离外其余参数固定时，信号强度与信噪比都是log10(距离)的线性函数：
+ * signal(d) = signalAtUnitDistance - distanceSlope * log10(d)，信噪比同理。
+ */
+struct LinkBudgetCoefficients {
+    double signalAtUnitDistance;     // 1km处信号强度 (dBm)
+    double snrAtUnitDistance;        // 1km处信噪比 (dB)
+    double distanceSlope;            // 距离每增加十倍的损耗 (dB)
+};
+
+/**
+ * @brief 位置相关的链路系数
+ *
+ * 干扰机位置固定时，接收点的干信比随发射机与干扰机到接收点的距离变化：
+ * snr = jammerFreeSnrAtUnitDistance - distanceSlope * log10(链路距离)
+ *       - [jammed] * (unitJammerToSignalRatio + FSPL_DISTANCE_COEFFICIENT * (log10(链路距离) - log10(干扰距离)))
+ */
+struct PositionalLinkCoefficients {
+    double jammerFreeSnrAtUnitDistance;  // 不计干扰时1km处的信噪比 (dB)
+    double distanceSlope;                // 距离每增加十倍的损耗 (dB)
+    double unitJammerToSignalRatio;      // 链路距离与干扰距离均为1km时的干信比 (dB)，无干扰时为0
+    bool jammed;                         // 是否存在干扰
+};
+
+/**
+ * @brief 链路评估器
+ *
+ * 保存CommunicationModelAPI某一时刻的不可变快照（通信场景、基准环境、干扰环境、
+ * 干扰/抗干扰子模型以及各环境类型的损耗配置），对任意通信环境参数求链路状态。
+ * 所有计算方法均为const且不修改任何共享对象，适合批量计算：
+ * 每个样本只需完成一次路径损耗与指标推导，而无需经过API的setter与子模型同步。
+ */
+class CommunicationLinkEvaluator {
+private:
+    // 快照参数
+    CommunicationScenario scenario_;
+    CommunicationEnvironment environment_;
+    JammingEnvironment jammingEnv_;
+    CommunicationJammerModel jammerModel_;
+    CommunicationAntiJamModel antiJamModel_;
+
+    // 环境损耗配置快照（按EnvironmentType下标）
+    static constexpr int ENVIRONMENT_TYPE_COUNT = 3;
+    EnvironmentLossConfig lossConfigs_[ENVIRONMENT_TYPE_COUNT];
+
+    // 基准环境下预先计算的干扰/抗干扰修正量
+    double baseJammerToSignalRatio_;
+    double baseAntiJamGain_;
+
+    double calculateJammerToSignalRatio(double frequency) const;
+    double calculateAntiJamGain(double bandwidth) const;
+    double calculateSnrCorrection(const CommunicationEnvironment& env) const;
+    CommunicationLinkStatus evaluateValues(const CommunicationEnvironment& env) const;
+    static void loadEnvironment(const CommunicationEnvironmentArrays& environments, size_t index,
+                                CommunicationEnvironment& env);
+    static std::string formatDescription(double signalStrength, double snr, double ber, double throughput);
+
+public:
+    /**
+     * @brief 构造链路评估器
+     * @param scenario 通信场景
+     * @param environment 基准通信环境
+     * @param jammingEnv 干扰环境
+     * @param jammerModel 已按基准环境同步的干扰模型
+     * @param antiJamModel 已按基准环境同步的抗干扰模型
+     */
+    CommunicationLinkEvaluator(CommunicationScenario scenario,
+                               const CommunicationEnvironment& environment,
+                               const JammingEnvironment& jammingEnv,
+                               const CommunicationJammerModel& jammerModel,
+                               const CommunicationAntiJamModel& antiJamModel);
+
+    /**
+     * @brief 计算总路径损耗（自由空间损耗 + 环境损耗）
+     * @param distance 距离 (km)
+     * @param frequency 频率 (MHz)
+     * @param envType 环境类型
+     * @return 总路径损耗 (dB)，距离或频率非正时返回0
+     */
+    double calculateTotalPathLoss(double distance, double frequency, EnvironmentType envType) const;
+
+    /**
+     * @brief 获取环境类型的损耗配置快照
+     * @param envType 环境类型，未知类型按开阔地处理
+     * @return 损耗配置
+     */
+    const EnvironmentLossConfig& getLossConfig(EnvironmentType envType) const;
+
+    /**
+     * @brief 计算链路预算的距离系数
+     * @details 供网络拓扑、覆盖栅格等按距离批量求值的场景使用，
+     *          距离非正时的取值需由调用方单独处理
+     * @param env 通信环境参数（distance字段被忽略）
+     * @return 链路预算的距离系数
+     */
+    LinkBudgetCoefficients calculateLinkBudgetCoefficients(const CommunicationEnvironment& env) const;
+
+    /**
+     * @brief 计算信号源与干扰机到接收点距离均为1km时的干信比
+     * @details 干扰与信号均按自由空间传播，接收点的干信比 =
+     *          该值 + FSPL_DISTANCE_COEFFICIENT * (log10(信号距离) - log10(干扰距离))
+     * @param frequency 通信频率 (MHz)
+     * @return 干信比 (dB)
+     */
+    double calculateUnitDistanceJammerToSignalRatio(double frequency) const;
+
+    /**
+     * @brief 计算按收发位置求链路信噪比的系数
+     * @details 供覆盖分析、中继规划等需要区分接收点与干扰机相对位置的场景使用
+     * @param env 通信环境参数（distance字段被忽略）
+     * @return 位置相关的链路系数
+     */
+    PositionalLinkCoefficients calculatePositionalLinkCoefficients(const CommunicationEnvironment& env) const;
+
+    /**
+     * @brief 计算单个通信环境下的链路状态
+     * @param env 通信环境参数
+     * @param withDescription 是否生成状态描述字符串
+     * @return 链路状态
+     */
+    CommunicationLinkStatus evaluate(const CommunicationEnvironment& env, bool withDescription = true) const;
+
+    /**
+     * @brief 计算单个通信环境下的链路数值指标（不分配内存）
+     * @param env 通信环境参数
+     * @return 链路数值指标
+     */
+    CommunicationLinkMetrics evaluateMetrics(const CommunicationEnvironment& env) const;
+
+    /**
+     * @brief 批量计算链路状态（数组结构输入）
+     * @param environments 通信环境数组
+     * @param count 数组长度
+     * @param results 输出数组，长度不小于count
+     * @param withDescription 是否生成状态描述字符串
+     */
+    void evaluateBatch(const CommunicationEnvironment* environments, size_t count,
+                       CommunicationLinkStatus* results, bool withDescription = true) const;
+
+    /**
+     * @brief 批量计算链路状态（列式输入）
+     * @param environments 列式通信环境参数
+     * @param results 输出数组，长度不小于environments.count
+     * @param withDescription 是否生成状态描述字符串
+     */
+    void evaluateBatch(const CommunicationEnvironmentArrays& environments,
+                       CommunicationLinkStatus* results, bool withDescription = true) const;
+
+    /**
+     * @brief 批量计算链路数值指标（数组结构输入）
+     * @param environments 通信环境数组
+     * @param count 数组长度
+     * @param results 输出数组，长度不小于count
+     */
+    void evaluateMetricsBatch(const CommunicationEnvironment* environments, size_t count,
+                              CommunicationLinkMetrics* results) const;
+
+    /**
+     * @brief 批量计算链路数值指标（列式输入）
+     * @param environments 列式通信环境参数
+     * @param results 输出数组，长度不小于environments.count
+     */
+    void evaluateMetricsBatch(const CommunicationEnvironmentArrays& environments,
+                              CommunicationLinkMetrics* results) const;
+
+    /**
+     * @brief 将链路状态压缩为数值指标
+     * @param status 链路状态
+     * @return 链路数值指标
+     */
+    static CommunicationLinkMetrics toLinkMetrics(const CommunicationLinkStatus& status);
+
+    /**
+     * @brief 由信号强度和信噪比推导全部链路指标
+     * @param signalStrength 信号强度 (dBm)
+     * @param snr 信噪比 (dB)
+     * @param bandwidth 系统带宽 (MHz)
+     * @param distance 通信距离 (km)
+     * @return 链路状态（不含状态描述）
+     */
+    static CommunicationLinkStatus deriveLinkStatus(double signalStrength, double snr,
+                                                    double bandwidth, double distance);
+
+    /**
+     * @brief 由信噪比计算链路可用性
+     * @details 可用性 = 1 / (1 + exp(-(snr - AVAILABILITY_SNR_OFFSET) / AVAILABILITY_DIVISOR))
+     * @param snr 信噪比 (dB)
+     * @return 可用性 (0-1)
+     */
+    static double calculateAvailability(double snr);
+
+    /**
+     * @brief 评估通信质量等级
+     * @param snr 信噪比 (dB)
+     * @param ber 误码率
+     * @param packetLoss 丢包率
+     * @return 通信质量等级
+     */
+    static CommunicationQuality assessQuality(double snr, double ber, double packetLoss);
+
+    /**
+     * @brief 生成链路状态描述字符串
+     * @param status 链路状态
+     * @return 状态描述
+     */
+    static std::string formatStatusDescription(const CommunicationLinkStatus& status);
+
+    /**
+     * @brief 由链路数值指标生成状态描述字符串
+     * @param metrics 链路数值指标
+     * @return 状态描述
+     */
+    static std::string formatStatusDescription(const CommunicationLinkMetrics& metrics);
+
+    // 快照参数获取
+    CommunicationScenario getScenario() const { return scenario_; }
+    const CommunicationEnvironment& getEnvironment() const { return environment_; }
+    const JammingEnvironment& getJammingEnvironment() const { return jammingEnv_; }
+};
+
+#endif // COMMUNICATION_LINK_EVALUATOR_H
@@ -0,0 +1,121 @@
+#ifndef COMMUNICATION_LINK_PREDICTOR_H
+#define COMMUNICATION_LINK_PREDICTOR_H
+
+#include "CommunicationModelAPI.h"
+#include "MathConstants.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief 链路指标的增量卡尔曼预测器
+ *
+ * 对每条链路的信号强度与信噪比分别以"水平 + 趋势"二维状态建模（常速度模型），
+ * 过程噪声为白噪声加速度，量测为带高斯噪声的指标值。两个指标的噪声参数相同且同时量测，
+ * 因此协方差与卡尔曼增益只依赖采样间隔，可共用一份，每个新样本的更新为O(1)且不分配内存。
+ * 各链路状态按列存放，批量更新与预测按下标顺序遍历，适合每个周期处理数千条链路。
+ */
+class CommunicationLinkPredictor {
+private:
+    double processNoise_;                // 过程噪声谱密度 (dB²/s³)
+    double measurementNoise_;            // 量测噪声方差 (dB²)
+
+    // 按链路下标存放的滤波状态
+    std::vector<double> lastTimestamp_;  // 最近一次量测时刻 (s)
+    std::vector<double> signalLevel_;    // 信号强度水平 (dBm)
+    std::vector<double> signalTrend_;    // 信号强度变化率 (dB/s)
+    std::vector<double> snrLevel_;       // 信噪比水平 (dB)
+    std::vector<double> snrTrend_;       // 信噪比变化率 (dB/s)
+    std::vector<double> covarianceLevel_;
+    std::vector<double> covarianceCross_;
+    std::vector<double> covarianceTrend_;
+    std::vector<unsigned char> initialized_;
+
+public:
+    /**
+     * @brief 构造预测器
+     * @param linkCount 链路数
+     * @param processNoise 过程噪声谱密度 (dB²/s³)，越大越快跟随指标变化
+     * @param measurementNoise 量测噪声方差 (dB²)，越大平滑越强
+     * @throws std::invalid_argument 链路数为0或噪声参数不是正有限值时抛出
+     */
+    explicit CommunicationLinkPredictor(size_t linkCount = 1,
+                                        double processNoise = MathConstants::LINK_PREDICTOR_PROCESS_NOISE,
+                                        double measurementNoise = MathConstants::LINK_PREDICTOR_MEASUREMENT_NOISE);
+
+    size_t getLinkCount() const { return lastTimestamp_.size(); }
+
+    /**
+     * @brief 清除全部链路的滤波状态
+     */
+    void reset();
+
+    /**
+     * @brief 清除单条链路的滤波状态
+     */
+    void reset(size_t link);
+
+    /**
+     * @brief 链路是否已有量测
+     */
+    bool hasEstimate(size_t link) const { return link < getLinkCount() && initialized_[link] != 0; }
+
+    /**
+     * @brief 获取链路最近一次量测时刻 (s)
+     */
+    double getLastTimestamp(size_t link) const { return lastTimestamp_[link]; }
+
+    /**
+     * @brief 以一个新样本更新链路状态
+     * @param link 链路下标
+     * @param timestamp 采样时刻 (s)，不得早于该链路上一次采样时刻
+     * @param signalStrength 信号强度 (dBm)
+     * @param snr 信噪比 (dB)
+     * @return 下标有效、数值有限且时刻不倒退返回true，否则状态不变
+     */
+    bool update(size_t link, double timestamp, double signalStrength, double snr);
+
+    /**
+     * @brief 以一条监控记录更新链路状态
+     */
+    bool update(size_t link, const CommunicationStatusRecord& record) {
+        return update(link, record.timestamp, record.metrics.signalStrength, record.metrics.signalToNoiseRatio);
+    }
+
+    /**
+     * @brief 批量更新，第i个样本对应第i条链路
+     * @param timestamps 采样时刻数组
+     * @param signalStrengths 信号强度数组
+     * @param snrs 信噪比数组
+     * @param count 样本数，不超过链路数
+     * @return 成功更新的链路数
+     */
+    size_t updateBatch(const double* timestamps, const double* signalStrengths, const double* snrs, size_t count);
+
+    /**
+     * @brief 预测链路指标
+     * @param link 链路下标
+     * @param horizon 相对最近一次量测时刻的预测时长 (s)
+     * @param signalStrength 输出的预测信号强度 (dBm)
+     * @param snr 输出的预测信噪比 (dB)
+     * @return 链路已有量测且预测时长为非负有限值返回true
+     */
+    bool predict(size_t link, double horizon, double& signalStrength, double& snr) const;
+
+    /**
+     * @brief 批量预测全部链路
+     * @details 尚无量测的链路输出NaN
+     * @param horizon 相对各链路最近一次量测时刻的预测时长 (s)
+     * @param signalStrengths 输出数组，长度不小于链路数
+     * @param snrs 输出数组，长度不小于链路数
+     * @return 预测时长有效返回true
+     */
+    bool predictBatch(double horizon, double* signalStrengths, double* snrs) const;
+
+    /**
+     * @brief 获取预测值的标准差 (dB)
+     * @details 由状态协方差外推得到，两个指标相同；链路尚无量测时返回+inf
+     */
+    double getPredictionStandardDeviation(size_t link, double horizon) const;
+};
+
+#endif // COMMUNICATION_LINK_PREDICTOR_H
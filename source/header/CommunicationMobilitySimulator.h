@@ -0,0 +1,81 @@
+#ifndef COMMUNICATION_MOBILITY_SIMULATOR_H
+#define COMMUNICATION_MOBILITY_SIMULATOR_H
+
+#include "CommunicationLinkEvaluator.h"
+#include <utility>
+
+/**
+ * @brief 移动场景仿真器
+ *
+ * 发射机位于原点、干扰机位于(jammerX, jammerY)，接收机沿航迹点移动。
+ * 除收发距离与干扰距离外的链路预算在构造时计算一次，每个航迹点只需求两个对数距离项：
+ * 信号强度 = signalAtUnitDistance - slope/2 * log10(ds²)
+ * 信噪比 = jammerFreeSnrAtUnitDistance - slope/2 * log10(ds²)
+ *          - [jammed] * (unitJ/S + FSPL系数/2 * (log10(ds²) - log10(dj²)))
+ * 距离小于MIN_DISTANCE_LIMIT时按MIN_DISTANCE_LIMIT计算。
+ */
+class CommunicationMobilitySimulator {
+private:
+    PositionalLinkCoefficients coefficients_;
+    double signalAtUnitDistance_;        // 1km处信号强度 (dBm)
+    double bandwidth_;                   // 系统带宽 (MHz)
+    double jammerX_;                     // 干扰机位置 (km)
+    double jammerY_;
+    int threadCount_;
+
+    /**
+     * @brief 线程私有的分块缓冲区
+     */
+    struct ChunkWorkspace;
+
+    void evaluateChunk(const std::pair<double, double>* waypoints, size_t count, ChunkWorkspace& workspace) const;
+
+public:
+    /**
+     * @brief 构造移动场景仿真器
+     * @param evaluator 链路评估器，取其基准环境作为链路参数
+     * @param jammerX 干扰机横坐标 (km)
+     * @param jammerY 干扰机纵坐标 (km)
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     */
+    CommunicationMobilitySimulator(const CommunicationLinkEvaluator& evaluator,
+                                   double jammerX, double jammerY, int threadCount);
+
+    /**
+     * @brief 计算单个航迹点的链路状态
+     * @param waypoint 接收机坐标 (km)
+     * @return 链路状态（不含状态描述）
+     */
+    CommunicationLinkStatus evaluateWaypoint(const std::pair<double, double>& waypoint) const;
+
+    /**
+     * @brief 批量计算航迹点的链路状态
+     * @param waypoints 航迹点数组
+     * @param count 航迹点数量
+     * @param results 输出数组，长度不小于count（不含状态描述）
+     * @return 航迹点坐标均为有限值返回true
+     */
+    bool evaluateTrajectory(const std::pair<double, double>* waypoints, size_t count,
+                            CommunicationLinkStatus* results) const;
+
+    /**
+     * @brief 流式仿真
+     * @details 每批由各工作线程各处理一块CHANNEL_SIMULATION_CHUNK_SIZE个航迹点：
+     *          先求整块的距离平方并批量取对数，再逐点推导链路指标，与前一航迹点重合的点直接复用其结果。
+     *          各块按航迹顺序在调用线程中交付给回调，输出缓冲区大小与航迹长度无关
+     * @param waypoints 航迹点数组
+     * @param count 航迹点数量
+     * @param timeStep 相邻航迹点的时间间隔 (s)
+     * @param callback 样本回调，返回false时停止仿真
+     * @return 参数有效返回true（包括被回调提前停止）
+     */
+    bool simulate(const std::pair<double, double>* waypoints, size_t count, double timeStep,
+                  const CommunicationMobilitySampleCallback& callback) const;
+
+    /**
+     * @brief 检查航迹点坐标是否均为有限值
+     */
+    static bool isTrajectoryValid(const std::pair<double, double>* waypoints, size_t count);
+};
+
+#endif // COMMUNICATION_MOBILITY_SIMULATOR_H
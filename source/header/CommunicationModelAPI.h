@@ -7,11 +7,17 @@
 #include "CommunicationJammerModel.h"
 #include "CommunicationAntiJamModel.h"
 #include "EnvironmentLossConfigManager.h"
+#include "CommunicationStatistics.h"
+#include "CommunicationRandomStream.h"
 #include <string>
 #include <vector>
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <functional>
+
+class CommunicationLinkEvaluator;
+class CommunicationStatusMonitor;
 
 /**
  * @brief 通信场景类型枚举
@@ -51,6 +57,23 @@ struct CommunicationLinkStatus {
     std::string statusDescription;       // 状态描述
 };
 
+/**
+ * @brief 链路数值指标结构体
+ *
+ * CommunicationLinkStatus的紧凑版本，仅包含数值字段，不含字符串，
+ * 可直接按数组批量存储，状态描述按需通过describeLinkMetrics生成。
+ */
+struct CommunicationLinkMetrics {
+    float signalStrength;                // 信号强度 (dBm)
+    float signalToNoiseRatio;            // 信噪比 (dB)
+    float bitErrorRate;                  // 误码率
+    float throughput;                    // 吞吐量 (Mbps)
+    float latency;                       // 延迟 (ms)
+    float packetLossRate;                // 丢包率
+    CommunicationQuality quality;        // 通信质量
+    bool isConnected;                    // 是否连接
+};
+
 /**
  * @brief 通信性能指标结构体
  */
@@ -92,6 +115,448 @@ struct JammingEnvironment {
     double jammerDistance;               // 干扰机距离 (km)
     double jammerDensity;                // 干扰机密度 (0-1)
     std::vector<double> jammerFrequencies; // 多个干扰频率
+    std::vector<std::pair<double, double>> jammerPositions; // 各干扰源坐标 (km)，与干扰源一一对应，为空时均位于(jammerDistance, 0)
+};
+
+/**
+ * @brief 列式（结构数组）通信环境参数
+ *
+ * 每一列指向长度为count的连续数组，列指针为空时该参数沿用API当前环境的取值。
+ */
+struct CommunicationEnvironmentArrays {
+    const double* frequency;                 // 工作频率列 (MHz)
+    const double* bandwidth;                 // 系统带宽列 (MHz)
+    const double* transmitPower;             // 发射功率列 (dBm)
+    const double* noisePower;                // 噪声功率列 (dBm)
+    const double* distance;                  // 通信距离列 (km)
+    const EnvironmentType* environmentType;  // 环境类型列
+    size_t count;                            // 样本数量
+};
+
+/**
+ * @brief 参数扫描类型枚举
+ */
+enum class SweepParameter {
+    FREQUENCY,                 // 工作频率 (MHz)
+    TRANSMIT_POWER,            // 发射功率 (dBm)
+    DISTANCE                   // 通信距离 (km)
+};
+
+/**
+ * @brief 参数扫描结果结构体
+ *
+ * values与statuses一一对应并连续存储，values按扫描顺序升序排列。
+ */
+struct CommunicationSweepResult {
+    SweepParameter parameter;                     // 扫描参数
+    std::vector<double> values;                   // 扫描点取值
+    std::vector<CommunicationLinkStatus> statuses; // 各扫描点的链路状态
+};
+
+/**
+ * @brief 链路矩阵结构体
+ *
+ * 以行主序连续存储nodeCount×nodeCount的链路信噪比矩阵，
+ * 第i行第j列为节点i与节点j之间的链路信噪比 (dB)，矩阵对称，对角线为0。
+ */
+struct CommunicationLinkMatrix {
+    size_t nodeCount;                    // 节点数量
+    std::vector<float> values;           // 行主序信噪比 (dB)
+    
+    float at(size_t row, size_t col) const { return values[row * nodeCount + col]; }
+};
+
+/**
+ * @brief 网络连通性分析结果结构体
+ *
+ * 两节点间链路满足连接条件（见CommunicationLinkStatus::isConnected）即视为单跳相连，
+ * 连通分量按多跳可达关系划分。
+ */
+struct CommunicationNetworkConnectivity {
+    size_t nodeCount;                    // 节点数量
+    size_t componentCount;               // 连通分量数量
+    size_t largestComponentSize;         // 最大连通分量的节点数
+    double connectivity;                 // 多跳可达的节点对占全部节点对的比例 (0-1)
+    double linkRange;                    // 单跳最大连接距离 (km)
+    std::vector<int> componentLabels;    // 各节点所属连通分量编号，范围[0, componentCount)
+};
+
+/**
+ * @brief 中继规划结果结构体
+ *
+ * 候选中继位置为覆盖源、目的节点（并按源-目的距离外扩）的正方形网格，
+ * 格点编号按行主序：index = row * latticeColumns + col，
+ * 坐标为(latticeOriginX + col * latticeSpacing, latticeOriginY + row * latticeSpacing)。
+ */
+struct CommunicationRelayPlan {
+    bool feasible;                       // 是否存在满足连接条件的中继路径
+    std::vector<int> relayIndices;       // 中继格点编号，按源到目的的顺序
+    std::vector<std::pair<double, double>> relayPositions; // 中继坐标 (km)
+    double bottleneckSnr;                // 路径上最弱一跳的信噪比 (dB)
+    double totalDistance;                // 路径总长度 (km)
+    double latticeOriginX;               // 候选网格左下角横坐标 (km)
+    double latticeOriginY;               // 候选网格左下角纵坐标 (km)
+    double latticeSpacing;               // 候选网格间距 (km)
+    int latticeColumns;                  // 候选网格列数
+    int latticeRows;                     // 候选网格行数
+};
+
+/**
+ * @brief 栅格规格结构体
+ *
+ * 将矩形区域[xMin, xMax]×[yMin, yMax]均匀划分为width列、height行，
+ * 每个像元取其中心点的值；第0行对应yMin一侧。
+ */
+struct CommunicationRasterSpec {
+    double xMin;                         // 区域左边界 (km)
+    double xMax;                         // 区域右边界 (km)
+    double yMin;                         // 区域下边界 (km)
+    double yMax;                         // 区域上边界 (km)
+    int width;                           // 列数
+    int height;                          // 行数
+};
+
+/**
+ * @brief 栅格数据结构体
+ *
+ * 以行主序连续存储width×height个float32像元值。
+ */
+struct CommunicationRaster {
+    CommunicationRasterSpec spec;        // 栅格规格
+    std::vector<float> values;           // 行主序像元值
+    
+    float at(int row, int col) const { return values[static_cast<size_t>(row) * spec.width + col]; }
+};
+
+/**
+ * @brief 覆盖等值线结构体
+ *
+ * 分析区域为以发射机为中心的正方形[-extent, extent]²，
+ * 等值线为可用性恰好等于阈值的点连成的折线，闭合折线首尾点相同。
+ */
+struct CommunicationCoverageContour {
+    double threshold;                    // 可用性阈值 (0-1)
+    double snrThreshold;                 // 对应的信噪比阈值 (dB)
+    double extent;                       // 分析区域半宽 (km)
+    double cellSize;                     // 最细网格边长 (km)
+    size_t sampleCount;                  // 实际求值的采样点数
+    std::vector<std::vector<std::pair<double, double>>> polylines; // 等值线折线
+};
+
+/**
+ * @brief 时变信道样本结构体
+ *
+ * 第i个样本对应时刻i * timeStep，阴影衰落为均值0、标准差取当前环境类型
+ * shadowingStdDev的正态随机量 (dB)，信号强度与信噪比均按该损耗下降。
+ */
+struct CommunicationChannelSample {
+    double time;                         // 采样时刻 (s)
+    double shadowingLoss;                // 阴影衰落损耗 (dB)
+    CommunicationLinkMetrics metrics;    // 链路数值指标
+};
+
+/**
+ * @brief 时变信道样本回调
+ *
+ * 样本按时间顺序分块交付，samples仅在回调期间有效；返回false时停止仿真。
+ */
+using CommunicationChannelSampleCallback =
+    std::function<bool(const CommunicationChannelSample* samples, size_t count)>;
+
+/**
+ * @brief 移动场景样本结构体
+ *
+ * 第i个样本对应第i个航迹点与时刻i * timeStep；发射机位于原点，干扰机位于(jammerDistance, 0)。
+ */
+struct CommunicationMobilitySample {
+    double time;                         // 采样时刻 (s)
+    double distance;                     // 收发距离 (km)，不小于MIN_DISTANCE_LIMIT
+    CommunicationLinkMetrics metrics;    // 链路数值指标
+};
+
+/**
+ * @brief 移动场景样本回调
+ *
+ * 样本按航迹顺序分块交付，samples仅在回调期间有效；返回false时停止仿真。
+ */
+using CommunicationMobilitySampleCallback =
+    std::function<bool(const CommunicationMobilitySample* samples, size_t count)>;
+
+/**
+ * @brief 监控状态记录结构体
+ *
+ * 实时监控的历史记录，定长且可按字节复制，便于在环形缓冲区中无锁存取。
+ */
+struct CommunicationStatusRecord {
+    double timestamp;                    // 采样时刻，自首次启动监控起的秒数 (s)
+    CommunicationLinkMetrics metrics;    // 链路数值指标
+};
+
+/**
+ * @brief 蒙特卡洛可用性分析配置结构体
+ *
+ * 每次试验在当前链路预算上独立抽取随机损耗：阴影衰落为均值0、标准差取当前环境类型
+ * shadowingStdDev的正态量 (dB)，瑞利衰落的功率增益服从均值为1的指数分布；
+ * 存在干扰时另对干扰功率 (dB) 与干扰距离 (km) 施加正态扰动，标准差为0表示不扰动。
+ */
+struct CommunicationMonteCarloConfig {
+    uint64_t trialCount;                 // 试验次数
+    bool shadowing;                      // 是否计入阴影衰落
+    bool rayleighFading;                 // 是否计入瑞利衰落
+    double jammerPowerStdDev;            // 干扰功率扰动标准差 (dB)
+    double jammerDistanceStdDev;         // 干扰距离扰动标准差 (km)
+    double confidence;                   // 置信区间的置信度 (0-1)
+};
+
+/**
+ * @brief 蒙特卡洛可用性分析结果结构体
+ *
+ * 各项指标以单遍累加器给出均值、方差、极值与置信区间；
+ * outage为中断指示量（链路不满足连接条件时为1），其均值即中断概率；
+ * 信噪比与吞吐量另以分位数草图给出分布，可查询如5%信噪比等百分位数而无需保存全部样本。
+ */
+struct CommunicationMonteCarloResult {
+    uint64_t trialCount;                           // 试验次数
+    double confidence;                             // 置信度 (0-1)
+    CommunicationRunningStatistics snr;            // 信噪比 (dB)
+    CommunicationRunningStatistics availability;   // 可用性 (0-1)
+    CommunicationRunningStatistics throughput;     // 吞吐量 (Mbps)
+    CommunicationRunningStatistics outage;         // 中断指示量
+    CommunicationQuantileSketch snrDistribution;          // 信噪比分布 (dB)
+    CommunicationQuantileSketch throughputDistribution;   // 吞吐量分布 (Mbps)
+    
+    double getOutageProbability() const { return outage.getMean(); }
+};
+
+/**
+ * @brief 时变信道仿真进度结构体
+ *
+ * 第i个样本只由(seed, i)决定，进度只需记录已交付的样本数；
+ * completedSamples为0时由API填入当前种子并从头开始。
+ */
+struct CommunicationChannelProgress {
+    double duration;                     // 仿真时长 (s)
+    double timeStep;                     // 时间步长 (s)
+    uint64_t seed;                       // 随机数种子
+    uint64_t completedSamples;           // 已交付的样本数，即续跑的首个样本下标
+};
+
+/**
+ * @brief 蒙特卡洛分析进度结构体
+ *
+ * 记录已完成的试验数与截至目前的累加器，分段执行时每段从分块边界开始，
+ * 各段依次累加的结果与一次执行全部试验逐位一致。completedTrials为0时由API填入当前种子并清空结果。
+ */
+struct CommunicationMonteCarloProgress {
+    CommunicationMonteCarloConfig config;    // 分析配置，trialCount为总试验次数
+    uint64_t seed;                           // 随机数种子
+    uint64_t completedTrials;                // 已完成的试验数，即续跑的首个试验序号
+    CommunicationMonteCarloResult result;    // 已完成试验的统计结果
+    
+    bool isComplete() const { return completedTrials >= config.trialCount; }
+};
+
+/**
+ * @brief 时间结构干扰源参数结构体
+ *
+ * PULSE类型在每个脉冲周期的前pulseWidth内发射，SWEEP_FREQUENCY类型以瞬时带宽bandwidth
+ * 在[frequency - sweepRange/2, frequency + sweepRange/2]内按锯齿波匀速扫频，
+ * 其余类型视为持续发射；干扰频带与信道频带重叠且处于发射状态时信道受干扰。
+ */
+struct CommunicationTimingJammer {
+    JammerType type;                     // 干扰类型
+    double frequency;                    // 中心频率 (MHz)，扫频干扰为扫频范围的中心
+    double bandwidth;                    // 瞬时干扰带宽 (MHz)
+    double pulseWidth;                   // 脉冲宽度 (ms)
+    double pulseRepetitionRate;          // 脉冲重复频率 (Hz)
+    double sweepRate;                    // 扫频速率 (MHz/s)
+    double sweepRange;                   // 扫频范围 (MHz)
+    double startOffset;                  // 首个脉冲或扫频周期的起始时刻 (ms)
+};
+
+/**
+ * @brief 干扰时序仿真配置结构体
+ *
+ * 数据包从0时刻起每隔packetInterval发送一次，占用当前环境的工作频率与带宽。
+ */
+struct CommunicationTimingConfig {
+    double duration;                     // 仿真时长 (s)
+    double packetDuration;               // 数据包持续时间 (ms)
+    double packetInterval;               // 数据包发送间隔 (ms)，不小于持续时间
+    double corruptionThreshold;          // 受干扰时间比例超过该值的数据包判为损坏 (0-1)
+    std::vector<CommunicationTimingJammer> jammers; // 干扰源，为空时取当前干扰环境与干扰模型
+};
+
+/**
+ * @brief 干扰时序仿真结果结构体
+ */
+struct CommunicationTimingResult {
+    uint64_t eventCount;                 // 处理的事件数
+    uint64_t packetCount;                // 在仿真时长内发送完毕的数据包数
+    uint64_t corruptedPacketCount;       // 损坏的数据包数
+    double jammedTimeFraction;           // 信道受干扰时间占仿真时长的比例
+    double meanPacketOverlap;            // 数据包受干扰时间比例的平均值
+    
+    double getPacketErrorRate() const {
+        return packetCount > 0 ? static_cast<double>(corruptedPacketCount) / static_cast<double>(packetCount) : 0.0;
+    }
+};
+
+/**
+ * @brief 跳频碰撞仿真配置结构体
+ *
+ * 跳频信道数、信道间隔、跳频速率与驻留时间取自抗干扰模型，跳频频带以当前工作频率为中心；
+ * 各跳频网的跳频图案相互独立，数据包由连续hopsPerPacket跳组成。
+ */
+struct CommunicationHoppingConfig {
+    uint64_t hopCount;                   // 每个跳频网仿真的跳数
+    int netCount;                        // 跳频网数量
+    int hopsPerPacket;                   // 每个数据包占用的跳数 (1-64)
+    int toleratedHits;                   // 数据包可容忍的受干扰跳数（纠错能力）
+    std::vector<CommunicationTimingJammer> jammers; // 干扰源，为空时取当前干扰环境与干扰模型
+};
+
+/**
+ * @brief 跳频碰撞仿真结果结构体
+ */
+struct CommunicationHoppingResult {
+    uint64_t hopCount;                   // 全部跳频网的总跳数
+    uint64_t hitCount;                   // 驻留期间所在信道受干扰的跳数
+    uint64_t packetCount;                // 完整数据包数
+    uint64_t lostPacketCount;            // 受干扰跳数超过容限的数据包数
+    double jammedChannelFraction;        // 各跳驻留期间受干扰信道占全部信道比例的平均值
+    std::vector<double> netHitRates;     // 各跳频网的命中率
+    
+    double getHitRate() const {
+        return hopCount > 0 ? static_cast<double>(hitCount) / static_cast<double>(hopCount) : 0.0;
+    }
+    double getPacketLossRate() const {
+        return packetCount > 0 ? static_cast<double>(lostPacketCount) / static_cast<double>(packetCount) : 0.0;
+    }
+};
+
+/**
+ * @brief 多干扰机聚合中的单个干扰源
+ *
+ * 干扰功率在干扰带宽内均匀分布，按自由空间传播到达接收点。
+ */
+struct CommunicationJammerEmitter {
+    double x;                            // 横坐标 (km)
+    double y;                            // 纵坐标 (km)
+    double frequency;                    // 中心频率 (MHz)
+    double bandwidth;                    // 干扰带宽 (MHz)
+    double power;                        // 发射功率 (dBm)
+};
+
+/**
+ * @brief 接收点的多干扰机聚合结果结构体
+ */
+struct CommunicationAggregateInterference {
+    double signalStrength;               // 接收信号强度 (dBm)
+    double interferencePower;            // 落入接收带宽的干扰总功率 (dBm)，无干扰时为负无穷
+    double jammerToSignalRatio;          // 干信比 (dB)
+    double signalToInterferenceNoiseRatio; // 信干噪比 (dB)
+    uint32_t activeJammerCount;          // 频带与接收带宽重叠的干扰源数
+};
+
+/**
+ * @brief 干扰覆盖剖面结构体
+ *
+ * distances严格递增并与effectiveness一一对应，相邻采样点之间线性插值的误差不超过给定容差。
+ * coverageRadii[i]为干扰有效性不低于levels[i]的最远距离：起始距离处已低于门限时为0，
+ * 直到终止距离仍不低于门限时为终止距离。
+ */
+struct CommunicationJammerCoverageProfile {
+    std::vector<double> distances;       // 采样距离 (km)
+    std::vector<double> effectiveness;   // 各采样距离处的干扰有效性
+    std::vector<double> levels;          // 干扰有效性门限
+    std::vector<double> coverageRadii;   // 各门限对应的覆盖半径 (km)
+    double saturationDistance;           // 功率因子饱和的最远距离 (km)，有效性与距离无关时为0
+};
+
+/**
+ * @brief 干扰分配中的干扰机
+ *
+ * 其余干扰参数（占空比、扫频范围等）取当前干扰模型；频率与带宽按干扰环境的方式写入干扰模型。
+ */
+struct CommunicationAssignmentJammer {
+    double x;                            // 横坐标 (km)
+    double y;                            // 纵坐标 (km)
+    JammerType type;                     // 干扰类型
+    double power;                        // 发射功率 (dBm)
+    double frequency;                    // 中心频率 (MHz)
+    double bandwidth;                    // 干扰带宽 (MHz)
+};
+
+/**
+ * @brief 干扰分配中的目标通信网
+ */
+struct CommunicationAssignmentTarget {
+    double x;                            // 横坐标 (km)
+    double y;                            // 纵坐标 (km)
+    double frequency;                    // 工作频率 (MHz)
+    double bandwidth;                    // 信号带宽 (MHz)
+    double power;                        // 信号功率 (dBm)
+};
+
+/**
+ * @brief 干扰分配方式
+ */
+enum class JammerAssignmentMode {
+    ONE_TO_ONE,                // 每台干扰机至多干扰一个目标、每个目标至多一台干扰机，总有效性最大（匈牙利算法）
+    POWER_BUDGET               // 多对多，受总功率预算与单机目标数限制，按单位功率的边际收益贪心分配
+};
+
+/**
+ * @brief 干扰分配配置结构体
+ *
+ * POWER_BUDGET方式下干扰机每干扰一个目标消耗其发射功率，
+ * 同一目标受多台干扰机干扰时综合有效性为 1 - Π(1 - 有效性)。
+ */
+struct CommunicationAssignmentConfig {
+    JammerAssignmentMode mode;           // 分配方式
+    double powerBudget;                  // 总功率预算 (W)，POWER_BUDGET方式使用
+    int maxTargetsPerJammer;             // 单台干扰机最多同时干扰的目标数，POWER_BUDGET方式使用
+};
+
+/**
+ * @brief 干扰分配结果结构体
+ *
+ * effectiveness以行主序存储jammerCount×targetCount的干扰有效性矩阵，
+ * 第j行第t列为干扰机j对目标t的干扰有效性 (0-1)。
+ */
+struct CommunicationAssignmentResult {
+    size_t jammerCount;                  // 干扰机数量
+    size_t targetCount;                  // 目标数量
+    std::vector<double> effectiveness;   // 行主序干扰有效性矩阵
+    std::vector<std::pair<size_t, size_t>> assignments; // 分配的(干扰机序号, 目标序号)，按干扰机序号升序
+    std::vector<double> targetEffectiveness; // 各目标受到的综合干扰有效性
+    double totalEffectiveness;           // 各目标综合干扰有效性之和
+    double usedPower;                    // 分配消耗的功率 (W)
+
+    double at(size_t jammer, size_t target) const { return effectiveness[jammer * targetCount + target]; }
+};
+
+/**
+ * @brief 频段结构体
+ *
+ * 频段为[frequency - bandwidth/2, frequency + bandwidth/2]。
+ */
+struct CommunicationFrequencyBand {
+    double frequency;                    // 中心频率 (MHz)
+    double bandwidth;                    // 带宽 (MHz)
+};
+
+/**
+ * @brief 干扰频段与信道频段的重叠结果结构体
+ *
+ * 重叠比例的定义与CommunicationJammerModel::calculateFrequencyOverlap()相同，为重叠带宽占信道带宽的比例。
+ */
+struct CommunicationBandOverlap {
+    size_t jammerIndex;                  // 干扰频段序号
+    size_t channelIndex;                 // 信道序号
+    double overlapBandwidth;             // 重叠带宽 (MHz)
+    double overlapFraction;              // 重叠比例 (0-1]
 };
 
 /**
@@ -116,21 +581,39 @@ private:
     CommunicationEnvironment environment_;
     JammingEnvironment jammingEnv_;
     
-    // 缓存的计算结果
-    mutable bool resultsValid_;
-    mutable CommunicationLinkStatus cachedLinkStatus_;
-    mutable CommunicationPerformance cachedPerformance_;
+    // 当前配置的不可变求值快照：setter修改参数后整体替换，const查询只从快照读取配置，
+    // 因此同一实例可被多个线程并发查询
+    struct EvaluationSnapshot;
+    mutable std::shared_ptr<const EvaluationSnapshot> snapshot_;
+    
+    // 快照重建的互斥锁与失效标志（子模型经get*Model()交出可写指针后快照失效）
+    struct SnapshotSync;
+    std::unique_ptr<SnapshotSync> snapshotSync_;
+    
+    // 是否在链路状态中生成状态描述（查询读取快照中的副本）
+    bool statusDescriptionEnabled_;
+    
+    // 并行计算线程数（0表示使用硬件线程数，查询读取快照中的副本）
+    int threadCount_;
+    
+    // 随机数主种子
+    uint64_t randomSeed_;
+    
+    // 实时监控器（首次启动监控时创建）
+    std::unique_ptr<CommunicationStatusMonitor> monitor_;
+    
+    // 由监控历史增量更新的链路预测状态（与监控器一同创建）
+    struct PredictionState;
+    std::unique_ptr<PredictionState> prediction_;
     
     // 内部计算方法
-    void invalidateCache();
+    void rebuildSnapshot();
+    void publishSnapshot() const;
+    void invalidateSnapshot() const;
+    static std::function<CommunicationLinkMetrics()> makeMonitorSampler(
+        std::shared_ptr<const EvaluationSnapshot> snapshot);
+    std::shared_ptr<const EvaluationSnapshot> loadSnapshot() const;
     void updateModelsFromEnvironment();
-    double calculateOverallSignalStrength() const;
-    double calculateOverallSNR() const;
-    double calculateOverallBER() const;
-    double calculateThroughput() const;
-    double calculateLatency() const;
-    double calculatePacketLossRate() const;
-    CommunicationQuality assessCommunicationQuality() const;
     
 public:
     // 构造函数和析构函数
@@ -142,13 +625,13 @@ public:
     CommunicationModelAPI(const CommunicationModelAPI&) = delete;
     CommunicationModelAPI& operator=(const CommunicationModelAPI&) = delete;
     
-    // 移动构造和赋值
-    CommunicationModelAPI(CommunicationModelAPI&&) = default;
-    CommunicationModelAPI& operator=(CommunicationModelAPI&&) = default;
+    // 移动构造和赋值（在源文件中定义，监控器类型在此处不完整）
+    CommunicationModelAPI(CommunicationModelAPI&&);
+    CommunicationModelAPI& operator=(CommunicationModelAPI&&);
     
     // 场景设置
     bool setScenario(CommunicationScenario scenario);
-    CommunicationScenario getScenario() const { return currentScenario_; }
+    CommunicationScenario getScenario() const;
     
     // 环境参数设置
     bool setEnvironment(const CommunicationEnvironment& env);
@@ -159,9 +642,16 @@ public:
     bool setDistance(double distance);
     bool setEnvironmentType(EnvironmentType type);
     
+    // 子模型设置（整体替换并重建求值快照）
+    bool setSignalModel(const SignalTransmissionModel& model);
+    bool setDistanceModel(const CommunicationDistanceModel& model);
+    bool setReceiveModel(const CommunicationReceiveModel& model);
+    bool setJammerModel(const CommunicationJammerModel& model);
+    bool setAntiJamModel(const CommunicationAntiJamModel& model);
+    
     // 环境参数获取
-    CommunicationEnvironment getEnvironment() const { return environment_; }
-    JammingEnvironment getJammingEnvironment() const { return jammingEnv_; }
+    CommunicationEnvironment getEnvironment() const;
+    JammingEnvironment getJammingEnvironment() const;
     
     // 核心计算接口
     CommunicationLinkStatus calculateLinkStatus() const;
@@ -170,13 +660,50 @@ public:
     double calculateRequiredPower(double targetRange) const;
     double calculateOptimalFrequency() const;
     double calculateOptimalBandwidth() const;
+
+    // 批量计算接口（不修改API状态，场景与干扰环境取当前设置）
+    bool calculateLinkStatusBatch(const CommunicationEnvironment* environments, size_t count,
+                                  CommunicationLinkStatus* results) const;
+    bool calculateLinkStatusBatch(const CommunicationEnvironmentArrays& environments,
+                                  CommunicationLinkStatus* results) const;
+    std::vector<CommunicationLinkStatus> calculateLinkStatusBatch(
+        const std::vector<CommunicationEnvironment>& environments) const;
+    
+    // 数值指标接口（不生成状态描述，批量计算不分配内存）
+    CommunicationLinkMetrics calculateLinkMetrics() const;
+    bool calculateLinkMetricsBatch(const CommunicationEnvironment* environments, size_t count,
+                                   CommunicationLinkMetrics* results) const;
+    bool calculateLinkMetricsBatch(const CommunicationEnvironmentArrays& environments,
+                                   CommunicationLinkMetrics* results) const;
     
+    // 状态描述设置（关闭后链路状态的statusDescription为空，可按需调用describe*生成）
+    void enableStatusDescription(bool enable = true);
+    bool isStatusDescriptionEnabled() const;
+    static std::string describeLinkStatus(const CommunicationLinkStatus& status);
+    static std::string describeLinkMetrics(const CommunicationLinkMetrics& metrics);
+
     // 干扰分析接口
     double calculateJammerEffectiveness() const;
     double calculateAntiJamEffectiveness() const;
     double calculateJammerToSignalRatio() const;
     double calculateRequiredAntiJamGain(double targetBER) const;
     std::vector<double> calculateJammerCoverage() const;
+    bool calculateJammerCoverageProfile(double minDistance, double maxDistance, const std::vector<double>& levels,
+                                        CommunicationJammerCoverageProfile& profile, double tolerance = 0.001) const;
+    bool assignJammers(const std::vector<CommunicationAssignmentJammer>& jammers,
+                       const std::vector<CommunicationAssignmentTarget>& targets,
+                       const CommunicationAssignmentConfig& config, CommunicationAssignmentResult& result) const;
+    bool calculateBandOverlaps(const std::vector<CommunicationFrequencyBand>& jammers,
+                               const std::vector<CommunicationFrequencyBand>& channels,
+                               std::vector<CommunicationBandOverlap>& overlaps) const;
+
+    // 多干扰机聚合接口（发射机位于原点，坐标单位为km）
+    std::vector<CommunicationJammerEmitter> getJammerEmitters() const;
+    bool calculateAggregateInterference(const std::vector<CommunicationJammerEmitter>& jammers,
+                                        const std::vector<std::pair<double, double>>& receivers,
+                                        std::vector<CommunicationAggregateInterference>& results) const;
+    bool calculateAggregateInterference(const std::vector<std::pair<double, double>>& receivers,
+                                        std::vector<CommunicationAggregateInterference>& results) const;
     
     // 性能优化接口
     CommunicationEnvironment optimizeForRange(double targetRange) const;
@@ -193,31 +720,53 @@ public:
         double startPower, double endPower, double step) const;
     std::map<double, CommunicationLinkStatus> analyzeDistanceRange(
         double startDistance, double endDistance, double step) const;
+    CommunicationSweepResult analyzeParameterSweep(
+        SweepParameter parameter, double start, double end, double step) const;
     
-    // 网络拓扑分析
+    // 网络拓扑分析（节点坐标单位为km，链路参数取当前环境）
     std::vector<std::vector<double>> calculateLinkMatrix(
         const std::vector<std::pair<double, double>>& nodePositions) const;
+    bool calculateLinkMatrix(const std::vector<std::pair<double, double>>& nodePositions,
+                             CommunicationLinkMatrix& matrix) const;
     std::vector<int> findOptimalRelayPositions(
         const std::pair<double, double>& source,
         const std::pair<double, double>& destination,
         int maxRelays) const;
+    bool planRelayPath(const std::pair<double, double>& source,
+                       const std::pair<double, double>& destination,
+                       int maxRelays, CommunicationRelayPlan& plan) const;
     double calculateNetworkConnectivity(
         const std::vector<std::pair<double, double>>& nodePositions) const;
+    bool analyzeNetworkConnectivity(const std::vector<std::pair<double, double>>& nodePositions,
+                                    CommunicationNetworkConnectivity& result) const;
     
-    // 实时监控接口
+    // 实时监控接口（后台线程周期采样，历史记录保存在定长环形缓冲区中）
     bool startRealTimeMonitoring();
+    bool startRealTimeMonitoring(int intervalMs);
     bool stopRealTimeMonitoring();
     bool isMonitoring() const;
     CommunicationLinkStatus getCurrentStatus() const;
     std::vector<CommunicationLinkStatus> getStatusHistory(int count = 100) const;
+    size_t getStatusHistory(CommunicationStatusRecord* records, size_t count) const;
     
     // 预测和仿真
     CommunicationLinkStatus predictFutureStatus(double timeSeconds) const;
     std::vector<CommunicationLinkStatus> simulateTimeVaryingChannel(
         double duration, double timeStep) const;
+    bool simulateTimeVaryingChannel(double duration, double timeStep,
+                                    const CommunicationChannelSampleCallback& callback) const;
+    bool simulateTimeVaryingChannel(CommunicationChannelProgress& progress,
+                                    const CommunicationChannelSampleCallback& callback) const;
     std::vector<CommunicationLinkStatus> simulateMobilityScenario(
         const std::vector<std::pair<double, double>>& trajectory,
         double timeStep) const;
+    bool simulateMobilityScenario(const std::pair<double, double>* trajectory, size_t count, double timeStep,
+                                  const CommunicationMobilitySampleCallback& callback) const;
+    bool analyzeAvailabilityMonteCarlo(const CommunicationMonteCarloConfig& config,
+                                       CommunicationMonteCarloResult& result) const;
+    bool analyzeAvailabilityMonteCarlo(CommunicationMonteCarloProgress& progress, uint64_t maxTrials) const;
+    bool simulateJammerTiming(const CommunicationTimingConfig& config, CommunicationTimingResult& result) const;
+    bool simulateFrequencyHopping(const CommunicationHoppingConfig& config, CommunicationHoppingResult& result) const;
     
     // 配置管理
     bool saveConfiguration(const std::string& filename) const;
@@ -225,6 +774,20 @@ public:
     std::string exportConfigurationToJSON() const;
     bool importConfigurationFromJSON(const std::string& jsonStr);
     
+    // 检查点
+    bool saveCheckpoint(std::vector<uint8_t>& buffer,
+                        const CommunicationChannelProgress* channelProgress = nullptr,
+                        const CommunicationMonteCarloProgress* monteCarloProgress = nullptr) const;
+    bool loadCheckpoint(const uint8_t* data, size_t size,
+                        CommunicationChannelProgress* channelProgress = nullptr,
+                        CommunicationMonteCarloProgress* monteCarloProgress = nullptr);
+    bool saveCheckpointToFile(const std::string& filename,
+                              const CommunicationChannelProgress* channelProgress = nullptr,
+                              const CommunicationMonteCarloProgress* monteCarloProgress = nullptr) const;
+    bool loadCheckpointFromFile(const std::string& filename,
+                                CommunicationChannelProgress* channelProgress = nullptr,
+                                CommunicationMonteCarloProgress* monteCarloProgress = nullptr);
+    
     // 报告生成
     std::string generateDetailedReport() const;
     std::string generatePerformanceReport() const;
@@ -232,13 +795,20 @@ public:
     std::string generateOptimizationReport() const;
     std::string generateComparisonReport(const CommunicationModelAPI& other) const;
     
-    // 可视化数据接口
+    // 可视化数据接口（发射机位于原点，干扰机位于(jammerDistance, 0)，坐标单位为km）
     std::vector<std::pair<double, double>> getCoverageContour(double threshold = 0.9) const;
+    bool analyzeCoverageContour(double threshold, int maxDepth, CommunicationCoverageContour& contour) const;
     std::vector<std::pair<double, double>> getSignalStrengthMap(
         double xMin, double xMax, double yMin, double yMax, int resolution = 50) const;
     std::vector<std::pair<double, double>> getInterferenceMap(
         double xMin, double xMax, double yMin, double yMax, int resolution = 50) const;
     
+    // 栅格接口：接收信号强度 (dBm) 与干信比 (dB) 的float32稠密栅格，*ToFile版本经内存映射直接写入文件
+    bool renderSignalStrengthRaster(const CommunicationRasterSpec& spec, CommunicationRaster& raster) const;
+    bool renderInterferenceRaster(const CommunicationRasterSpec& spec, CommunicationRaster& raster) const;
+    bool renderSignalStrengthRasterToFile(const CommunicationRasterSpec& spec, const std::string& filename) const;
+    bool renderInterferenceRasterToFile(const CommunicationRasterSpec& spec, const std::string& filename) const;
+    
     // 校准和验证
     bool calibrateWithMeasurements(const std::vector<std::pair<CommunicationEnvironment, 
                                                               CommunicationLinkStatus>>& measurements);
@@ -270,18 +840,22 @@ public:
     bool isGPUAccelerationEnabled() const;
     void setThreadCount(int count);
     int getThreadCount() const;
+    void setRandomSeed(uint64_t seed);
+    uint64_t getRandomSeed() const;
+    CommunicationRandomStream createRandomStream(uint64_t index) const;
     
     // 插件和扩展接口
     bool loadPlugin(const std::string& pluginPath);
     std::vector<std::string> getLoadedPlugins() const;
     bool unloadPlugin(const std::string& pluginName);
     
-    // 获取底层模型的直接访问（高级用户）
-    SignalTransmissionModel* getSignalModel() const { return signalModel_.get(); }
-    CommunicationDistanceModel* getDistanceModel() const { return distanceModel_.get(); }
-    CommunicationReceiveModel* getReceiveModel() const { return receiveModel_.get(); }
-    CommunicationJammerModel* getJammerModel() const { return jammerModel_.get(); }
-    CommunicationAntiJamModel* getAntiJamModel() const { return antiJamModel_.get(); }
+    // 获取底层模型的直接访问（高级用户）；经返回指针所做的修改在下一次查询时重建求值快照后生效，
+    // 查询之后继续修改须重新调用get*Model()，且修改不得与查询并发
+    SignalTransmissionModel* getSignalModel() const;
+    CommunicationDistanceModel* getDistanceModel() const;
+    CommunicationReceiveModel* getReceiveModel() const;
+    CommunicationJammerModel* getJammerModel() const;
+    CommunicationAntiJamModel* getAntiJamModel() const;
 };
 
 // 引入工具类
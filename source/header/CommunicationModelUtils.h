@@ -140,6 +140,26 @@ namespace CommunicationModelUtils {
      */
     double calculatePercentile(const std::vector<double>& values, double percentile);
     
+    /**
+     * @brief 一次计算多个百分位数
+     * @details 只复制一次样本，按秩递增依次部分排序，代价约为O(n)而非每个百分位数O(n log n)
+     * @param values 数值向量
+     * @param percentiles 百分位数数组 (0-100)，无需有序
+     * @return 与percentiles一一对应的百分位数值
+     */
+    std::vector<double> calculatePercentiles(const std::vector<double>& values, const std::vector<double>& percentiles);
+    
+    /**
+     * @brief 就地计算多个百分位数（不复制样本）
+     * @details 基于std::nth_element，调用后values的元素顺序被打乱
+     * @param values 数值向量
+     * @param percentiles 百分位数数组 (0-100)，超出范围的取值截断到[0, 100]，NaN对应的结果为NaN
+     * @param count 百分位数个数
+     * @param results 输出数组，与percentiles一一对应
+     */
+    void calculatePercentilesInPlace(std::vector<double>& values, const double* percentiles, size_t count,
+                                     double* results);
+    
     /**
      * @brief 计算置信区间
      * @param values 数值向量
@@ -148,6 +168,14 @@ namespace CommunicationModelUtils {
      */
     std::pair<double, double> calculateConfidenceInterval(const std::vector<double>& values, double confidence);
     
+    /**
+     * @brief 计算置信区间的临界值（正态近似）
+     * @details 按档位取值，置信度须严格大于0.90/0.95/0.99才取对应档位的临界值
+     * @param confidence 置信度 (0-1)
+     * @return 临界值，区间半宽 = 临界值 * 标准差 / sqrt(样本数)
+     */
+    double calculateConfidenceCriticalValue(double confidence);
+    
     // ==================== 兼容性函数 ====================
     
     /**
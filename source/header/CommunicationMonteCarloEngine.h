@@ -0,0 +1,82 @@
+#ifndef COMMUNICATION_MONTE_CARLO_ENGINE_H
+#define COMMUNICATION_MONTE_CARLO_ENGINE_H
+
+#include "CommunicationLinkEvaluator.h"
+#include "CommunicationRandomStream.h"
+#include <cstdint>
+
+/**
+ * @brief 蒙特卡洛链路可用性分析引擎
+ *
+ * 在评估器基准环境的链路预算上逐次抽取阴影衰落、瑞利衰落与干扰参数扰动，
+ * 求每次试验的信噪比、可用性、吞吐量与是否中断，并以单遍累加器汇总，不保存样本。
+ * 第i次试验的各随机量分别取自独立子流的第i个随机数，与分块和线程数无关。
+ */
+class CommunicationMonteCarloEngine {
+private:
+    CommunicationRandomStream shadowingStream_;
+    CommunicationRandomStream fadingStream_;
+    CommunicationRandomStream jammerPowerStream_;
+    CommunicationRandomStream jammerDistanceStream_;
+    double baseSignalStrength_;          // 基准信号强度 (dBm)
+    double baseSnr_;                     // 基准信噪比 (dB)
+    double bandwidth_;                   // 系统带宽 (MHz)
+    double distance_;                    // 通信距离 (km)
+    double shadowingStdDev_;             // 阴影衰落标准差 (dB)
+    double jammerDistance_;              // 干扰距离 (km)
+    bool jammed_;
+    int threadCount_;
+
+    /**
+     * @brief 单个分块的统计量
+     */
+    struct BlockStatistics;
+
+    void runBlock(const CommunicationMonteCarloConfig& config, uint64_t first, uint64_t count,
+                  BlockStatistics& statistics) const;
+
+public:
+    /**
+     * @brief 构造蒙特卡洛分析引擎
+     * @param evaluator 链路评估器，取其基准环境的链路预算
+     * @param seed 随机数种子
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     */
+    CommunicationMonteCarloEngine(const CommunicationLinkEvaluator& evaluator, uint64_t seed, int threadCount);
+
+    /**
+     * @brief 检查分析配置是否有效
+     */
+    static bool isConfigValid(const CommunicationMonteCarloConfig& config);
+
+    /**
+     * @brief 计算第index次试验的链路状态
+     * @param config 分析配置
+     * @param index 试验序号
+     * @return 链路状态（不含状态描述）
+     */
+    CommunicationLinkStatus evaluateTrial(const CommunicationMonteCarloConfig& config, uint64_t index) const;
+
+    /**
+     * @brief 执行蒙特卡洛分析
+     * @details 试验按MONTE_CARLO_BLOCK_SIZE分块，每批若干块由工作线程并行累加，
+     *          调用线程再按块序号顺序合并，因此相同种子下结果与线程数无关且逐位一致
+     * @param config 分析配置
+     * @param result 输出的统计结果
+     * @return 配置有效返回true
+     */
+    bool run(const CommunicationMonteCarloConfig& config, CommunicationMonteCarloResult& result) const;
+
+    /**
+     * @brief 继续执行分段的蒙特卡洛分析
+     * @details 从progress.completedTrials起再执行至少maxTrials次试验（向上取整到整块，不超过总次数），
+     *          累加到progress.result并推进completedTrials；completedTrials为0时先清空结果。
+     *          各段起点均位于分块边界，分段执行的结果与run一次执行逐位一致
+     * @param progress 分析进度，引擎的种子应与progress.seed一致
+     * @param maxTrials 本段最少执行的试验次数，大于0
+     * @return 配置有效、进度位于分块边界且未超过总次数返回true
+     */
+    bool resume(CommunicationMonteCarloProgress& progress, uint64_t maxTrials) const;
+};
+
+#endif // COMMUNICATION_MONTE_CARLO_ENGINE_H
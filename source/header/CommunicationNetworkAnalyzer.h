@@ -0,0 +1,71 @@
+#ifndef COMMUNICATION_NETWORK_ANALYZER_H
+#define COMMUNICATION_NETWORK_ANALYZER_H
+
+#include "CommunicationLinkEvaluator.h"
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief 网络拓扑分析器
+ *
+ * 基于链路评估器的快照，对平面上一组节点之间的链路批量求值。
+ * 节点之间除距离外共享同一组通信参数，因此任意两节点间的信噪比
+ * 只取决于距离，可由链路预算的距离系数直接求出。
+ */
+class CommunicationNetworkAnalyzer {
+private:
+    LinkBudgetCoefficients coefficients_;
+    double coincidentSnr_;           // 节点重合（距离为0）时的信噪比 (dB)
+    double linkRange_;               // 单跳最大连接距离 (km)
+    int threadCount_;
+
+public:
+    /**
+     * @brief 构造网络拓扑分析器
+     * @param evaluator 链路评估器，取其基准环境作为所有链路的通信参数
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     */
+    CommunicationNetworkAnalyzer(const CommunicationLinkEvaluator& evaluator, int threadCount);
+
+    /**
+     * @brief 计算节点间链路信噪比矩阵
+     * @details 按分块只计算上三角并镜像写入下三角，各分块由工作线程并行处理
+     * @param nodePositions 节点坐标数组 (km)
+     * @param count 节点数量
+     * @param output 行主序输出缓冲区，长度不小于count*count，对角线为0
+     */
+    void calculateLinkMatrix(const std::pair<double, double>* nodePositions, size_t count, float* output) const;
+
+    /**
+     * @brief 分析网络连通性
+     * @details 以单跳最大连接距离R为尺度建立均匀网格（格边长R/√2），
+     *          同一格内的节点两两相连，只需在相邻格之间检查候选节点对，
+     *          并用并查集合并连通分量；两格已属同一分量时跳过其间的全部节点对。
+     *          距离为0的节点按距离趋于0的极限处理，即R大于0时视为相连
+     * @param nodePositions 节点坐标数组 (km)
+     * @param count 节点数量
+     * @param result 输出的连通性分析结果
+     */
+    void analyzeConnectivity(const std::pair<double, double>* nodePositions, size_t count,
+                             CommunicationNetworkConnectivity& result) const;
+
+    /**
+     * @brief 计算满足连接条件的最小信噪比
+     * @param bandwidth 系统带宽 (MHz)
+     * @return 最小连接信噪比 (dB)，无论信噪比多高都不满足时返回正无穷
+     */
+    static double calculateMinimumConnectedSnr(double bandwidth);
+
+    /**
+     * @brief 计算指定距离的链路信噪比
+     * @param distance 距离 (km)
+     * @return 信噪比 (dB)
+     */
+    double calculateSnrAtDistance(double distance) const;
+
+    // 参数获取
+    const LinkBudgetCoefficients& getCoefficients() const { return coefficients_; }
+    double getLinkRange() const { return linkRange_; }
+};
+
+#endif // COMMUNICATION_NETWORK_ANALYZER_H
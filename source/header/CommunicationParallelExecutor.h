@@ -0,0 +1,48 @@
+#ifndef COMMUNICATION_PARALLEL_EXECUTOR_H
+#define COMMUNICATION_PARALLEL_EXECUTOR_H
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * @brief 并行执行工具类
+ *
+ * 将[0, count)区间划分为连续子区间，交由多个工作线程执行。
+ * 每个工作线程获得固定的线程序号，调用方可据此维护线程私有状态；
+ * 任一工作线程抛出的异常会在所有线程结束后于调用线程重新抛出。
+ */
+class CommunicationParallelExecutor {
+public:
+    /**
+     * @brief 区间任务函数
+     * @param begin 子区间起始下标（包含）
+     * @param end 子区间结束下标（不包含）
+     * @param threadIndex 工作线程序号，范围[0, 实际线程数)
+     */
+    using RangeTask = std::function<void(size_t begin, size_t end, int threadIndex)>;
+
+    /**
+     * @brief 获取硬件并发线程数
+     * @return 硬件线程数，无法获取时返回1
+     */
+    static int getHardwareThreadCount();
+
+    /**
+     * @brief 计算实际使用的线程数
+     * @param requestedThreads 请求的线程数，小于等于0表示使用硬件线程数
+     * @param workItems 任务数量
+     * @param minItemsPerThread 每个线程的最少任务数，任务过少时减少线程数
+     * @return 实际线程数，至少为1
+     */
+    static int resolveThreadCount(int requestedThreads, size_t workItems, size_t minItemsPerThread = 1);
+
+    /**
+     * @brief 并行执行区间任务
+     * @param count 任务总数
+     * @param threadCount 线程数（调用方已通过resolveThreadCount确定），为1时在调用线程内执行
+     * @param task 区间任务函数
+     */
+    static void parallelFor(size_t count, int threadCount, const RangeTask& task);
+};
+
+#endif // COMMUNICATION_PARALLEL_EXECUTOR_H
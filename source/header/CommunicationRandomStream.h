@@ -0,0 +1,129 @@
+#ifndef COMMUNICATION_RANDOM_STREAM_H
+#define COMMUNICATION_RANDOM_STREAM_H
+
+#include <cstdint>
+
+/**
+ * @brief 随机数子流编号
+ *
+ * 同一种子下不同用途的随机数取自互不相关的子流，
+ * 新增用途时追加编号，已有编号不得修改，否则相同种子的仿真结果将发生变化。
+ */
+enum class RandomStreamId : uint64_t {
+    CHANNEL_SHADOWING = 1,               // 时变信道阴影衰落
+    MONTE_CARLO_SHADOWING = 2,           // 蒙特卡洛阴影衰落
+    MONTE_CARLO_FADING = 3,              // 蒙特卡洛瑞利衰落
+    MONTE_CARLO_JAMMER_POWER = 4,        // 蒙特卡洛干扰功率扰动
+    MONTE_CARLO_JAMMER_DISTANCE = 5,     // 蒙特卡洛干扰距离扰动
+    FREQUENCY_HOPPING = 6,               // 跳频图案
+    USER_DEFINED = 7                     // 调用方按线程、分块或样本派生的子流
+};
+
+/**
+ * @brief 基于计数器的随机数流
+ *
+ * 第counter个输出只由(密钥, counter)决定：bits(counter) = mix64(key + (counter + 1) * γ)，
+ * 其中mix64为SplitMix64的终混函数，γ为64位黄金比例常数。
+ * 任意下标的随机数可直接生成而无需顺序推进内部状态，
+ * 因此把样本分块交给多个线程生成时，结果与串行逐个生成逐位一致，且与分块方式无关。
+ */
+class CommunicationRandomStream {
+private:
+    uint64_t key_;
+
+    struct KeyTag {};
+    CommunicationRandomStream(uint64_t key, KeyTag) : key_(key) {}
+
+public:
+    /// @brief 未指定种子时使用的默认种子
+    static constexpr uint64_t DEFAULT_SEED = 0x5EED0C0FFEE5EEDULL;
+
+    /**
+     * @brief 构造随机数流
+     * @param seed 种子
+     * @param streamId 子流编号
+     */
+    CommunicationRandomStream(uint64_t seed, RandomStreamId streamId);
+
+    /**
+     * @brief SplitMix64终混函数
+     * @param value 输入值
+     * @return 混合后的64位值
+     */
+    static uint64_t mix64(uint64_t value);
+
+    /**
+     * @brief 获取第counter个64位随机数
+     */
+    uint64_t bits(uint64_t counter) const;
+
+    /**
+     * @brief 获取第counter个(0, 1)开区间均匀分布随机数
+     * @details 取高53位，按格点中心映射，不会取到0或1
+     */
+    double uniform(uint64_t counter) const;
+
+    /**
+     * @brief 获取第index个标准正态分布随机数
+     * @details Box-Muller变换，占用计数器2*index与2*index+1
+     */
+    double normal(uint64_t index) const;
+
+    /**
+     * @brief 派生第index个子流
+     * @details 子流密钥由本流密钥与index再次混合得到，不同index的子流互不相关且各自可任意跳转，
+     *          适合按线程、分块或样本编号为并行任务分配独立的随机数流
+     */
+    CommunicationRandomStream substream(uint64_t index) const;
+
+    uint64_t getKey() const { return key_; }
+};
+
+/**
+ * @brief 随机数流上的顺序游标
+ *
+ * 依次读取随机数流的第0, 1, 2, ...个输出，位置可任意跳转：skip(n)与连续调用n次next()结果相同，
+ * 开销为O(1)。满足标准库UniformRandomBitGenerator要求，可直接用于<random>中的分布。
+ */
+class CommunicationRandomSequence {
+private:
+    CommunicationRandomStream stream_;
+    uint64_t position_;
+
+public:
+    using result_type = uint64_t;
+
+    explicit CommunicationRandomSequence(const CommunicationRandomStream& stream, uint64_t position = 0)
+        : stream_(stream)
+        , position_(position) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~static_cast<result_type>(0); }
+
+    /**
+     * @brief 读取下一个64位随机数
+     */
+    result_type operator()() { return stream_.bits(position_++); }
+
+    /**
+     * @brief 读取下一个(0, 1)开区间均匀分布随机数
+     */
+    double uniform() { return stream_.uniform(position_++); }
+
+    /**
+     * @brief 读取下一个标准正态分布随机数
+     * @details 占用两个位置
+     */
+    double normal();
+
+    /**
+     * @brief 向前跳过count个位置
+     */
+    void skip(uint64_t count) { position_ += count; }
+
+    uint64_t getPosition() const { return position_; }
+    void setPosition(uint64_t position) { position_ = position; }
+    const CommunicationRandomStream& getStream() const { return stream_; }
+};
+
+#endif // COMMUNICATION_RANDOM_STREAM_H
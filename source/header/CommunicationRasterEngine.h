@@ -0,0 +1,93 @@
+#ifndef COMMUNICATION_RASTER_ENGINE_H
+#define COMMUNICATION_RASTER_ENGINE_H
+
+#include "CommunicationLinkEvaluator.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief 栅格物理量枚举
+ */
+enum class RasterQuantity : uint32_t {
+    SIGNAL_STRENGTH = 0,               // 接收信号强度 (dBm)
+    JAMMER_TO_SIGNAL_RATIO = 1         // 干信比 (dB)
+};
+
+/**
+ * @brief 栅格文件头
+ *
+ * 栅格文件由64字节文件头和紧随其后的width×height个行主序float32像元值组成，
+ * 字节序与生成文件的机器一致。
+ */
+struct CommunicationRasterFileHeader {
+    char magic[4];                     // 文件标识 "CMRS"
+    uint32_t version;                  // 文件格式版本
+    uint32_t quantity;                 // 物理量（RasterQuantity）
+    uint32_t width;                    // 列数
+    uint32_t height;                   // 行数
+    uint32_t reserved;                 // 保留，填0
+    double xMin;                       // 区域左边界 (km)
+    double xMax;                       // 区域右边界 (km)
+    double yMin;                       // 区域下边界 (km)
+    double yMax;                       // 区域上边界 (km)
+    uint64_t padding;                  // 对齐到64字节
+};
+
+/**
+ * @brief 栅格计算引擎
+ *
+ * 发射机位于原点，以链路评估器的基准环境计算平面区域内各像元的接收信号强度或干信比。
+ * 栅格划分为固定大小的分块并由工作线程并行计算；每行像元先批量求距离平方，
+ * 再调用向量化log10，结果直接写入目标缓冲区（内存或内存映射文件），不产生中间栅格。
+ */
+class CommunicationRasterEngine {
+private:
+    LinkBudgetCoefficients coefficients_;
+    double unitJammerToSignalRatio_;     // 两段距离均为1km时的干信比 (dB)
+    double jammerX_;                     // 干扰机位置 (km)
+    double jammerY_;
+    int threadCount_;
+
+    void renderTiles(RasterQuantity quantity, const CommunicationRasterSpec& spec, float* output) const;
+
+public:
+    /**
+     * @brief 构造栅格计算引擎
+     * @param evaluator 链路评估器，取其基准环境作为通信参数
+     * @param jammerX 干扰机横坐标 (km)
+     * @param jammerY 干扰机纵坐标 (km)
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     */
+    CommunicationRasterEngine(const CommunicationLinkEvaluator& evaluator,
+                              double jammerX, double jammerY, int threadCount);
+
+    /**
+     * @brief 检查栅格规格是否有效
+     * @param spec 栅格规格
+     * @return 区域非空、行列数在[1, MAX_RASTER_DIMENSION]内时返回true
+     */
+    static bool isSpecValid(const CommunicationRasterSpec& spec);
+
+    /**
+     * @brief 计算栅格到内存缓冲区
+     * @param quantity 物理量
+     * @param spec 栅格规格
+     * @param output 行主序输出缓冲区，长度不小于width*height
+     * @return 规格有效返回true
+     */
+    bool render(RasterQuantity quantity, const CommunicationRasterSpec& spec, float* output) const;
+
+    /**
+     * @brief 计算栅格并经内存映射写入文件
+     * @details 文件按最终大小创建后整体映射，各分块直接写入映射区域，
+     *          内存占用与栅格大小无关，由操作系统按页回写
+     * @param quantity 物理量
+     * @param spec 栅格规格
+     * @param filename 输出文件路径，已存在时覆盖
+     * @return 写入成功返回true
+     */
+    bool renderToFile(RasterQuantity quantity, const CommunicationRasterSpec& spec, const std::string& filename) const;
+};
+
+#endif // COMMUNICATION_RASTER_ENGINE_H
@@ -0,0 +1,60 @@
+#ifndef COMMUNICATION_RELAY_PLANNER_H
+#define COMMUNICATION_RELAY_PLANNER_H
+
+#include "CommunicationLinkEvaluator.h"
+#include <utility>
+
+/**
+ * @brief 中继路径规划器
+ *
+ * 在候选网格上为源、目的节点选择不超过maxRelays个中继：优先使满足连接条件的跳数最少，
+ * 同跳数的路径中取最弱一跳信噪比最大者。直达链路满足连接条件时不使用中继。
+ * 每一跳的信噪比由链路距离与接收端到干扰机（位于(jammerX, jammerY)）的距离决定。
+ */
+class CommunicationRelayPlanner {
+private:
+    PositionalLinkCoefficients coefficients_;
+    double minimumSnr_;                  // 满足连接条件的最小信噪比 (dB)
+    double jammerX_;                     // 干扰机位置 (km)
+    double jammerY_;
+    int threadCount_;
+
+public:
+    /**
+     * @brief 构造中继路径规划器
+     * @param evaluator 链路评估器，取其基准环境作为所有链路的通信参数
+     * @param jammerX 干扰机横坐标 (km)
+     * @param jammerY 干扰机纵坐标 (km)
+     * @param threadCount 并行线程数，小于等于0表示使用硬件线程数
+     */
+    CommunicationRelayPlanner(const CommunicationLinkEvaluator& evaluator,
+                              double jammerX, double jammerY, int threadCount);
+
+    /**
+     * @brief 计算单跳链路信噪比
+     * @details 距离小于MIN_DISTANCE_LIMIT时按MIN_DISTANCE_LIMIT计算
+     * @param transmitter 发送端坐标 (km)
+     * @param receiver 接收端坐标 (km)
+     * @return 信噪比 (dB)
+     */
+    double calculateLinkSnr(const std::pair<double, double>& transmitter,
+                            const std::pair<double, double>& receiver) const;
+
+    /**
+     * @brief 规划中继路径
+     * @details 链路信噪比可写为 接收端常量项 - 斜率 * log10(链路距离)，
+     *          接收端常量项对每个节点只计算一次并缓存，给定瓶颈门限后每个接收端的可达半径即可直接求出，
+     *          边的判定只需比较距离平方。先以最小连接信噪比为门限求最少跳数，再在该跳数内对瓶颈门限二分查找：
+     *          每次从目的节点反向逐层BFS，各层前沿节点由工作线程并行扫描其可达半径内的格点，
+     *          到达源节点或超过跳数上限即终止
+     * @param source 源节点坐标 (km)
+     * @param destination 目的节点坐标 (km)
+     * @param maxRelays 最大中继数量
+     * @param plan 输出的中继规划结果
+     * @return 参数有效返回true（是否存在可行路径见plan.feasible）
+     */
+    bool plan(const std::pair<double, double>& source, const std::pair<double, double>& destination,
+              int maxRelays, CommunicationRelayPlan& plan) const;
+};
+
+#endif // COMMUNICATION_RELAY_PLANNER_H
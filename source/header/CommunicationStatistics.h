@@ -0,0 +1,179 @@
+#ifndef COMMUNICATION_STATISTICS_H
+#define COMMUNICATION_STATISTICS_H
+
+#include "MathConstants.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class CommunicationCheckpointWriter;
+class CommunicationCheckpointReader;
+
+/**
+ * @brief 单遍统计累加器
+ *
+ * 按Welford算法逐个累加样本的均值与二阶中心矩，不保存样本本身；
+ * 两个累加器可按Chan等人的并行公式合并，适合每个工作线程或数据块各自累加后汇总。
+ */
+class CommunicationRunningStatistics {
+private:
+    uint64_t count_;
+    double mean_;
+    double m2_;                          // 与均值之差的平方和
+    double minimum_;
+    double maximum_;
+
+public:
+    CommunicationRunningStatistics();
+
+    /**
+     * @brief 累加一个样本
+     */
+    void add(double value);
+
+    /**
+     * @brief 合并另一个累加器
+     * @details 合并结果与将两组样本依次累加在数学上等价
+     */
+    void merge(const CommunicationRunningStatistics& other);
+
+    void reset();
+
+    uint64_t getCount() const { return count_; }
+    double getMean() const { return mean_; }
+
+    /**
+     * @brief 获取样本方差（无偏估计）
+     * @return 样本数少于2时返回0
+     */
+    double getVariance() const;
+
+    /**
+     * @brief 获取样本标准差
+     */
+    double getStandardDeviation() const;
+
+    /**
+     * @brief 获取均值的置信区间
+     * @details 区间半宽 = 临界值 * 标准差 / sqrt(样本数)，临界值见calculateCriticalValue
+     * @param confidence 置信度 (0-1)
+     * @return 置信区间 (下界, 上界)，样本数少于2时为(0, 0)
+     */
+    std::pair<double, double> getConfidenceInterval(double confidence) const;
+
+    /**
+     * @brief 计算均值置信区间的临界值（正态近似）
+     * @details 按档位取值，档位含下边界：置信度不低于0.99/0.95/0.90时分别取2.58/1.96/1.64，否则取1.28
+     * @param confidence 置信度 (0-1)
+     * @return 临界值
+     */
+    static double calculateCriticalValue(double confidence);
+
+    /**
+     * @brief 获取最小值，无样本时为+inf
+     */
+    double getMinimum() const { return minimum_; }
+
+    /**
+     * @brief 获取最大值，无样本时为-inf
+     */
+    double getMaximum() const { return maximum_; }
+
+    /**
+     * @brief 检查累加器状态是否自洽
+     * @details 无样本时须为reset()后的状态；有样本时均值、二阶矩与极值均为有限值，
+     *          二阶矩非负且最小值不大于最大值。用于校验从检查点恢复的状态
+     */
+    bool isValid() const;
+};
+
+/**
+ * @brief 可合并的流式分位数草图（t-digest）
+ *
+ * 以若干(均值, 权重)质心近似样本分布：新样本先写入缓冲区，缓冲区满时与已有质心一起排序，
+ * 按尺度函数k(q) = compression / (2π) * asin(2q - 1)贪心合并，使每个质心跨越的k值不超过1，
+ * 因此分布两端的质心更小、尾部分位数更精确。质心数不超过约compression个，内存与样本数无关；
+ * 两个草图可直接合并，适合各工作线程分别累加后汇总。
+ */
+class CommunicationQuantileSketch {
+private:
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+    double compression_;
+    std::vector<Centroid> centroids_;    // 已合并的质心，按均值升序
+    std::vector<Centroid> buffer_;       // 尚未合并的样本或质心
+    double totalWeight_;
+    double minimum_;
+    double maximum_;
+
+    static void compressCentroids(double compression, double totalWeight, std::vector<Centroid>& centroids);
+    const std::vector<Centroid>& mergedCentroids(std::vector<Centroid>& scratch) const;
+
+public:
+    /**
+     * @brief 构造分位数草图
+     * @param compression 压缩参数，越大越精确，质心数约为该值
+     * @throws std::invalid_argument 压缩参数不为正时抛出
+     */
+    explicit CommunicationQuantileSketch(double compression = MathConstants::QUANTILE_SKETCH_DEFAULT_COMPRESSION);
+
+    /**
+     * @brief 累加一个样本，NaN被忽略
+     */
+    void add(double value);
+
+    /**
+     * @brief 合并另一个草图
+     */
+    void merge(const CommunicationQuantileSketch& other);
+
+    /**
+     * @brief 将缓冲区中的样本合并进质心
+     */
+    void compress();
+
+    void reset();
+
+    uint64_t getCount() const { return static_cast<uint64_t>(totalWeight_); }
+    double getMinimum() const { return minimum_; }
+    double getMaximum() const { return maximum_; }
+
+    /**
+     * @brief 获取质心数量（调用前先合并缓冲区才能反映实际内存占用）
+     */
+    size_t getCentroidCount() const { return centroids_.size(); }
+
+    /**
+     * @brief 估计百分位数
+     * @param percentile 百分位数 (0-100)
+     * @return 估计值，草图为空时返回0
+     */
+    double getPercentile(double percentile) const;
+
+    /**
+     * @brief 一次遍历估计多个百分位数
+     * @param percentiles 百分位数数组 (0-100)，无需有序；超出范围的取值截断到[0, 100]，NaN对应的结果为NaN
+     * @param count 数组长度
+     * @param results 输出数组，与percentiles一一对应
+     */
+    void getPercentiles(const double* percentiles, size_t count, double* results) const;
+
+    /**
+     * @brief 将草图的完整状态（含缓冲区）写入检查点的当前节
+     */
+    void saveState(CommunicationCheckpointWriter& writer) const;
+
+    /**
+     * @brief 从检查点的当前节恢复草图状态
+     * @details 恢复后继续累加的结果与未中断时逐位一致。总权重为0时不得含质心，且极值须为初始的±inf；
+     *          否则极值为有限值且最小值不大于最大值，各质心的均值有限、权重为正
+     * @return 数据完整且有效返回true，失败时草图不变
+     */
+    bool loadState(CommunicationCheckpointReader& reader);
+};
+
+#endif // COMMUNICATION_STATISTICS_H
@@ -0,0 +1,115 @@
+#ifndef COMMUNICATION_STATUS_MONITOR_H
+#define COMMUNICATION_STATUS_MONITOR_H
+
+#include "CommunicationModelAPI.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief 链路状态监控器
+ *
+ * 后台线程按固定周期调用最新发布的采样函数求值链路指标，写入预分配的环形缓冲区。
+ * 缓冲区只有监控线程一个写者；读者只复制记录而不移除，任意数量的读者可与写者并发，
+ * 读写缓冲区都不加锁、不分配内存。每个槽位按64位字以relaxed原子操作读写，
+ * 写者先公开"正在写入的序号"再写槽位，读者复制后重新读取该序号，丢弃可能被覆盖的记录（序列锁）。
+ * 采样函数以std::atomic_store/std::atomic_load替换和读取shared_ptr，
+ * 主流标准库以内部锁实现这对操作，锁只在发布时和每次采样开始时短暂持有，历史读取不经过它。
+ */
+class CommunicationStatusMonitor {
+public:
+    // 采样函数：在监控线程中调用，返回当前链路指标
+    using Sampler = std::function<CommunicationLinkMetrics()>;
+
+private:
+    static constexpr size_t RECORD_WORDS = sizeof(CommunicationStatusRecord) / sizeof(uint64_t);
+
+    struct Slot {
+        std::atomic<uint64_t> words[RECORD_WORDS];
+    };
+
+    std::unique_ptr<Slot[]> ring_;
+    size_t capacity_;
+
+    // claimed_为已开始写入的记录数，published_为已写完的记录数
+    std::atomic<uint64_t> claimed_;
+    std::atomic<uint64_t> published_;
+
+    // 当前采样函数，由发布线程整体替换
+    std::shared_ptr<const Sampler> sampler_;
+
+    std::chrono::steady_clock::time_point epoch_;
+    std::atomic<bool> running_;
+    std::thread worker_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+
+    void run(std::chrono::milliseconds interval);
+    void append(const CommunicationStatusRecord& record);
+    void readSlot(uint64_t sequence, CommunicationStatusRecord& record) const;
+
+public:
+    /**
+     * @brief 构造监控器
+     * @param capacity 历史记录容量，向上取整为2的幂
+     * @throws std::invalid_argument 容量为0时抛出
+     */
+    explicit CommunicationStatusMonitor(size_t capacity);
+    ~CommunicationStatusMonitor();
+
+    CommunicationStatusMonitor(const CommunicationStatusMonitor&) = delete;
+    CommunicationStatusMonitor& operator=(const CommunicationStatusMonitor&) = delete;
+
+    /**
+     * @brief 发布采样函数
+     * @details 监控线程自下一个采样时刻起调用最新发布的采样函数；
+     *          采样函数在监控线程中执行，不得引用可能先于监控器销毁的对象
+     * @param sampler 采样函数，为空时暂停写入记录
+     */
+    void publish(Sampler sampler);
+
+    /**
+     * @brief 启动后台采样线程
+     * @details 启动时立即采样一次，此后每隔interval采样一次
+     * @param interval 采样周期 (ms)
+     * @return 周期有效且当前未在运行返回true
+     */
+    bool start(int interval);
+
+    /**
+     * @brief 停止后台采样线程并等待其退出
+     * @return 停止前正在运行返回true
+     */
+    bool stop();
+
+    bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 获取最近count条记录
+     * @details 按时间从早到晚写入records，结果可能少于count（记录不足或读取期间被覆盖）
+     * @param records 输出数组，长度不小于count
+     * @param count 请求的记录数
+     * @return 实际写入的记录数
+     */
+    size_t getHistory(CommunicationStatusRecord* records, size_t count) const;
+
+    /**
+     * @brief 获取最新一条记录
+     * @return 存在记录返回true
+     */
+    bool getLatest(CommunicationStatusRecord& record) const;
+
+    /**
+     * @brief 获取已写入的记录总数（含已被覆盖的记录）
+     */
+    uint64_t getRecordCount() const { return published_.load(std::memory_order_acquire); }
+
+    size_t getCapacity() const { return capacity_; }
+};
+
+#endif // COMMUNICATION_STATUS_MONITOR_H
@@ -0,0 +1,86 @@
+#ifndef COMMUNICATION_TIMING_SIMULATOR_H
+#define COMMUNICATION_TIMING_SIMULATOR_H
+
+#include "CommunicationModelAPI.h"
+#include <cstdint>
+
+/**
+ * @brief 干扰时序离散事件仿真器
+ *
+ * 将每个干扰源与数据包序列抽象为周期性开关事件源：第k个周期内的开启区间为
+ * [offset + k*period + onTime, offset + k*period + offTime)。脉冲干扰的开启区间为脉冲持续期，
+ * 扫频干扰的开启区间为瞬时频带扫过信道频带的时段，数据包的开启区间为其发送期。
+ * 每个事件源同一时刻只有一个待处理事件，处理后按周期序号直接计算下一事件时刻，
+ * 不累积浮点误差；信道受干扰时间随事件推进累加，数据包结束时据此求其受干扰比例。
+ */
+class CommunicationTimingSimulator {
+public:
+    /**
+     * @brief 干扰源在信道上的活动方式
+     */
+    enum class Activity {
+        NEVER,                           // 频带不重叠，从不干扰信道
+        ALWAYS,                          // 持续干扰信道
+        PERIODIC                         // 周期性干扰信道
+    };
+
+    /**
+     * @brief 周期性开关时间窗 (s)
+     */
+    struct Window {
+        double offset;
+        double period;
+        double onTime;
+        double offTime;
+    };
+
+private:
+    double channelFrequency_;            // 信道中心频率 (MHz)
+    double channelBandwidth_;            // 信道带宽 (MHz)
+
+public:
+    /**
+     * @brief 构造干扰时序仿真器
+     * @param channelFrequency 信道中心频率 (MHz)
+     * @param channelBandwidth 信道带宽 (MHz)
+     */
+    CommunicationTimingSimulator(double channelFrequency, double channelBandwidth);
+
+    /**
+     * @brief 由干扰模型的脉冲与扫频参数构造时序干扰源
+     * @param model 干扰模型，取其干扰类型、脉冲宽度、脉冲重复频率、扫频速率与扫频范围
+     * @param frequency 干扰中心频率 (MHz)
+     * @param bandwidth 干扰带宽 (MHz)
+     */
+    static CommunicationTimingJammer fromJammerModel(const CommunicationJammerModel& model,
+                                                     double frequency, double bandwidth);
+
+    /**
+     * @brief 检查干扰源参数是否有效
+     * @details 脉冲干扰校验脉冲宽度与重复频率，扫频干扰校验扫频速率与范围
+     */
+    static bool isJammerValid(const CommunicationTimingJammer& jammer);
+
+    /**
+     * @brief 检查仿真配置是否有效
+     */
+    static bool isConfigValid(const CommunicationTimingConfig& config);
+
+    /**
+     * @brief 计算干扰源命中信道的周期性时间窗
+     * @param jammer 干扰源
+     * @param window 输出的时间窗，仅当返回PERIODIC时有效
+     * @return 干扰源在信道上的活动方式
+     */
+    Activity calculateJammedWindow(const CommunicationTimingJammer& jammer, Window& window) const;
+
+    /**
+     * @brief 执行离散事件仿真
+     * @param config 仿真配置，jammers为空时信道不受干扰
+     * @param result 输出的仿真结果
+     * @return 配置有效且预估事件数不超过MAX_TIMING_SIMULATION_EVENTS返回true
+     */
+    bool run(const CommunicationTimingConfig& config, CommunicationTimingResult& result) const;
+};
+
+#endif // COMMUNICATION_TIMING_SIMULATOR_H
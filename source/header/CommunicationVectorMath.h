@@ -0,0 +1,35 @@
+#ifndef COMMUNICATION_VECTOR_MATH_H
+#define COMMUNICATION_VECTOR_MATH_H
+
+#include <cstddef>
+
+/**
+ * @brief 向量化数学函数
+ *
+ * 对连续数组逐元素求值的数学函数。实现只使用位运算、整数加法和浮点乘加，
+ * 循环体无分支、无库函数调用，便于编译器自动向量化。
+ */
+class CommunicationVectorMath {
+public:
+    /**
+     * @brief 批量计算常用对数
+     * @details 将x分解为m·2^e（m∈[√2/2, √2)），ln(m)用atanh级数展开，
+     *          相对std::log10的绝对误差小于1e-12
+     * @param input 输入数组，元素须为正的规格化浮点数
+     * @param output 输出数组，可与input相同
+     * @param count 数组长度
+     */
+    static void log10Batch(const double* input, double* output, size_t count);
+
+    /**
+     * @brief 批量计算10的幂
+     * @details 10^x = 2^n · 2^f（n为x·log2(10)的最近整数，|f| ≤ 0.5），2^f用泰勒级数展开，
+     *          相对std::pow(10.0, x)的相对误差约为|x|·1e-16；结果超出规格化浮点数范围时饱和到边界附近
+     * @param input 输入数组，元素须为有限值
+     * @param output 输出数组，可与input相同
+     * @param count 数组长度
+     */
+    static void exp10Batch(const double* input, double* output, size_t count);
+};
+
+#endif // COMMUNICATION_VECTOR_MATH_H
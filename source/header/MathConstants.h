@@ -30,6 +30,12 @@ namespace MathConstants {
     
     /// @brief 10的自然对数
     constexpr double LN_10 = 2.30258509299404568402;
+    
+    /// @brief 2的自然对数
+    constexpr double LN_2 = 0.69314718055994530942;
+    
+    /// @brief e的常用对数 log10(e)
+    constexpr double LOG10_E = 0.43429448190325182765;
 
     // ==================== 物理常量 ====================
     
@@ -1037,6 +1043,127 @@ namespace MathConstants {
     /// @brief 组合效果基数 1.0
     constexpr double COMBINED_EFFECT_BASE = 1.0;
 
+    // ==================== 并行计算与参数扫描常量 ====================
+    
+    /// @brief 每个工作线程的最少扫描点数 64
+    constexpr int PARALLEL_MIN_ITEMS_PER_THREAD = 64;
+    
+    /// @brief 扫描点数计算的步长容差 1e-9
+    constexpr double SWEEP_STEP_TOLERANCE = 1e-9;
+    
+    /// @brief 单次扫描的最大点数 10000000
+    constexpr double MAX_SWEEP_POINTS = 10000000.0;
+    
+    /// @brief 链路矩阵分块边长 64
+    /// @details 一个分块的距离与对数缓冲区约64KB，可驻留于L2缓存
+    constexpr int LINK_MATRIX_BLOCK_SIZE = 64;
+    
+    /// @brief 连接信噪比门限的搜索区间宽度 100.0 dB
+    /// @details 在[LOW_SNR_THRESHOLD, LOW_SNR_THRESHOLD + 100dB]内二分查找满足连接条件的最小信噪比
+    constexpr double CONNECTION_SNR_SEARCH_SPAN = 100.0;
+    
+    /// @brief 连接信噪比门限的二分迭代次数 64
+    constexpr int CONNECTION_SNR_SEARCH_ITERATIONS = 64;
+    
+    /// @brief 连通性网格边长的安全系数 (1 - 1e-9)
+    /// @details 格边长略小于R/√2，保证同格节点间距严格小于R，不受坐标舍入影响
+    constexpr double CONNECTIVITY_GRID_SAFETY_FACTOR = 1.0 - 1e-9;
+    
+    /// @brief 栅格分块边长 64像元
+    constexpr int RASTER_TILE_SIZE = 64;
+    
+    /// @brief 栅格单边最大像元数 65536
+    constexpr int MAX_RASTER_DIMENSION = 65536;
+    
+    /// @brief 覆盖等值线四叉树初始层级 4（16×16均匀网格）
+    constexpr int COVERAGE_CONTOUR_MIN_DEPTH = 4;
+    
+    /// @brief 覆盖等值线四叉树最大层级 16
+    constexpr int COVERAGE_CONTOUR_MAX_DEPTH = 16;
+    
+    /// @brief 覆盖等值线四叉树默认层级 10（最细网格为1024×1024）
+    constexpr int COVERAGE_CONTOUR_DEFAULT_DEPTH = 10;
+    
+    /// @brief 覆盖分析区域相对最大覆盖距离的余量系数 1.05
+    constexpr double COVERAGE_CONTOUR_EXTENT_MARGIN = 1.05;
+    
+    /// @brief 中继候选网格长边格点数 64
+    constexpr int RELAY_LATTICE_RESOLUTION = 64;
+    
+    /// @brief 中继候选区域相对源-目的距离的外扩比例 0.25
+    constexpr double RELAY_LATTICE_MARGIN_RATIO = 0.25;
+    
+    /// @brief 中继路径瓶颈信噪比二分查找迭代次数 40
+    constexpr int RELAY_SEARCH_ITERATIONS = 40;
+    
+    /// @brief 时变信道仿真每块样本数 4096
+    /// @details 工作线程以块为单位生成样本，每块约192KB，按块顺序交付给回调
+    constexpr int CHANNEL_SIMULATION_CHUNK_SIZE = 4096;
+    
+    /// @brief 时变信道流式仿真的最大样本数 2^53
+    /// @details 超过该值时采样时刻无法由双精度精确表示
+    constexpr double MAX_CHANNEL_SIMULATION_SAMPLES = 9007199254740992.0;
+    
+    /// @brief 实时监控默认采样周期 100ms
+    constexpr int MONITOR_DEFAULT_INTERVAL_MS = 100;
+    
+    /// @brief 实时监控历史记录容量 1024条
+    /// @details 每条记录40字节，环形缓冲区约40KB
+    constexpr int MONITOR_HISTORY_CAPACITY = 1024;
+    
+    /// @brief 蒙特卡洛试验分块大小 4096
+    /// @details 每块独立累加统计量，再按块序号顺序合并，结果与线程数无关
+    constexpr int MONTE_CARLO_BLOCK_SIZE = 4096;
+    
+    /// @brief 蒙特卡洛单次分析的最大试验次数 1e12
+    constexpr double MAX_MONTE_CARLO_TRIALS = 1e12;
+    
+    /// @brief 分位数草图默认压缩参数 100
+    /// @details 质心数约为100个，中位数附近的相对秩误差约1%，尾部显著更小
+    constexpr double QUANTILE_SKETCH_DEFAULT_COMPRESSION = 100.0;
+    
+    /// @brief 分位数草图缓冲区相对压缩参数的倍数 5
+    constexpr double QUANTILE_SKETCH_BUFFER_FACTOR = 5.0;
+    
+    /// @brief 干扰时序仿真单次运行的最大事件数 1e11
+    /// @details 按各周期性事件源的周期预估，防止极短周期与超长时长组合导致长时间运行
+    constexpr double MAX_TIMING_SIMULATION_EVENTS = 1e11;
+    
+    /// @brief 跳频碰撞仿真每块的基准跳数 65536
+    /// @details 实际块长向上取为64 * 每包跳数的整数倍，使数据包不跨块
+    constexpr int HOPPING_SIMULATION_CHUNK_HOPS = 65536;
+    
+    /// @brief 跳频碰撞仿真每个网的最大跳数 2^40
+    /// @details 第n个网第i跳的随机数计数器为 n * 2^40 + i
+    constexpr double MAX_HOPPING_SIMULATION_HOPS = 1099511627776.0;
+    
+    /// @brief 跳频碰撞仿真的最大网数 2^20
+    constexpr int MAX_HOPPING_SIMULATION_NETS = 1048576;
+    
+    /// @brief 链路预测器默认过程噪声谱密度 0.1 dB²/s³
+    /// @details 白噪声加速度模型，对应指标变化率每秒约有0.3dB/s的随机游走
+    constexpr double LINK_PREDICTOR_PROCESS_NOISE = 0.1;
+    
+    /// @brief 链路预测器默认量测噪声方差 1 dB²
+    constexpr double LINK_PREDICTOR_MEASUREMENT_NOISE = 1.0;
+    
+    /// @brief 链路预测器首个样本后的趋势方差 100 (dB/s)²
+    /// @details 取值较大使第二个样本即可确定趋势的大致取值
+    constexpr double LINK_PREDICTOR_INITIAL_TREND_VARIANCE = 100.0;
+    
+    /// @brief 多干扰机聚合每个线程的最少(接收点, 干扰源)组合数 65536
+    constexpr int JAMMER_AGGREGATION_MIN_PAIRS_PER_THREAD = 65536;
+    
+    /// @brief 干扰覆盖剖面自适应二分的最大深度 20
+    /// @details 每段最多细分为2^20个区间，防止容差过小时采样点无限增加
+    constexpr int JAMMER_COVERAGE_PROFILE_MAX_DEPTH = 20;
+    
+    /// @brief 干扰分配矩阵每个线程的最少(干扰机, 目标)组合数 4096
+    constexpr int JAMMER_ASSIGNMENT_MIN_PAIRS_PER_THREAD = 4096;
+    
+    /// @brief 置信区间临界值 (80%置信度)
+    constexpr double CONFIDENCE_T_VALUE_80 = 1.28;
+
 
 } // namespace MathConstants
 
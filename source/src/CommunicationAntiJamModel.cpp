@@ -59,11 +59,15 @@ CommunicationAntiJamModel::CommunicationAntiJamModel(AntiJamTechnique technique,
 
 // 参数校验
 bool CommunicationAntiJamModel::validateParameters() const {
+    return validateParameters(systemBandwidth_);
+}
+
+bool CommunicationAntiJamModel::validateParameters(double systemBandwidth) const {
     if (!CommunicationAntiJamParameterConfig::isProcessingGainValid(processingGain_)) return false;
     if (!CommunicationAntiJamParameterConfig::isSpreadingFactorValid(spreadingFactor_)) return false;
     if (!CommunicationAntiJamParameterConfig::isHoppingRateValid(hoppingRate_)) return false;
     if (!CommunicationAntiJamParameterConfig::isCodingGainValid(codingGain_)) return false;
-    if (!CommunicationAntiJamParameterConfig::isSystemBandwidthValid(systemBandwidth_)) return false;
+    if (!CommunicationAntiJamParameterConfig::isSystemBandwidthValid(systemBandwidth)) return false;
     if (!CommunicationAntiJamParameterConfig::isSignalPowerValid(signalPower_)) return false;
     if (!CommunicationAntiJamParameterConfig::isNoisePowerValid(noisePower_)) return false;
     if (!CommunicationAntiJamParameterConfig::isInterferenceLevelValid(interferenceLevel_)) return false;
@@ -215,9 +219,9 @@ double CommunicationAntiJamModel::calculateAdaptiveFilteringGain() const {
     return std::max(MathConstants::MIN_ADAPTIVE_GAIN, std::min(MathConstants::MAX_ADAPTIVE_GAIN, adaptiveGain));
 }
 
-double CommunicationAntiJamModel::calculateBeamFormingGain() const {
+double CommunicationAntiJamModel::calculateBeamFormingGain(double systemBandwidth) const {
     // 波束成形增益，假设基于系统带宽
-    double beamGain = MathConstants::BEAM_GAIN_BASE + MathConstants::BEAM_GAIN_BANDWIDTH_COEFF * systemBandwidth_;
+    double beamGain = MathConstants::BEAM_GAIN_BASE + MathConstants::BEAM_GAIN_BANDWIDTH_COEFF * systemBandwidth;
     return std::max(MathConstants::MIN_BEAM_GAIN, std::min(MathConstants::MAX_BEAM_GAIN, beamGain));
 }
 
@@ -238,7 +242,7 @@ double CommunicationAntiJamModel::calculateInterferenceCancellationGain() const
     return std::max(MathConstants::MIN_CANCELLATION_GAIN, std::min(MathConstants::MAX_CANCELLATION_GAIN, cancellationGain));
 }
 
-double CommunicationAntiJamModel::calculateTotalProcessingGain() const {
+double CommunicationAntiJamModel::calculateTotalProcessingGain(double systemBandwidth) const {
     double totalGain = processingGain_;
     
     switch (antiJamTechnique_) {
@@ -258,7 +262,7 @@ double CommunicationAntiJamModel::calculateTotalProcessingGain() const {
             totalGain += calculateAdaptiveFilteringGain();
             break;
         case AntiJamTechnique::BEAM_FORMING:
-            totalGain += calculateBeamFormingGain();
+            totalGain += calculateBeamFormingGain(systemBandwidth);
             break;
         case AntiJamTechnique::POWER_CONTROL:
             totalGain += MathConstants::POWER_CONTROL_GAIN; // 固定功率控制增益
@@ -279,9 +283,21 @@ double CommunicationAntiJamModel::calculateTotalProcessingGain() const {
 
 // 核心计算方法
 double CommunicationAntiJamModel::calculateAntiJamGain() const {
-    if (!validateParameters()) return 0.0;
+    return calculateAntiJamGainForBandwidth(systemBandwidth_);
+}
+
+/// @brief 按给定系统带宽计算抗干扰增益
+/// @details 增益中只有波束成形增益与系统带宽有关，信号与噪声功率只参与参数校验；
+///          带宽无效时与setSystemBandwidth失败一致，按当前带宽计算。供批量求值时代替逐样本复制模型
+/// @param bandwidth 系统带宽
+/// @return 抗干扰增益(dB)
+double CommunicationAntiJamModel::calculateAntiJamGainForBandwidth(double bandwidth) const {
+    if (!CommunicationAntiJamParameterConfig::isSystemBandwidthValid(bandwidth)) {
+        bandwidth = systemBandwidth_;
+    }
+    if (!validateParameters(bandwidth)) return 0.0;
     
-    double totalGain = calculateTotalProcessingGain();
+    double totalGain = calculateTotalProcessingGain(bandwidth);
     
     // 根据抗干扰策略调整增益
     switch (antiJamStrategy_) {
@@ -493,7 +509,7 @@ double CommunicationAntiJamModel::calculateAdaptiveFilteringEffectiveness() cons
 double CommunicationAntiJamModel::calculateBeamFormingEffectiveness() const {
     if (antiJamTechnique_ != AntiJamTechnique::BEAM_FORMING) return 0.0;
     
-    double beamGain = calculateBeamFormingGain();
+    double beamGain = calculateBeamFormingGain(systemBandwidth_);
     double effectiveness = beamGain / MathConstants::BEAM_GAIN_NORMALIZATION; // 归一化到0-1
     
     return std::max(0.0, std::min(1.0, effectiveness));
@@ -0,0 +1,129 @@
+#include "CommunicationBandOverlapIndex.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief 扫描中跨越扫描点的频段集合
+     * @details 以位置表支持O(1)删除，删除时用末尾元素填补空位
+     */
+    class ActiveBandSet {
+    private:
+        std::vector<size_t> bands_;
+        std::vector<size_t> positions_;
+
+    public:
+        explicit ActiveBandSet(size_t capacity) : positions_(capacity) {}
+
+        void insert(size_t band) {
+            positions_[band] = bands_.size();
+            bands_.push_back(band);
+        }
+
+        void erase(size_t band) {
+            const size_t position = positions_[band];
+            bands_[position] = bands_.back();
+            positions_[bands_[position]] = position;
+            bands_.pop_back();
+        }
+
+        const std::vector<size_t>& bands() const { return bands_; }
+    };
+
+    double lowEdge(const CommunicationFrequencyBand& band) {
+        return band.frequency - band.bandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR;
+    }
+
+    double highEdge(const CommunicationFrequencyBand& band) {
+        return band.frequency + band.bandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR;
+    }
+}
+
+CommunicationBandOverlapIndex::CommunicationBandOverlapIndex(const std::vector<CommunicationFrequencyBand>& channels) {
+    channelStarts_.reserve(channels.size());
+    channelEnds_.reserve(channels.size());
+    channelBandwidths_.reserve(channels.size());
+    for (size_t c = 0; c < channels.size(); ++c) {
+        if (!isBandValid(channels[c])) {
+            throw std::invalid_argument("信道频段参数无效：中心频率须为有限值，带宽须为正");
+        }
+        channelStarts_.emplace_back(lowEdge(channels[c]), c);
+        channelEnds_.emplace_back(highEdge(channels[c]), c);
+        channelBandwidths_.push_back(channels[c].bandwidth);
+    }
+    std::sort(channelStarts_.begin(), channelStarts_.end());
+    std::sort(channelEnds_.begin(), channelEnds_.end());
+}
+
+bool CommunicationBandOverlapIndex::isBandValid(const CommunicationFrequencyBand& band) {
+    // 带宽相对中心频率过小时两个边沿可能舍入为同一值，此类频段同样视为无效
+    return std::isfinite(band.frequency) && std::isfinite(band.bandwidth) && band.bandwidth > 0.0 &&
+           lowEdge(band) < highEdge(band);
+}
+
+/// @brief 查询全部重叠的(干扰频段, 信道)配对
+/// @details 干扰频段与信道的下边沿按频率归并为开始事件，处理开始事件前先移除上边沿不高于该频率的
+///          全部活动频段，因此仅边沿相接的频段不会配对。扫描得到的配对再按干扰频段序号做计数排序
+void CommunicationBandOverlapIndex::findOverlaps(const std::vector<CommunicationFrequencyBand>& jammers,
+                                                 std::vector<CommunicationBandOverlap>& overlaps) const {
+    const size_t jammerCount = jammers.size();
+    const size_t channelCount = channelBandwidths_.size();
+    std::vector<double> jammerLow(jammerCount), jammerHigh(jammerCount);
+    std::vector<std::pair<double, size_t>> jammerStarts, jammerEnds;
+    jammerStarts.reserve(jammerCount);
+    jammerEnds.reserve(jammerCount);
+    for (size_t j = 0; j < jammerCount; ++j) {
+        if (!isBandValid(jammers[j])) {
+            throw std::invalid_argument("干扰频段参数无效：中心频率须为有限值，带宽须为正");
+        }
+        jammerLow[j] = lowEdge(jammers[j]);
+        jammerHigh[j] = highEdge(jammers[j]);
+        jammerStarts.emplace_back(jammerLow[j], j);
+        jammerEnds.emplace_back(jammerHigh[j], j);
+    }
+    std::sort(jammerStarts.begin(), jammerStarts.end());
+    std::sort(jammerEnds.begin(), jammerEnds.end());
+
+    // 信道上边沿按序号查表，避免在配对时重新计算
+    std::vector<double> channelLow(channelCount), channelHigh(channelCount);
+    for (const auto& start : channelStarts_) channelLow[start.second] = start.first;
+    for (const auto& end : channelEnds_) channelHigh[end.second] = end.first;
+
+    std::vector<CommunicationBandOverlap> found;
+    auto emit = [&](size_t jammer, size_t channel) {
+        const double overlap = std::min(jammerHigh[jammer], channelHigh[channel]) -
+                               std::max(jammerLow[jammer], channelLow[channel]);
+        found.push_back({jammer, channel, overlap, overlap / channelBandwidths_[channel]});
+    };
+
+    ActiveBandSet activeJammers(jammerCount), activeChannels(channelCount);
+    size_t jammerStart = 0, jammerEnd = 0, channelStart = 0, channelEnd = 0;
+    while (jammerStart < jammerCount || channelStart < channelCount) {
+        const bool jammerNext = channelStart == channelCount ||
+            (jammerStart < jammerCount && jammerStarts[jammerStart].first <= channelStarts_[channelStart].first);
+        const double frequency = jammerNext ? jammerStarts[jammerStart].first : channelStarts_[channelStart].first;
+        while (jammerEnd < jammerCount && jammerEnds[jammerEnd].first <= frequency) {
+            activeJammers.erase(jammerEnds[jammerEnd++].second);
+        }
+        while (channelEnd < channelCount && channelEnds_[channelEnd].first <= frequency) {
+            activeChannels.erase(channelEnds_[channelEnd++].second);
+        }
+        if (jammerNext) {
+            const size_t jammer = jammerStarts[jammerStart++].second;
+            for (size_t channel : activeChannels.bands()) emit(jammer, channel);
+            activeJammers.insert(jammer);
+        } else {
+            const size_t channel = channelStarts_[channelStart++].second;
+            for (size_t jammer : activeJammers.bands()) emit(jammer, channel);
+            activeChannels.insert(channel);
+        }
+    }
+
+    std::vector<size_t> offsets(jammerCount + 1, 0);
+    for (const CommunicationBandOverlap& overlap : found) ++offsets[overlap.jammerIndex + 1];
+    for (size_t j = 0; j < jammerCount; ++j) offsets[j + 1] += offsets[j];
+    overlaps.resize(found.size());
+    for (const CommunicationBandOverlap& overlap : found) overlaps[offsets[overlap.jammerIndex]++] = overlap;
+}
@@ -0,0 +1,105 @@
+#include "CommunicationChannelSimulator.h"
+#include "CommunicationParallelExecutor.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+CommunicationChannelSimulator::CommunicationChannelSimulator(const CommunicationLinkEvaluator& evaluator,
+                                                             uint64_t seed, int threadCount)
+    : random_(seed, RandomStreamId::CHANNEL_SHADOWING)
+    , threadCount_(threadCount) {
+    const CommunicationEnvironment& env = evaluator.getEnvironment();
+    CommunicationLinkStatus base = evaluator.evaluate(env, false);
+    baseSignalStrength_ = base.signalStrength;
+    baseSnr_ = base.signalToNoiseRatio;
+    bandwidth_ = env.bandwidth;
+    distance_ = env.distance;
+    shadowingStdDev_ = evaluator.getLossConfig(env.environmentType).shadowingStdDev;
+}
+
+bool CommunicationChannelSimulator::calculateSampleCount(double duration, double timeStep, uint64_t& sampleCount) {
+    if (!(timeStep > 0.0) || !(duration >= 0.0) || std::isinf(duration)) {
+        return false;
+    }
+    double intervals = std::floor(duration / timeStep + MathConstants::SWEEP_STEP_TOLERANCE);
+    if (!(intervals < MathConstants::MAX_CHANNEL_SIMULATION_SAMPLES)) {
+        return false;
+    }
+    sampleCount = static_cast<uint64_t>(intervals) + 1;
+    return true;
+}
+
+double CommunicationChannelSimulator::calculateShadowingLoss(uint64_t index) const {
+    if (shadowingStdDev_ <= 0.0) {
+        return 0.0;
+    }
+    return shadowingStdDev_ * random_.normal(index);
+}
+
+/// @brief 计算给定阴影衰落损耗下的链路状态
+/// @details 阴影衰落只改变接收信号功率，干扰与抗干扰修正量不变，因此信噪比与信号强度下降相同的dB数
+CommunicationLinkStatus CommunicationChannelSimulator::evaluateSample(double shadowingLoss) const {
+    return CommunicationLinkEvaluator::deriveLinkStatus(baseSignalStrength_ - shadowingLoss,
+                                                        baseSnr_ - shadowingLoss,
+                                                        bandwidth_, distance_);
+}
+
+void CommunicationChannelSimulator::generateChunk(uint64_t firstIndex, size_t count, double timeStep,
+                                                  CommunicationChannelSample* samples) const {
+    for (size_t k = 0; k < count; ++k) {
+        uint64_t index = firstIndex + k;
+        CommunicationChannelSample& sample = samples[k];
+        sample.time = static_cast<double>(index) * timeStep;
+        sample.shadowingLoss = calculateShadowingLoss(index);
+        sample.metrics = CommunicationLinkEvaluator::toLinkMetrics(evaluateSample(sample.shadowingLoss));
+    }
+}
+
+/// @brief 流式仿真
+/// @details 样本下标决定其随机数计数器，块的划分与线程数只影响生成顺序，不影响样本取值
+bool CommunicationChannelSimulator::simulate(double duration, double timeStep,
+                                             const CommunicationChannelSampleCallback& callback) const {
+    uint64_t nextSample = 0;
+    return simulate(duration, timeStep, nextSample, callback);
+}
+
+bool CommunicationChannelSimulator::simulate(double duration, double timeStep, uint64_t& nextSample,
+                                             const CommunicationChannelSampleCallback& callback) const {
+    uint64_t sampleCount = 0;
+    if (!callback || !calculateSampleCount(duration, timeStep, sampleCount) || nextSample > sampleCount) {
+        return false;
+    }
+
+    const uint64_t firstSample = nextSample;
+    const uint64_t chunkSize = static_cast<uint64_t>(MathConstants::CHANNEL_SIMULATION_CHUNK_SIZE);
+    const uint64_t remaining = sampleCount - firstSample;
+    const uint64_t chunkCount = (remaining + chunkSize - 1) / chunkSize;
+    const int threads = CommunicationParallelExecutor::resolveThreadCount(threadCount_, static_cast<size_t>(chunkCount));
+
+    std::vector<CommunicationChannelSample> buffer(
+        static_cast<size_t>(std::min<uint64_t>(remaining, chunkSize * static_cast<uint64_t>(threads))));
+
+    for (uint64_t batchStart = 0; batchStart < chunkCount; batchStart += threads) {
+        const size_t batchChunks = static_cast<size_t>(std::min<uint64_t>(threads, chunkCount - batchStart));
+
+        CommunicationParallelExecutor::parallelFor(batchChunks, static_cast<int>(batchChunks),
+            [&](size_t begin, size_t end, int) {
+                for (size_t c = begin; c < end; ++c) {
+                    uint64_t offset = (batchStart + c) * chunkSize;
+                    size_t count = static_cast<size_t>(std::min(chunkSize, remaining - offset));
+                    generateChunk(firstSample + offset, count, timeStep, buffer.data() + c * chunkSize);
+                }
+            });
+
+        for (size_t c = 0; c < batchChunks; ++c) {
+            uint64_t offset = (batchStart + c) * chunkSize;
+            size_t count = static_cast<size_t>(std::min(chunkSize, remaining - offset));
+            nextSample = firstSample + offset + count;
+            if (!callback(buffer.data() + c * chunkSize, count)) {
+                return true;
+            }
+        }
+    }
+    return true;
+}
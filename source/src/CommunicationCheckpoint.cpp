@@ -0,0 +1,145 @@
+#include "CommunicationCheckpoint.h"
+
+namespace {
+    // 文件头各字段的偏移
+    constexpr size_t OFFSET_MAGIC = 0;
+    constexpr size_t OFFSET_VERSION = 4;
+    constexpr size_t OFFSET_HEADER_SIZE = 6;
+    constexpr size_t OFFSET_BYTE_ORDER = 8;
+    constexpr size_t OFFSET_SECTION_COUNT = 12;
+    constexpr size_t OFFSET_PAYLOAD_SIZE = 16;
+    constexpr size_t OFFSET_CHECKSUM = 24;
+
+    // 节头各字段的偏移
+    constexpr size_t OFFSET_SECTION_TAG = 0;
+    constexpr size_t OFFSET_SECTION_LAYOUT = 4;
+    constexpr size_t OFFSET_SECTION_LENGTH = 8;
+
+    constexpr size_t ALIGNMENT = 8;
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+    template <typename T>
+    void store(std::vector<uint8_t>& buffer, size_t offset, T value) {
+        std::memcpy(buffer.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T load(const uint8_t* data, size_t offset) {
+        T value;
+        std::memcpy(&value, data + offset, sizeof(T));
+        return value;
+    }
+}
+
+constexpr uint32_t CommunicationCheckpointFormat::MAGIC;
+constexpr uint16_t CommunicationCheckpointFormat::VERSION;
+constexpr uint32_t CommunicationCheckpointFormat::BYTE_ORDER_MARK;
+constexpr size_t CommunicationCheckpointFormat::HEADER_SIZE;
+constexpr size_t CommunicationCheckpointFormat::SECTION_HEADER_SIZE;
+
+uint64_t CommunicationCheckpointFormat::calculateChecksum(const uint8_t* data, size_t size) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+CommunicationCheckpointWriter::CommunicationCheckpointWriter(std::vector<uint8_t>& buffer)
+    : buffer_(buffer)
+    , sectionStart_(0)
+    , sectionCount_(0) {
+    buffer_.assign(CommunicationCheckpointFormat::HEADER_SIZE, 0);
+}
+
+void CommunicationCheckpointWriter::beginSection(uint32_t tag, uint32_t layoutSize) {
+    if (sectionStart_ != 0) endSection();
+    sectionStart_ = buffer_.size();
+    buffer_.resize(buffer_.size() + CommunicationCheckpointFormat::SECTION_HEADER_SIZE, 0);
+    store(buffer_, sectionStart_ + OFFSET_SECTION_TAG, tag);
+    store(buffer_, sectionStart_ + OFFSET_SECTION_LAYOUT, layoutSize);
+}
+
+void CommunicationCheckpointWriter::endSection() {
+    if (sectionStart_ == 0) return;
+    buffer_.resize((buffer_.size() + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT, 0);
+    const uint64_t length = buffer_.size() - sectionStart_ - CommunicationCheckpointFormat::SECTION_HEADER_SIZE;
+    store(buffer_, sectionStart_ + OFFSET_SECTION_LENGTH, length);
+    sectionStart_ = 0;
+    ++sectionCount_;
+}
+
+void CommunicationCheckpointWriter::finish() {
+    endSection();
+    const size_t headerSize = CommunicationCheckpointFormat::HEADER_SIZE;
+    const uint64_t payloadSize = buffer_.size() - headerSize;
+    store(buffer_, OFFSET_MAGIC, CommunicationCheckpointFormat::MAGIC);
+    store(buffer_, OFFSET_VERSION, CommunicationCheckpointFormat::VERSION);
+    store(buffer_, OFFSET_HEADER_SIZE, static_cast<uint16_t>(headerSize));
+    store(buffer_, OFFSET_BYTE_ORDER, CommunicationCheckpointFormat::BYTE_ORDER_MARK);
+    store(buffer_, OFFSET_SECTION_COUNT, sectionCount_);
+    store(buffer_, OFFSET_PAYLOAD_SIZE, payloadSize);
+    store(buffer_, OFFSET_CHECKSUM,
+          CommunicationCheckpointFormat::calculateChecksum(buffer_.data() + headerSize, buffer_.size() - headerSize));
+}
+
+/// @brief 构造检查点读取器
+/// @details 拒绝魔数或字节序不符、版本高于当前格式、长度与文件头不一致或校验和错误的数据；
+///          文件头长度取自文件头本身，后续版本可加长文件头
+CommunicationCheckpointReader::CommunicationCheckpointReader(const uint8_t* data, size_t size)
+    : data_(data)
+    , size_(size)
+    , position_(0)
+    , sectionEnd_(0)
+    , version_(0)
+    , valid_(false) {
+    if (!data || size < CommunicationCheckpointFormat::HEADER_SIZE ||
+        load<uint32_t>(data, OFFSET_MAGIC) != CommunicationCheckpointFormat::MAGIC ||
+        load<uint32_t>(data, OFFSET_BYTE_ORDER) != CommunicationCheckpointFormat::BYTE_ORDER_MARK) {
+        return;
+    }
+    version_ = load<uint16_t>(data, OFFSET_VERSION);
+    const size_t headerSize = load<uint16_t>(data, OFFSET_HEADER_SIZE);
+    const uint64_t payloadSize = load<uint64_t>(data, OFFSET_PAYLOAD_SIZE);
+    if (version_ == 0 || version_ > CommunicationCheckpointFormat::VERSION ||
+        headerSize < CommunicationCheckpointFormat::HEADER_SIZE || headerSize > size ||
+        payloadSize != size - headerSize) {
+        return;
+    }
+    valid_ = load<uint64_t>(data, OFFSET_CHECKSUM) ==
+             CommunicationCheckpointFormat::calculateChecksum(data + headerSize, size - headerSize);
+    position_ = headerSize;
+    sectionEnd_ = headerSize;
+}
+
+/// @brief 顺序查找指定标签的节
+/// @details 节长度越界时停止查找
+bool CommunicationCheckpointReader::findSection(uint32_t tag, size_t& offset) const {
+    if (!valid_) return false;
+    offset = load<uint16_t>(data_, OFFSET_HEADER_SIZE);
+    while (size_ - offset >= CommunicationCheckpointFormat::SECTION_HEADER_SIZE) {
+        const uint64_t length = load<uint64_t>(data_, offset + OFFSET_SECTION_LENGTH);
+        const size_t body = offset + CommunicationCheckpointFormat::SECTION_HEADER_SIZE;
+        if (length > size_ - body) return false;
+        if (load<uint32_t>(data_, offset + OFFSET_SECTION_TAG) == tag) return true;
+        offset = body + static_cast<size_t>(length);
+    }
+    return false;
+}
+
+bool CommunicationCheckpointReader::hasSection(uint32_t tag) const {
+    size_t offset = 0;
+    return findSection(tag, offset);
+}
+
+bool CommunicationCheckpointReader::openSection(uint32_t tag, uint32_t layoutSize) {
+    size_t offset = 0;
+    if (!findSection(tag, offset) || load<uint32_t>(data_, offset + OFFSET_SECTION_LAYOUT) != layoutSize) {
+        return false;
+    }
+    position_ = offset + CommunicationCheckpointFormat::SECTION_HEADER_SIZE;
+    sectionEnd_ = position_ + static_cast<size_t>(load<uint64_t>(data_, offset + OFFSET_SECTION_LENGTH));
+    return true;
+}
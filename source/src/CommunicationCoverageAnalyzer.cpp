@@ -0,0 +1,292 @@
+#include "CommunicationCoverageAnalyzer.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    constexpr int EXTENT_SEARCH_ITERATIONS = 64;
+
+    /**
+     * @brief 四叉树单元（以最细层格点为单位）
+     */
+    struct QuadCell {
+        uint32_t i;          // 左下角格点列号
+        uint32_t j;          // 左下角格点行号
+        int depth;           // 所在层级
+    };
+
+    /**
+     * @brief marching squares线段，端点以所在格边的编号表示
+     */
+    struct ContourSegment {
+        uint64_t from;
+        uint64_t to;
+    };
+}
+
+// 构造函数
+CommunicationCoverageAnalyzer::CommunicationCoverageAnalyzer(const CommunicationLinkEvaluator& evaluator,
+                                                             double jammerX, double jammerY)
+    : coefficients_(evaluator.calculatePositionalLinkCoefficients(evaluator.getEnvironment()))
+    , jammerX_(jammerX)
+    , jammerY_(jammerY) {
+}
+
+/// @brief 由可用性阈值求信噪比阈值
+/// @details calculatePerformance中 可用性 = 1 / (1 + exp(-(SNR - 偏移) / 除数))，
+///          其反函数为 SNR = 偏移 + 除数 * ln(p / (1 - p))
+double CommunicationCoverageAnalyzer::availabilityToSnr(double availability) {
+    return MathConstants::AVAILABILITY_SNR_OFFSET +
+           MathConstants::AVAILABILITY_DIVISOR * std::log(availability / (MathConstants::UNITY - availability));
+}
+
+double CommunicationCoverageAnalyzer::calculateSnrAt(double x, double y) const {
+    const double minSquaredDistance = MathConstants::MIN_DISTANCE_LIMIT * MathConstants::MIN_DISTANCE_LIMIT;
+    double signalLog = std::log10(std::max(x * x + y * y, minSquaredDistance));
+    double snr = coefficients_.jammerFreeSnrAtUnitDistance - 0.5 * coefficients_.distanceSlope * signalLog;
+    if (coefficients_.jammed) {
+        double dx = x - jammerX_;
+        double dy = y - jammerY_;
+        double jammerLog = std::log10(std::max(dx * dx + dy * dy, minSquaredDistance));
+        snr -= coefficients_.unitJammerToSignalRatio + 0.5 * MathConstants::FSPL_DISTANCE_COEFFICIENT * (signalLog - jammerLog);
+    }
+    return snr;
+}
+
+/// @brief 计算分析区域半宽
+/// @details 到发射机距离为d的点，其到干扰机的距离不超过d + |干扰机位置|，
+///          据此得到信噪比关于d单调递减的上界，二分求出上界降至阈值的距离并乘以余量系数。
+///          该距离之外不存在覆盖点
+/// @param snrThreshold 信噪比阈值 (dB)
+/// @return 分析区域半宽 (km)
+double CommunicationCoverageAnalyzer::calculateCoverageExtent(double snrThreshold) const {
+    const double jammerOffset = std::hypot(jammerX_, jammerY_);
+    auto snrUpperBound = [&](double logDistance) {
+        double snr = coefficients_.jammerFreeSnrAtUnitDistance - coefficients_.distanceSlope * logDistance;
+        if (coefficients_.jammed) {
+            double distance = std::pow(10.0, logDistance);
+            snr -= coefficients_.unitJammerToSignalRatio;
+            snr += MathConstants::FSPL_DISTANCE_COEFFICIENT * std::log10(1.0 + jammerOffset / distance);
+        }
+        return snr;
+    };
+
+    double low = std::log10(MathConstants::MIN_DISTANCE_LIMIT);
+    double high = std::log10(MathConstants::DISTANCE_VALIDATION_MAX);
+    if (snrUpperBound(high) >= snrThreshold) {
+        return MathConstants::DISTANCE_VALIDATION_MAX;
+    }
+    if (snrUpperBound(low) < snrThreshold) {
+        return MathConstants::MIN_DISTANCE_LIMIT * MathConstants::COVERAGE_CONTOUR_EXTENT_MARGIN;
+    }
+    for (int iteration = 0; iteration < EXTENT_SEARCH_ITERATIONS; ++iteration) {
+        double middle = 0.5 * (low + high);
+        if (snrUpperBound(middle) >= snrThreshold) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return std::pow(10.0, high) * MathConstants::COVERAGE_CONTOUR_EXTENT_MARGIN;
+}
+
+/// @brief 提取覆盖等值线
+/// @details 1. 以最细层格点坐标为键缓存采样值（信噪比 - 阈值，非负表示覆盖）；
+///          2. 从初始均匀网格出发深度优先细分，角点状态一致且不含奇点的单元直接丢弃；
+///          3. 最细层跨越单元按四个角点状态生成线段，鞍点情形由单元中心值消歧，
+///             并沿交点所在格边追踪相邻单元，补齐穿过未细分粗单元的等值线；
+///          4. 线段端点以格边编号标识，相邻单元在同一格边上的交点重合，据此拼接折线，
+///             先从度为1的端点出发得到开放折线（与区域边界相交），其余为闭合折线
+bool CommunicationCoverageAnalyzer::extractContour(double threshold, int maxDepth,
+                                                   CommunicationCoverageContour& contour) const {
+    if (!(threshold > 0.0 && threshold < MathConstants::UNITY) ||
+        maxDepth < MathConstants::COVERAGE_CONTOUR_MIN_DEPTH ||
+        maxDepth > MathConstants::COVERAGE_CONTOUR_MAX_DEPTH) {
+        return false;
+    }
+
+    const double snrThreshold = availabilityToSnr(threshold);
+    const double extent = calculateCoverageExtent(snrThreshold);
+    const uint32_t latticeSize = 1u << maxDepth;            // 最细层每边单元数
+    const uint64_t latticeStride = static_cast<uint64_t>(latticeSize) + 1;
+    const double cellSize = 2.0 * extent / latticeSize;
+
+    contour.threshold = threshold;
+    contour.snrThreshold = snrThreshold;
+    contour.extent = extent;
+    contour.cellSize = cellSize;
+    contour.polylines.clear();
+
+    auto toCoordinate = [&](double index) { return -extent + index * cellSize; };
+
+    std::unordered_map<uint64_t, double> samples;
+    auto sample = [&](uint32_t i, uint32_t j) {
+        uint64_t key = static_cast<uint64_t>(j) * latticeStride + i;
+        auto found = samples.find(key);
+        if (found != samples.end()) return found->second;
+        double value = calculateSnrAt(toCoordinate(i), toCoordinate(j)) - snrThreshold;
+        samples.emplace(key, value);
+        return value;
+    };
+
+    // 包含发射机或干扰机的单元始终细分：干扰机附近的未覆盖区域可能小于初始网格
+    auto containsPoint = [&](const QuadCell& cell, uint32_t span, double x, double y) {
+        double x0 = toCoordinate(cell.i);
+        double y0 = toCoordinate(cell.j);
+        double x1 = toCoordinate(cell.i + span);
+        double y1 = toCoordinate(cell.j + span);
+        return x >= x0 && x <= x1 && y >= y0 && y <= y1;
+    };
+
+    // 格边编号：水平边(i,j)-(i+1,j)为偶数，竖直边(i,j)-(i,j+1)为奇数
+    auto horizontalEdge = [&](uint32_t i, uint32_t j) { return (static_cast<uint64_t>(j) * latticeStride + i) << 1; };
+    auto verticalEdge = [&](uint32_t i, uint32_t j) { return ((static_cast<uint64_t>(j) * latticeStride + i) << 1) | 1u; };
+
+    std::unordered_map<uint64_t, std::pair<double, double>> crossings;
+    std::vector<ContourSegment> segments;
+
+    auto addCrossing = [&](uint64_t edge, double xa, double ya, double va, double xb, double yb, double vb) {
+        if (crossings.count(edge)) return;
+        double t = va / (va - vb);
+        crossings.emplace(edge, std::make_pair(xa + t * (xb - xa), ya + t * (yb - ya)));
+    };
+
+    // 最细层单元按格点编号去重；跨越单元的交点所在格边另一侧的单元加入待处理队列，
+    // 使等值线穿过未细分的粗单元时仍能沿等值线补齐，保证折线闭合
+    std::unordered_set<uint64_t> emittedCells;
+    std::vector<std::pair<uint32_t, uint32_t>> pendingCells;
+
+    auto emitCell = [&](uint32_t i, uint32_t j) {
+        if (!emittedCells.insert(static_cast<uint64_t>(j) * latticeSize + i).second) return;
+
+        // 角点：0左下 1右下 2右上 3左上；边：0下 1右 2上 3左
+        double v[4] = {sample(i, j), sample(i + 1, j), sample(i + 1, j + 1), sample(i, j + 1)};
+        double x0 = toCoordinate(i), x1 = toCoordinate(i + 1);
+        double y0 = toCoordinate(j), y1 = toCoordinate(j + 1);
+        bool inside[4] = {v[0] >= 0.0, v[1] >= 0.0, v[2] >= 0.0, v[3] >= 0.0};
+        uint64_t edges[4] = {horizontalEdge(i, j), verticalEdge(i + 1, j), horizontalEdge(i, j + 1), verticalEdge(i, j)};
+
+        uint64_t crossed[4];
+        int crossedCount = 0;
+        if (inside[0] != inside[1]) {
+            addCrossing(edges[0], x0, y0, v[0], x1, y0, v[1]);
+            crossed[crossedCount++] = edges[0];
+            if (j > 0) pendingCells.emplace_back(i, j - 1);
+        }
+        if (inside[1] != inside[2]) {
+            addCrossing(edges[1], x1, y0, v[1], x1, y1, v[2]);
+            crossed[crossedCount++] = edges[1];
+            if (i + 1 < latticeSize) pendingCells.emplace_back(i + 1, j);
+        }
+        if (inside[3] != inside[2]) {
+            addCrossing(edges[2], x0, y1, v[3], x1, y1, v[2]);
+            crossed[crossedCount++] = edges[2];
+            if (j + 1 < latticeSize) pendingCells.emplace_back(i, j + 1);
+        }
+        if (inside[0] != inside[3]) {
+            addCrossing(edges[3], x0, y0, v[0], x0, y1, v[3]);
+            crossed[crossedCount++] = edges[3];
+            if (i > 0) pendingCells.emplace_back(i - 1, j);
+        }
+
+        if (crossedCount == 2) {
+            segments.push_back({crossed[0], crossed[1]});
+        } else if (crossedCount == 4) {
+            // 鞍点：中心与左下角状态一致时左下、右上角相连，切开右下角与左上角
+            double center = calculateSnrAt(0.5 * (x0 + x1), 0.5 * (y0 + y1)) - snrThreshold;
+            if ((center >= 0.0) == inside[0]) {
+                segments.push_back({edges[0], edges[1]});
+                segments.push_back({edges[2], edges[3]});
+            } else {
+                segments.push_back({edges[3], edges[0]});
+                segments.push_back({edges[1], edges[2]});
+            }
+        }
+    };
+
+    // 深度优先细分
+    const int initialDepth = MathConstants::COVERAGE_CONTOUR_MIN_DEPTH;
+    const uint32_t initialSpan = latticeSize >> initialDepth;
+    std::vector<QuadCell> stack;
+    for (uint32_t j = 0; j < latticeSize; j += initialSpan) {
+        for (uint32_t i = 0; i < latticeSize; i += initialSpan) {
+            stack.push_back({i, j, initialDepth});
+        }
+    }
+
+    while (!stack.empty()) {
+        QuadCell cell = stack.back();
+        stack.pop_back();
+        uint32_t span = latticeSize >> cell.depth;
+
+        double v[4] = {sample(cell.i, cell.j), sample(cell.i + span, cell.j),
+                       sample(cell.i + span, cell.j + span), sample(cell.i, cell.j + span)};
+        bool mixed = (v[0] >= 0.0) != (v[1] >= 0.0) || (v[0] >= 0.0) != (v[2] >= 0.0) ||
+                     (v[0] >= 0.0) != (v[3] >= 0.0);
+
+        if (cell.depth == maxDepth) {
+            if (mixed) emitCell(cell.i, cell.j);
+            continue;
+        }
+
+        bool singular = containsPoint(cell, span, 0.0, 0.0) ||
+                        (coefficients_.jammed && containsPoint(cell, span, jammerX_, jammerY_));
+        if (!mixed && !singular) continue;
+
+        uint32_t half = span >> 1;
+        int childDepth = cell.depth + 1;
+        stack.push_back({cell.i, cell.j, childDepth});
+        stack.push_back({cell.i + half, cell.j, childDepth});
+        stack.push_back({cell.i, cell.j + half, childDepth});
+        stack.push_back({cell.i + half, cell.j + half, childDepth});
+    }
+
+    // 沿等值线补齐粗单元内的部分
+    while (!pendingCells.empty()) {
+        std::pair<uint32_t, uint32_t> cell = pendingCells.back();
+        pendingCells.pop_back();
+        emitCell(cell.first, cell.second);
+    }
+    contour.sampleCount = samples.size();
+
+    // 按共享格边拼接折线
+    std::unordered_map<uint64_t, std::pair<int, int>> incidence;
+    incidence.reserve(crossings.size());
+    for (size_t s = 0; s < segments.size(); ++s) {
+        for (uint64_t edge : {segments[s].from, segments[s].to}) {
+            auto inserted = incidence.emplace(edge, std::make_pair(static_cast<int>(s), -1));
+            if (!inserted.second) inserted.first->second.second = static_cast<int>(s);
+        }
+    }
+
+    std::vector<bool> used(segments.size(), false);
+    auto trace = [&](size_t first, uint64_t startEdge) {
+        std::vector<std::pair<double, double>> polyline;
+        polyline.push_back(crossings[startEdge]);
+        uint64_t edge = startEdge;
+        int current = static_cast<int>(first);
+        while (current >= 0 && !used[current]) {
+            used[current] = true;
+            const ContourSegment& segment = segments[current];
+            edge = segment.from == edge ? segment.to : segment.from;
+            polyline.push_back(crossings[edge]);
+            const std::pair<int, int>& next = incidence[edge];
+            current = next.first == current ? next.second : next.first;
+        }
+        contour.polylines.push_back(std::move(polyline));
+    };
+
+    for (size_t s = 0; s < segments.size(); ++s) {
+        for (uint64_t edge : {segments[s].from, segments[s].to}) {
+            if (!used[s] && incidence[edge].second < 0) trace(s, edge);
+        }
+    }
+    for (size_t s = 0; s < segments.size(); ++s) {
+        if (!used[s]) trace(s, segments[s].from);
+    }
+    return true;
+}
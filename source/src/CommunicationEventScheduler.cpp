@@ -0,0 +1,54 @@
+#include "CommunicationEventScheduler.h"
+
+CommunicationEventScheduler::CommunicationEventScheduler()
+    : nextSequence_(0) {
+}
+
+void CommunicationEventScheduler::reserve(size_t capacity) {
+    heap_.reserve(capacity);
+}
+
+void CommunicationEventScheduler::clear() {
+    heap_.clear();
+    nextSequence_ = 0;
+}
+
+/// @brief 加入一个事件
+/// @details 上滤时只移动空位，新事件最后写入一次
+void CommunicationEventScheduler::schedule(double time, uint32_t source, uint32_t kind) {
+    Event event{time, nextSequence_++, source, kind};
+    heap_.push_back(event);
+
+    size_t hole = heap_.size() - 1;
+    while (hole > 0) {
+        size_t parent = (hole - 1) / 2;
+        if (!earlier(event, heap_[parent])) break;
+        heap_[hole] = heap_[parent];
+        hole = parent;
+    }
+    heap_[hole] = event;
+}
+
+/// @brief 取出最早的事件
+/// @details 以末尾元素填补堆顶空位后下滤，每层比较两个子节点
+bool CommunicationEventScheduler::popNext(Event& event) {
+    if (heap_.empty()) return false;
+    event = heap_.front();
+
+    Event last = heap_.back();
+    heap_.pop_back();
+    const size_t count = heap_.size();
+    if (count == 0) return true;
+
+    size_t hole = 0;
+    for (;;) {
+        size_t child = 2 * hole + 1;
+        if (child >= count) break;
+        if (child + 1 < count && earlier(heap_[child + 1], heap_[child])) ++child;
+        if (!earlier(heap_[child], last)) break;
+        heap_[hole] = heap_[child];
+        hole = child;
+    }
+    heap_[hole] = last;
+    return true;
+}
@@ -0,0 +1,237 @@
+#include "CommunicationHoppingSimulator.h"
+#include "CommunicationTimingSimulator.h"
+#include "CommunicationAntiJamParameterConfig.h"
+#include "CommunicationParallelExecutor.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+    constexpr double MS_TO_SECONDS = 1e-3;
+    constexpr int NET_COUNTER_SHIFT = 40;
+    constexpr size_t SLOTS_PER_BLOCK = 64;
+
+    int popcount64(uint64_t value) {
+#ifdef _MSC_VER
+        return static_cast<int>(__popcnt64(value));
+#else
+        return __builtin_popcountll(value);
+#endif
+    }
+
+    uint64_t lowMask(size_t bits) {
+        return bits >= 64 ? ~0ULL : ((1ULL << bits) - 1);
+    }
+
+    /**
+     * @brief 单个工作线程的累计计数
+     */
+    struct HoppingCounts {
+        std::vector<uint64_t> hits;
+        std::vector<uint64_t> lostPackets;
+        uint64_t jammedChannels = 0;     // 各跳受干扰信道数之和
+    };
+}
+
+CommunicationHoppingSimulator::CommunicationHoppingSimulator(double centerFrequency, int channelCount,
+                                                             double channelSpacing, double hoppingRate,
+                                                             double dwellTime, uint64_t seed, int threadCount)
+    : random_(seed, RandomStreamId::FREQUENCY_HOPPING)
+    , channelSpacing_(channelSpacing)
+    , channelCount_(channelCount)
+    , threadCount_(threadCount) {
+    if (!std::isfinite(centerFrequency) ||
+        !CommunicationAntiJamParameterConfig::isHoppingChannelsValid(channelCount) ||
+        !CommunicationAntiJamParameterConfig::isChannelSpacingValid(channelSpacing) ||
+        !CommunicationAntiJamParameterConfig::isHoppingRateValid(hoppingRate) ||
+        !CommunicationAntiJamParameterConfig::isDwellTimeValid(dwellTime)) {
+        throw std::invalid_argument("跳频参数超出有效范围");
+    }
+    lowestEdge_ = centerFrequency - channelSpacing * channelCount / 2.0;
+    hopPeriod_ = 1.0 / hoppingRate;
+    dwellTime_ = std::min(dwellTime * MS_TO_SECONDS, hopPeriod_);
+}
+
+bool CommunicationHoppingSimulator::isConfigValid(const CommunicationHoppingConfig& config) {
+    return config.hopCount >= 1 &&
+           static_cast<double>(config.hopCount) <= MathConstants::MAX_HOPPING_SIMULATION_HOPS &&
+           config.netCount >= 1 && config.netCount <= MathConstants::MAX_HOPPING_SIMULATION_NETS &&
+           config.hopsPerPacket >= 1 && config.hopsPerPacket <= static_cast<int>(SLOTS_PER_BLOCK) &&
+           config.toleratedHits >= 0 && config.toleratedHits < config.hopsPerPacket &&
+           std::all_of(config.jammers.begin(), config.jammers.end(), CommunicationTimingSimulator::isJammerValid);
+}
+
+/// @brief 获取跳频网第hop跳所在的信道
+/// @details 取随机数高32位乘以信道数再右移32位，把[0, 2^32)均匀映射到[0, 信道数)
+int CommunicationHoppingSimulator::selectChannel(uint64_t net, uint64_t hop) const {
+    uint64_t bits = random_.bits((net << NET_COUNTER_SHIFT) | hop);
+    return static_cast<int>(((bits >> 32) * static_cast<uint64_t>(channelCount_)) >> 32);
+}
+
+/// @brief 将与频段(low, high)重叠的信道置位
+/// @details 信道c占用[下边沿 + c * 间隔, 下边沿 + (c + 1) * 间隔)，首末字以掩码置位，中间整字置满
+void CommunicationHoppingSimulator::markFrequencyRange(double low, double high, uint64_t* words) const {
+    double first = std::floor((low - lowestEdge_) / channelSpacing_);
+    double last = std::ceil((high - lowestEdge_) / channelSpacing_) - 1.0;
+    first = std::max(first, 0.0);
+    last = std::min(last, static_cast<double>(channelCount_ - 1));
+    if (!(first <= last)) return;
+
+    size_t firstBit = static_cast<size_t>(first);
+    size_t lastBit = static_cast<size_t>(last);
+    size_t firstWord = firstBit / 64;
+    size_t lastWord = lastBit / 64;
+    uint64_t firstMask = ~0ULL << (firstBit % 64);
+    uint64_t lastMask = ~0ULL >> (63 - lastBit % 64);
+    if (firstWord == lastWord) {
+        words[firstWord] |= firstMask & lastMask;
+        return;
+    }
+    words[firstWord] |= firstMask;
+    for (size_t w = firstWord + 1; w < lastWord; ++w) words[w] = ~0ULL;
+    words[lastWord] |= lastMask;
+}
+
+/// @brief 计算第hop跳驻留期间受干扰的信道位集
+/// @details 驻留期间为[t0, t1)。扫频干扰在该期间扫过的中心频率区间为
+///          [下限 + 速率 * ((t0 - 起始) mod 周期), 再加 速率 * (t1 - t0)]，越过上限时折回下限分为两段；
+///          脉冲干扰只需检查t1之前最后一个脉冲是否在t0之后才结束
+void CommunicationHoppingSimulator::calculateJammedChannels(const std::vector<CommunicationTimingJammer>& jammers,
+                                                            uint64_t hop, uint64_t* words) const {
+    std::fill(words, words + getWordCount(), 0ULL);
+    const double t0 = static_cast<double>(hop) * hopPeriod_;
+    const double t1 = t0 + dwellTime_;
+
+    for (const auto& jammer : jammers) {
+        const double offset = jammer.startOffset * MS_TO_SECONDS;
+        const double halfBandwidth = jammer.bandwidth / 2.0;
+
+        if (jammer.type == JammerType::SWEEP_FREQUENCY) {
+            if (t1 <= offset) continue;
+            const double start = std::max(t0, offset);
+            const double lowest = jammer.frequency - jammer.sweepRange / 2.0;
+            const double highest = lowest + jammer.sweepRange;
+            const double span = jammer.sweepRate * (t1 - start);
+            if (span >= jammer.sweepRange) {
+                markFrequencyRange(lowest - halfBandwidth, highest + halfBandwidth, words);
+                continue;
+            }
+            double period = jammer.sweepRange / jammer.sweepRate;
+            double from = lowest + jammer.sweepRate * std::fmod(start - offset, period);
+            double to = from + span;
+            if (to <= highest) {
+                markFrequencyRange(from - halfBandwidth, to + halfBandwidth, words);
+            } else {
+                markFrequencyRange(from - halfBandwidth, highest + halfBandwidth, words);
+                markFrequencyRange(lowest - halfBandwidth, lowest + (to - highest) + halfBandwidth, words);
+            }
+            continue;
+        }
+
+        if (jammer.type == JammerType::PULSE) {
+            if (t1 <= offset) continue;
+            double period = 1.0 / jammer.pulseRepetitionRate;
+            double lastPulse = offset + (std::ceil((t1 - offset) / period) - 1.0) * period;
+            if (!(lastPulse + jammer.pulseWidth * MS_TO_SECONDS > t0)) continue;
+        }
+        markFrequencyRange(jammer.frequency - halfBandwidth, jammer.frequency + halfBandwidth, words);
+    }
+}
+
+/// @brief 执行碰撞仿真
+/// @details 数据包从第0跳起每hopsPerPacket跳一个，块长取64 * hopsPerPacket的整数倍使数据包不跨块；
+///          块内按64跳一组推进，组内数据包边界对所有网相同，每个网只需携带未完成数据包的命中数
+bool CommunicationHoppingSimulator::run(const CommunicationHoppingConfig& config,
+                                        CommunicationHoppingResult& result) const {
+    if (!isConfigValid(config)) return false;
+
+    const size_t netCount = static_cast<size_t>(config.netCount);
+    const size_t hopsPerPacket = static_cast<size_t>(config.hopsPerPacket);
+    const size_t wordCount = getWordCount();
+    const uint64_t packetAlignment = SLOTS_PER_BLOCK * hopsPerPacket;
+    const uint64_t chunkHops = (static_cast<uint64_t>(MathConstants::HOPPING_SIMULATION_CHUNK_HOPS) +
+                                packetAlignment - 1) / packetAlignment * packetAlignment;
+    const uint64_t chunkCount = (config.hopCount + chunkHops - 1) / chunkHops;
+    const int threads = CommunicationParallelExecutor::resolveThreadCount(threadCount_, static_cast<size_t>(chunkCount));
+
+    std::vector<HoppingCounts> counts(static_cast<size_t>(threads));
+    for (auto& threadCounts : counts) {
+        threadCounts.hits.assign(netCount, 0);
+        threadCounts.lostPackets.assign(netCount, 0);
+    }
+
+    CommunicationParallelExecutor::parallelFor(static_cast<size_t>(chunkCount), threads,
+        [&](size_t begin, size_t end, int threadIndex) {
+            HoppingCounts& local = counts[static_cast<size_t>(threadIndex)];
+            std::vector<uint64_t> jammed(SLOTS_PER_BLOCK * wordCount);
+            std::vector<uint32_t> packetHits(netCount);
+
+            for (size_t chunk = begin; chunk < end; ++chunk) {
+                const uint64_t chunkStart = static_cast<uint64_t>(chunk) * chunkHops;
+                const uint64_t chunkEnd = std::min(config.hopCount, chunkStart + chunkHops);
+                std::fill(packetHits.begin(), packetHits.end(), 0u);
+                size_t packetFill = 0;       // 当前数据包已经过的跳数，对所有网相同
+
+                for (uint64_t blockStart = chunkStart; blockStart < chunkEnd; blockStart += SLOTS_PER_BLOCK) {
+                    const size_t slots = static_cast<size_t>(std::min<uint64_t>(SLOTS_PER_BLOCK, chunkEnd - blockStart));
+                    for (size_t s = 0; s < slots; ++s) {
+                        uint64_t* words = &jammed[s * wordCount];
+                        calculateJammedChannels(config.jammers, blockStart + s, words);
+                        for (size_t w = 0; w < wordCount; ++w) local.jammedChannels += popcount64(words[w]);
+                    }
+
+                    for (size_t net = 0; net < netCount; ++net) {
+                        uint64_t hitWord = 0;
+                        for (size_t s = 0; s < slots; ++s) {
+                            size_t channel = static_cast<size_t>(selectChannel(net, blockStart + s));
+                            uint64_t bit = (jammed[s * wordCount + channel / 64] >> (channel % 64)) & 1ULL;
+                            hitWord |= bit << s;
+                        }
+                        local.hits[net] += popcount64(hitWord);
+
+                        size_t position = 0;
+                        size_t fill = packetFill;
+                        uint32_t hits = packetHits[net];
+                        while (position < slots) {
+                            size_t take = std::min(hopsPerPacket - fill, slots - position);
+                            hits += static_cast<uint32_t>(popcount64((hitWord >> position) & lowMask(take)));
+                            position += take;
+                            fill += take;
+                            if (fill == hopsPerPacket) {
+                                if (hits > static_cast<uint32_t>(config.toleratedHits)) ++local.lostPackets[net];
+                                hits = 0;
+                                fill = 0;
+                            }
+                        }
+                        packetHits[net] = hits;
+                    }
+                    packetFill = (packetFill + slots) % hopsPerPacket;
+                }
+            }
+        });
+
+    result.hopCount = config.hopCount * netCount;
+    result.hitCount = 0;
+    result.packetCount = (config.hopCount / hopsPerPacket) * netCount;
+    result.lostPacketCount = 0;
+    result.netHitRates.assign(netCount, 0.0);
+    uint64_t jammedChannels = 0;
+    for (size_t net = 0; net < netCount; ++net) {
+        uint64_t hits = 0;
+        for (const auto& threadCounts : counts) {
+            hits += threadCounts.hits[net];
+            result.lostPacketCount += threadCounts.lostPackets[net];
+        }
+        result.hitCount += hits;
+        result.netHitRates[net] = static_cast<double>(hits) / static_cast<double>(config.hopCount);
+    }
+    for (const auto& threadCounts : counts) jammedChannels += threadCounts.jammedChannels;
+    result.jammedChannelFraction = static_cast<double>(jammedChannels) /
+                                   (static_cast<double>(config.hopCount) * channelCount_);
+    return true;
+}
@@ -0,0 +1,104 @@
+#include "CommunicationJammerAggregator.h"
+#include "CommunicationParallelExecutor.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    // 独立累加器个数：浮点加法不可重排，多路累加器使相邻干扰源的求和可以并行
+    constexpr size_t ACCUMULATOR_LANES = 4;
+}
+
+CommunicationJammerAggregator::CommunicationJammerAggregator(const CommunicationJammerEmitter* jammers, size_t count,
+                                                             int threadCount)
+    : threadCount_(threadCount) {
+    if (count > 0 && !jammers) {
+        throw std::invalid_argument("干扰源数组为空");
+    }
+    x_.resize(count);
+    y_.resize(count);
+    lowEdge_.resize(count);
+    highEdge_.resize(count);
+    spectralGain_.resize(count);
+    for (size_t j = 0; j < count; ++j) {
+        const CommunicationJammerEmitter& jammer = jammers[j];
+        if (!isEmitterValid(jammer)) {
+            throw std::invalid_argument("干扰源参数无效：坐标与功率须为有限值，频率与带宽须为正");
+        }
+        x_[j] = jammer.x;
+        y_[j] = jammer.y;
+        lowEdge_[j] = jammer.frequency - jammer.bandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR;
+        highEdge_[j] = jammer.frequency + jammer.bandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR;
+        const double unitDistancePower = jammer.power -
+                                         MathConstants::FSPL_FREQUENCY_COEFFICIENT * std::log10(jammer.frequency) -
+                                         MathConstants::FSPL_CONSTANT;
+        spectralGain_[j] = std::pow(10.0, unitDistancePower / MathConstants::LINEAR_TO_DB_MULTIPLIER) / jammer.bandwidth;
+    }
+}
+
+bool CommunicationJammerAggregator::isEmitterValid(const CommunicationJammerEmitter& jammer) {
+    return std::isfinite(jammer.x) && std::isfinite(jammer.y) && std::isfinite(jammer.power) &&
+           std::isfinite(jammer.frequency) && jammer.frequency > 0.0 &&
+           std::isfinite(jammer.bandwidth) && jammer.bandwidth > 0.0;
+}
+
+/// @brief 计算单个接收点的干扰总功率
+/// @details 重叠带宽 = max(0, min(上边沿) - max(下边沿))，距离平方下限为MIN_DISTANCE_LIMIT²；
+///          干扰源按ACCUMULATOR_LANES路交错累加，末尾不足一组的干扰源单独累加
+double CommunicationJammerAggregator::calculateInterferencePower(double x, double y, double lowEdge, double highEdge,
+                                                                 uint32_t* activeCount) const {
+    const size_t count = x_.size();
+    const double* jx = x_.data();
+    const double* jy = y_.data();
+    const double* low = lowEdge_.data();
+    const double* high = highEdge_.data();
+    const double* gain = spectralGain_.data();
+    const double minDistanceSquared = MathConstants::MIN_DISTANCE_LIMIT * MathConstants::MIN_DISTANCE_LIMIT;
+
+    double sums[ACCUMULATOR_LANES] = {};
+    uint32_t actives[ACCUMULATOR_LANES] = {};
+    size_t j = 0;
+    for (; j + ACCUMULATOR_LANES <= count; j += ACCUMULATOR_LANES) {
+        for (size_t lane = 0; lane < ACCUMULATOR_LANES; ++lane) {
+            const size_t k = j + lane;
+            const double dx = x - jx[k];
+            const double dy = y - jy[k];
+            const double distanceSquared = std::max(dx * dx + dy * dy, minDistanceSquared);
+            const double overlap = std::max(0.0, std::min(highEdge, high[k]) - std::max(lowEdge, low[k]));
+            sums[lane] += gain[k] * overlap / distanceSquared;
+            actives[lane] += overlap > 0.0 ? 1u : 0u;
+        }
+    }
+
+    double total = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    uint32_t active = actives[0] + actives[1] + actives[2] + actives[3];
+    for (; j < count; ++j) {
+        const double dx = x - jx[j];
+        const double dy = y - jy[j];
+        const double distanceSquared = std::max(dx * dx + dy * dy, minDistanceSquared);
+        const double overlap = std::max(0.0, std::min(highEdge, high[j]) - std::max(lowEdge, low[j]));
+        total += gain[j] * overlap / distanceSquared;
+        active += overlap > 0.0 ? 1u : 0u;
+    }
+
+    if (activeCount) *activeCount = active;
+    return total;
+}
+
+void CommunicationJammerAggregator::calculateInterferencePowerBatch(const std::pair<double, double>* receivers,
+                                                                    size_t count, double lowEdge, double highEdge,
+                                                                    double* powers, uint32_t* activeCounts) const {
+    if (count == 0) return;
+    // 按接收点与干扰源的组合数分配线程，干扰源较少时避免为少量计算启动线程
+    const size_t pairCount = count * std::max<size_t>(x_.size(), 1);
+    int threads = CommunicationParallelExecutor::resolveThreadCount(
+        threadCount_, pairCount, static_cast<size_t>(MathConstants::JAMMER_AGGREGATION_MIN_PAIRS_PER_THREAD));
+    if (static_cast<size_t>(threads) > count) threads = static_cast<int>(count);
+    CommunicationParallelExecutor::parallelFor(count, threads, [&](size_t begin, size_t end, int) {
+        for (size_t i = begin; i < end; ++i) {
+            powers[i] = calculateInterferencePower(receivers[i].first, receivers[i].second, lowEdge, highEdge,
+                                                   activeCounts ? activeCounts + i : nullptr);
+        }
+    });
+}
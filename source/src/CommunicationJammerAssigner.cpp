@@ -0,0 +1,275 @@
+#include "CommunicationJammerAssigner.h"
+#include "CommunicationJammerBank.h"
+#include "CommunicationJammerParameterConfig.h"
+#include "CommunicationParallelExecutor.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief 功率预算分配的候选配对，按单位功率的边际收益排序
+     */
+    struct AssignmentCandidate {
+        double density;                  // 边际收益 / 功率 (1/W)
+        double gain;                     // 边际收益
+        size_t jammer;
+        size_t target;
+
+        bool operator<(const AssignmentCandidate& other) const {
+            if (density != other.density) return density < other.density;
+            if (jammer != other.jammer) return jammer > other.jammer;
+            return target > other.target;
+        }
+    };
+
+    double toWatts(double power_dBm) {
+        return std::pow(10.0, (power_dBm - MathConstants::DBM_TO_WATTS_OFFSET) / MathConstants::LINEAR_TO_DB_MULTIPLIER);
+    }
+
+    /// @brief 求解rows×cols（rows不大于cols）代价矩阵的最小代价完美匹配
+    /// @details 带势函数的匈牙利算法，逐行加入并沿最短增广路调整匹配，复杂度O(rows²·cols)
+    /// @return 各行匹配的列号
+    std::vector<size_t> solveMinimumCostMatching(const std::vector<double>& cost, size_t rows, size_t cols) {
+        const double INF = std::numeric_limits<double>::infinity();
+        // 下标从1开始，第0列作为每轮增广的虚拟起点
+        std::vector<double> rowPotential(rows + 1, 0.0), columnPotential(cols + 1, 0.0);
+        std::vector<size_t> columnMatch(cols + 1, 0), previous(cols + 1, 0);
+        std::vector<double> slack(cols + 1);
+        std::vector<char> visited(cols + 1);
+        for (size_t row = 1; row <= rows; ++row) {
+            columnMatch[0] = row;
+            size_t column = 0;
+            std::fill(slack.begin(), slack.end(), INF);
+            std::fill(visited.begin(), visited.end(), 0);
+            do {
+                visited[column] = 1;
+                const size_t current = columnMatch[column];
+                double delta = INF;
+                size_t next = 0;
+                for (size_t j = 1; j <= cols; ++j) {
+                    if (visited[j]) continue;
+                    const double reduced = cost[(current - 1) * cols + (j - 1)] - rowPotential[current] - columnPotential[j];
+                    if (reduced < slack[j]) {
+                        slack[j] = reduced;
+                        previous[j] = column;
+                    }
+                    if (slack[j] < delta) {
+                        delta = slack[j];
+                        next = j;
+                    }
+                }
+                for (size_t j = 0; j <= cols; ++j) {
+                    if (visited[j]) {
+                        rowPotential[columnMatch[j]] += delta;
+                        columnPotential[j] -= delta;
+                    } else {
+                        slack[j] -= delta;
+                    }
+                }
+                column = next;
+            } while (columnMatch[column] != 0);
+            // 沿增广路翻转匹配
+            do {
+                const size_t prior = previous[column];
+                columnMatch[column] = columnMatch[prior];
+                column = prior;
+            } while (column != 0);
+        }
+
+        std::vector<size_t> rowMatch(rows);
+        for (size_t j = 1; j <= cols; ++j) {
+            if (columnMatch[j] != 0) rowMatch[columnMatch[j] - 1] = j - 1;
+        }
+        return rowMatch;
+    }
+}
+
+CommunicationJammerAssigner::CommunicationJammerAssigner(const CommunicationJammerModel& jammerModel,
+                                                         const std::vector<CommunicationAssignmentJammer>& jammers,
+                                                         const std::vector<CommunicationAssignmentTarget>& targets,
+                                                         int threadCount)
+    : targets_(targets), threadCount_(threadCount) {
+    jammers_.reserve(jammers.size());
+    jammerPositions_.reserve(jammers.size());
+    for (const CommunicationAssignmentJammer& jammer : jammers) {
+        if (!std::isfinite(jammer.x) || !std::isfinite(jammer.y)) {
+            throw std::invalid_argument("干扰机坐标须为有限值");
+        }
+        CommunicationJammerModel model = jammerModel;
+        model.setJammerType(jammer.type);
+        if (!model.setJammerPower(jammer.power) || !model.setJammerFrequency(jammer.frequency) ||
+            !model.setJammerBandwidth(jammer.bandwidth)) {
+            throw std::invalid_argument("干扰机的功率、频率或带宽超出干扰模型的有效范围");
+        }
+        jammers_.push_back(model);
+        jammerPositions_.emplace_back(jammer.x, jammer.y);
+    }
+
+    // 目标参数按干扰模型的目标信号参数范围校验
+    CommunicationJammerModel probe = jammerModel;
+    for (const CommunicationAssignmentTarget& target : targets_) {
+        if (!std::isfinite(target.x) || !std::isfinite(target.y)) {
+            throw std::invalid_argument("目标坐标须为有限值");
+        }
+        if (!probe.setTargetFrequency(target.frequency) || !probe.setTargetBandwidth(target.bandwidth) ||
+            !probe.setTargetPower(target.power)) {
+            throw std::invalid_argument("目标的频率、带宽或功率超出干扰模型的有效范围");
+        }
+    }
+}
+
+/// @brief 并行计算干扰有效性矩阵
+/// @details 按目标分给工作线程，每个线程复用一个干扰机组：逐目标重新填入全部干扰机与该目标的参数，
+///          批量求出一列后写入矩阵。干扰距离限制在干扰模型的有效作用距离范围内
+void CommunicationJammerAssigner::calculateEffectivenessMatrix(double* matrix) const {
+    const size_t jammerCount = jammers_.size();
+    const size_t targetCount = targets_.size();
+    if (jammerCount == 0 || targetCount == 0) return;
+
+    int threads = CommunicationParallelExecutor::resolveThreadCount(
+        threadCount_, jammerCount * targetCount, static_cast<size_t>(MathConstants::JAMMER_ASSIGNMENT_MIN_PAIRS_PER_THREAD));
+    if (static_cast<size_t>(threads) > targetCount) threads = static_cast<int>(targetCount);
+    CommunicationParallelExecutor::parallelFor(targetCount, threads, [&](size_t begin, size_t end, int) {
+        CommunicationJammerBank bank;
+        std::vector<double> column(jammerCount);
+        for (size_t t = begin; t < end; ++t) {
+            const CommunicationAssignmentTarget& target = targets_[t];
+            bank.clear();
+            for (size_t j = 0; j < jammerCount; ++j) {
+                const double distance = std::min(CommunicationJammerParameterConfig::MAX_RANGE,
+                    std::max(CommunicationJammerParameterConfig::MIN_RANGE,
+                             std::hypot(jammerPositions_[j].first - target.x, jammerPositions_[j].second - target.y)));
+                bank.add(jammers_[j], target.frequency, target.bandwidth, target.power, distance);
+            }
+            bank.calculateEffectiveness(column.data());
+            for (size_t j = 0; j < jammerCount; ++j) {
+                matrix[j * targetCount + t] = column[j];
+            }
+        }
+    });
+}
+
+/// @brief 构建干扰有效性矩阵并按配置求解分配
+/// @details 分配完成后按 1 - Π(1 - 有效性) 汇总各目标的综合干扰有效性，
+///          消耗功率为各配对中干扰机发射功率之和
+bool CommunicationJammerAssigner::assign(const CommunicationAssignmentConfig& config,
+                                         CommunicationAssignmentResult& result) const {
+    if (config.mode == JammerAssignmentMode::POWER_BUDGET) {
+        if (!(config.powerBudget >= 0.0) || config.maxTargetsPerJammer < 1) return false;
+    } else if (config.mode != JammerAssignmentMode::ONE_TO_ONE) {
+        return false;
+    }
+
+    result.jammerCount = jammers_.size();
+    result.targetCount = targets_.size();
+    result.effectiveness.assign(result.jammerCount * result.targetCount, 0.0);
+    calculateEffectivenessMatrix(result.effectiveness.data());
+
+    result.assignments.clear();
+    if (config.mode == JammerAssignmentMode::ONE_TO_ONE) {
+        assignOneToOne(result);
+    } else {
+        assignWithPowerBudget(config.powerBudget, config.maxTargetsPerJammer, result);
+    }
+    std::sort(result.assignments.begin(), result.assignments.end());
+
+    std::vector<double> missProbability(result.targetCount, 1.0);
+    result.usedPower = 0.0;
+    for (const std::pair<size_t, size_t>& assignment : result.assignments) {
+        missProbability[assignment.second] *= 1.0 - result.at(assignment.first, assignment.second);
+        result.usedPower += toWatts(jammers_[assignment.first].getJammerPower());
+    }
+    result.targetEffectiveness.resize(result.targetCount);
+    result.totalEffectiveness = 0.0;
+    for (size_t t = 0; t < result.targetCount; ++t) {
+        result.targetEffectiveness[t] = 1.0 - missProbability[t];
+        result.totalEffectiveness += result.targetEffectiveness[t];
+    }
+    return true;
+}
+
+/// @brief 一对一分配
+/// @details 以负的干扰有效性为代价求最小代价匹配，干扰机多于目标时按转置矩阵求解；
+///          有效性为0的配对不计入分配
+void CommunicationJammerAssigner::assignOneToOne(CommunicationAssignmentResult& result) const {
+    const size_t jammerCount = result.jammerCount;
+    const size_t targetCount = result.targetCount;
+    if (jammerCount == 0 || targetCount == 0) return;
+
+    const bool transposed = jammerCount > targetCount;
+    const size_t rows = transposed ? targetCount : jammerCount;
+    const size_t cols = transposed ? jammerCount : targetCount;
+    std::vector<double> cost(rows * cols);
+    for (size_t j = 0; j < jammerCount; ++j) {
+        for (size_t t = 0; t < targetCount; ++t) {
+            const double value = -result.at(j, t);
+            if (transposed) {
+                cost[t * cols + j] = value;
+            } else {
+                cost[j * cols + t] = value;
+            }
+        }
+    }
+
+    const std::vector<size_t> match = solveMinimumCostMatching(cost, rows, cols);
+    for (size_t row = 0; row < rows; ++row) {
+        const size_t jammer = transposed ? match[row] : row;
+        const size_t target = transposed ? row : match[row];
+        if (result.at(jammer, target) > 0.0) {
+            result.assignments.emplace_back(jammer, target);
+        }
+    }
+}
+
+/// @brief 功率预算下的多对多分配
+/// @details 目标的综合有效性 1 - Π(1 - 有效性) 对配对集合是次模的，按边际收益/功率的延迟贪心求解：
+///          堆顶候选的边际收益按当前状态重算，未下降则接受，否则以新收益放回堆中。
+///          干扰机达到目标数上限或其功率超过剩余预算时，其候选被丢弃
+void CommunicationJammerAssigner::assignWithPowerBudget(double powerBudget, int maxTargetsPerJammer,
+                                                        CommunicationAssignmentResult& result) const {
+    const size_t jammerCount = result.jammerCount;
+    const size_t targetCount = result.targetCount;
+    std::vector<double> jammerCost(jammerCount);
+    for (size_t j = 0; j < jammerCount; ++j) {
+        jammerCost[j] = toWatts(jammers_[j].getJammerPower());
+    }
+
+    std::vector<AssignmentCandidate> candidates;
+    for (size_t j = 0; j < jammerCount; ++j) {
+        if (jammerCost[j] > powerBudget) continue;
+        for (size_t t = 0; t < targetCount; ++t) {
+            const double value = result.at(j, t);
+            if (value > 0.0) {
+                candidates.push_back({value / jammerCost[j], value, j, t});
+            }
+        }
+    }
+    std::priority_queue<AssignmentCandidate> queue(std::less<AssignmentCandidate>(), std::move(candidates));
+
+    std::vector<double> missProbability(targetCount, 1.0);
+    std::vector<int> jammerLoad(jammerCount, 0);
+    double remainingBudget = powerBudget;
+    while (!queue.empty()) {
+        const AssignmentCandidate candidate = queue.top();
+        queue.pop();
+        if (jammerLoad[candidate.jammer] >= maxTargetsPerJammer || jammerCost[candidate.jammer] > remainingBudget) {
+            continue;
+        }
+        const double value = result.at(candidate.jammer, candidate.target);
+        const double gain = missProbability[candidate.target] * value;
+        if (gain < candidate.gain) {
+            if (gain > 0.0) {
+                queue.push({gain / jammerCost[candidate.jammer], gain, candidate.jammer, candidate.target});
+            }
+            continue;
+        }
+        missProbability[candidate.target] *= 1.0 - value;
+        ++jammerLoad[candidate.jammer];
+        remainingBudget -= jammerCost[candidate.jammer];
+        result.assignments.emplace_back(candidate.jammer, candidate.target);
+    }
+}
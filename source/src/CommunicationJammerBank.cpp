@@ -0,0 +1,267 @@
+#include "CommunicationJammerBank.h"
+#include "CommunicationVectorMath.h"
+#include "MathConstants.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // 每次批量求值的干扰机数，中间数组放在栈上并保持在一级缓存内
+    constexpr size_t BLOCK_SIZE = 256;
+    constexpr double KHZ_PER_MHZ = 1000.0;
+
+    double overlapFraction(double jammerFrequency, double jammerBandwidth,
+                           double targetFrequency, double targetBandwidth) {
+        const double low = std::max(jammerFrequency - jammerBandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR,
+                                    targetFrequency - targetBandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR);
+        const double high = std::min(jammerFrequency + jammerBandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR,
+                                     targetFrequency + targetBandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR);
+        return std::max(0.0, high - low) / targetBandwidth;
+    }
+}
+
+constexpr int CommunicationJammerBank::JAMMER_TYPE_COUNT;
+constexpr int CommunicationJammerBank::GROUP_COUNT;
+
+CommunicationJammerBank::CommunicationJammerBank() : size_(0) {}
+
+/// @brief 由干扰模型列表构造干扰机组
+/// @details 先统计各组的干扰机数并预留列的容量，避免逐台加入时反复扩容
+CommunicationJammerBank::CommunicationJammerBank(const std::vector<CommunicationJammerModel>& jammers) : size_(0) {
+    size_t groupSizes[GROUP_COUNT] = {};
+    for (const CommunicationJammerModel& jammer : jammers) {
+        ++groupSizes[getGroupIndex(jammer.jammerType)];
+    }
+    for (int g = 0; g < GROUP_COUNT; ++g) {
+        Group& group = groups_[g];
+        for (std::vector<double>* column : {&group.jammerPower, &group.jammerFrequency, &group.jammerBandwidth,
+                                            &group.targetFrequency, &group.targetBandwidth, &group.targetPower,
+                                            &group.distance, &group.atmosphericLoss, &group.dutyCycle,
+                                            &group.sweepRange}) {
+            column->reserve(groupSizes[g]);
+        }
+        group.indices.reserve(groupSizes[g]);
+    }
+    for (const CommunicationJammerModel& jammer : jammers) {
+        add(jammer);
+    }
+}
+
+int CommunicationJammerBank::getGroupIndex(JammerType type) {
+    const int index = static_cast<int>(type);
+    return index >= 0 && index < JAMMER_TYPE_COUNT ? index : JAMMER_TYPE_COUNT;
+}
+
+void CommunicationJammerBank::add(const CommunicationJammerModel& jammer) {
+    add(jammer, jammer.targetFrequency, jammer.targetBandwidth, jammer.targetSignalTransmitPower_dBm,
+        jammer.jammerToTargetDistance);
+}
+
+void CommunicationJammerBank::add(const CommunicationJammerModel& jammer, double targetFrequency,
+                                  double targetBandwidth, double targetPower, double distance) {
+    Group& group = groups_[getGroupIndex(jammer.jammerType)];
+    group.jammerPower.push_back(jammer.jammerTransmitPower_dBm);
+    group.jammerFrequency.push_back(jammer.jammerFrequency_kHz);
+    group.jammerBandwidth.push_back(jammer.jammerBandwidth);
+    group.targetFrequency.push_back(targetFrequency);
+    group.targetBandwidth.push_back(targetBandwidth);
+    group.targetPower.push_back(targetPower);
+    group.distance.push_back(distance);
+    group.atmosphericLoss.push_back(jammer.atmosphericLoss);
+    group.dutyCycle.push_back(jammer.dutyCycle);
+    group.sweepRange.push_back(jammer.sweepRange);
+    group.indices.push_back(size_++);
+}
+
+void CommunicationJammerBank::clear() {
+    for (Group& group : groups_) {
+        for (std::vector<double>* column : {&group.jammerPower, &group.jammerFrequency, &group.jammerBandwidth,
+                                            &group.targetFrequency, &group.targetBandwidth, &group.targetPower,
+                                            &group.distance, &group.atmosphericLoss, &group.dutyCycle,
+                                            &group.sweepRange}) {
+            column->clear();
+        }
+        group.indices.clear();
+    }
+    size_ = 0;
+}
+
+size_t CommunicationJammerBank::getGroupSize(JammerType type) const {
+    return groups_[getGroupIndex(type)].indices.size();
+}
+
+/// @brief 计算一组干扰机中[begin, end)区间的干扰有效性与有效干扰功率
+/// @details 先批量求距离与频率的对数得到两条路径的自由空间损耗，进而得到有效干扰功率与干信比；
+///          再按组的干扰类型逐元素求功率因子的指数，最后批量求10的幂并组合各因子。
+///          各公式与CommunicationJammerModel中对应的calculate*Effect()逐项相同
+/// @param effectiveness 输出的干扰有效性，长度为end - begin
+/// @param effectivePower 输出的有效干扰功率 (dBm)，长度为end - begin
+void CommunicationJammerBank::evaluateGroup(int groupIndex, const Group& group, size_t begin, size_t end,
+                                            double* effectiveness, double* effectivePower) {
+    const size_t count = end - begin;
+    const double* power = group.jammerPower.data() + begin;
+    const double* jammerFrequency = group.jammerFrequency.data() + begin;
+    const double* jammerBandwidth = group.jammerBandwidth.data() + begin;
+    const double* targetFrequency = group.targetFrequency.data() + begin;
+    const double* targetBandwidth = group.targetBandwidth.data() + begin;
+    const double* targetPower = group.targetPower.data() + begin;
+    const double* distance = group.distance.data() + begin;
+    const double* atmosphericLoss = group.atmosphericLoss.data() + begin;
+    const double* dutyCycle = group.dutyCycle.data() + begin;
+    const double* sweepRange = group.sweepRange.data() + begin;
+
+    double distanceLog[BLOCK_SIZE];
+    double jammerFrequencyLog[BLOCK_SIZE];
+    double targetFrequencyLog[BLOCK_SIZE];
+    double jammerPathLoss[BLOCK_SIZE];
+    double jammerToSignalRatio[BLOCK_SIZE];
+    double exponent[BLOCK_SIZE];
+
+    for (size_t i = 0; i < count; ++i) {
+        jammerFrequencyLog[i] = jammerFrequency[i] / KHZ_PER_MHZ;
+        targetFrequencyLog[i] = targetFrequency[i] / KHZ_PER_MHZ;
+    }
+    CommunicationVectorMath::log10Batch(distance, distanceLog, count);
+    CommunicationVectorMath::log10Batch(jammerFrequencyLog, jammerFrequencyLog, count);
+    CommunicationVectorMath::log10Batch(targetFrequencyLog, targetFrequencyLog, count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const double distanceLoss = MathConstants::FSPL_DISTANCE_COEFFICIENT * distanceLog[i];
+        jammerPathLoss[i] = distanceLoss + MathConstants::FSPL_FREQUENCY_COEFFICIENT * jammerFrequencyLog[i] +
+                            MathConstants::FSPL_CONSTANT;
+        const double signalPathLoss = distanceLoss + MathConstants::FSPL_FREQUENCY_COEFFICIENT * targetFrequencyLog[i] +
+                                      MathConstants::FSPL_CONSTANT;
+        effectivePower[i] = power[i] - jammerPathLoss[i] - atmosphericLoss[i];
+        jammerToSignalRatio[i] = effectivePower[i] - (targetPower[i] - signalPathLoss - atmosphericLoss[i]);
+    }
+
+    const JammerType type = static_cast<JammerType>(groupIndex);
+    if (groupIndex == JAMMER_TYPE_COUNT) {
+        std::fill(effectiveness, effectiveness + count, 0.0);
+        return;
+    }
+
+    // 功率因子 = min(MAX_POWER_FACTOR, 10^exponent)，各类型的区别只在指数与组合方式
+    double scale = MathConstants::LINEAR_TO_DB_MULTIPLIER;
+    if (type == JammerType::GAUSSIAN_NOISE) scale = MathConstants::FSPL_DISTANCE_COEFFICIENT;
+    if (type == JammerType::SWEEP_FREQUENCY) scale = MathConstants::PULSE_POWER_DIVISOR;
+    if (type == JammerType::BARRAGE) scale = MathConstants::BARRAGE_POWER_DIVISOR;
+
+    if (type == JammerType::PULSE) {
+        for (size_t i = 0; i < count; ++i) {
+            exponent[i] = MathConstants::PULSE_POWER_BASE / dutyCycle[i];
+        }
+        CommunicationVectorMath::log10Batch(exponent, exponent, count);
+        for (size_t i = 0; i < count; ++i) {
+            const double pulsePower = power[i] + MathConstants::LINEAR_TO_DB_MULTIPLIER * exponent[i];
+            exponent[i] = (pulsePower - jammerPathLoss[i] - targetPower[i]) / MathConstants::LINEAR_TO_DB_MULTIPLIER;
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            exponent[i] = jammerToSignalRatio[i] / scale;
+        }
+    }
+    CommunicationVectorMath::exp10Batch(exponent, exponent, count);
+    for (size_t i = 0; i < count; ++i) {
+        exponent[i] = std::min(MathConstants::MAX_POWER_FACTOR, exponent[i]);
+    }
+    const double* powerFactor = exponent;
+
+    switch (type) {
+        case JammerType::GAUSSIAN_NOISE:
+            for (size_t i = 0; i < count; ++i) {
+                effectiveness[i] = overlapFraction(jammerFrequency[i], jammerBandwidth[i],
+                                                   targetFrequency[i], targetBandwidth[i]) * powerFactor[i];
+            }
+            break;
+        case JammerType::NARROWBAND:
+        case JammerType::SPOT: {
+            // 频率因子exp(-|Δf|/B)按10^(-|Δf|/B·log10(e))批量求值
+            double frequencyFactor[BLOCK_SIZE];
+            for (size_t i = 0; i < count; ++i) {
+                frequencyFactor[i] = -std::fabs(jammerFrequency[i] - targetFrequency[i]) / targetBandwidth[i] *
+                                     MathConstants::LOG10_E;
+            }
+            CommunicationVectorMath::exp10Batch(frequencyFactor, frequencyFactor, count);
+            const double enhancement = type == JammerType::SPOT ? MathConstants::SPOT_ENHANCEMENT_FACTOR : 1.0;
+            const double limit = type == JammerType::SPOT ? MathConstants::MAX_SPOT_EFFECT : HUGE_VAL;
+            for (size_t i = 0; i < count; ++i) {
+                effectiveness[i] = std::min(limit, frequencyFactor[i] * powerFactor[i] * enhancement);
+            }
+            break;
+        }
+        case JammerType::SWEEP_FREQUENCY:
+            for (size_t i = 0; i < count; ++i) {
+                const double sweptBandwidth = sweepRange[i] * MathConstants::FREQUENCY_SCALE_FACTOR;
+                const double coverage = std::min(MathConstants::MAX_COVERAGE, sweptBandwidth / targetBandwidth[i]);
+                const double timeFactor = std::min(MathConstants::MAX_TIME_FACTOR, targetBandwidth[i] / sweptBandwidth);
+                effectiveness[i] = coverage * timeFactor * powerFactor[i];
+            }
+            break;
+        case JammerType::PULSE:
+            for (size_t i = 0; i < count; ++i) {
+                effectiveness[i] = overlapFraction(jammerFrequency[i], jammerBandwidth[i],
+                                                   targetFrequency[i], targetBandwidth[i]) *
+                                   dutyCycle[i] * powerFactor[i];
+            }
+            break;
+        case JammerType::BARRAGE:
+            for (size_t i = 0; i < count; ++i) {
+                effectiveness[i] = std::min(MathConstants::MAX_COVERAGE, jammerBandwidth[i] / targetBandwidth[i]) *
+                                   powerFactor[i];
+            }
+            break;
+    }
+}
+
+void CommunicationJammerBank::calculateEffectiveness(double* effectiveness, double* effectivePower) const {
+    double blockEffectiveness[BLOCK_SIZE];
+    double blockPower[BLOCK_SIZE];
+    for (int g = 0; g < GROUP_COUNT; ++g) {
+        const Group& group = groups_[g];
+        const size_t count = group.indices.size();
+        for (size_t begin = 0; begin < count; begin += BLOCK_SIZE) {
+            const size_t end = std::min(count, begin + BLOCK_SIZE);
+            evaluateGroup(g, group, begin, end, blockEffectiveness, blockPower);
+            for (size_t i = begin; i < end; ++i) {
+                effectiveness[group.indices[i]] = blockEffectiveness[i - begin];
+                if (effectivePower) effectivePower[group.indices[i]] = blockPower[i - begin];
+            }
+        }
+    }
+}
+
+/// @brief 计算按干扰有效性加权的干扰总功率
+/// @details 逐组逐块求和，不需要按加入顺序重排
+double CommunicationJammerBank::calculateWeightedJammerPower() const {
+    double blockEffectiveness[BLOCK_SIZE];
+    double blockPower[BLOCK_SIZE];
+    double total = 0.0;
+    for (int g = 0; g < GROUP_COUNT; ++g) {
+        const Group& group = groups_[g];
+        const size_t count = group.indices.size();
+        for (size_t begin = 0; begin < count; begin += BLOCK_SIZE) {
+            const size_t blockCount = std::min(count, begin + BLOCK_SIZE) - begin;
+            evaluateGroup(g, group, begin, begin + blockCount, blockEffectiveness, blockPower);
+            for (size_t i = 0; i < blockCount; ++i) {
+                blockPower[i] /= MathConstants::LINEAR_TO_DB_MULTIPLIER;
+            }
+            CommunicationVectorMath::exp10Batch(blockPower, blockPower, blockCount);
+            for (size_t i = 0; i < blockCount; ++i) {
+                total += blockPower[i] * blockEffectiveness[i];
+            }
+        }
+    }
+    return total;
+}
+
+/// @brief 计算多干扰机协同效果
+/// @details 协同干信比 = 10·log10(加权干扰总功率) - 目标信号功率，
+///          协同效果 = min(MAX_COMBINED_EFFECT, 1 - 1 / (1 + 10^(协同干信比/10)))
+double CommunicationJammerBank::calculateCombinedEffect(double targetPower_dBm) const {
+    const double totalPower_dBm = MathConstants::LINEAR_TO_DB_MULTIPLIER * std::log10(calculateWeightedJammerPower());
+    const double combinedRatio = totalPower_dBm - targetPower_dBm;
+    return std::min(MathConstants::MAX_COMBINED_EFFECT,
+                    MathConstants::COMBINED_EFFECT_BASE - MathConstants::COMBINED_EFFECT_BASE /
+                    (MathConstants::COMBINED_EFFECT_BASE +
+                     std::pow(10.0, combinedRatio / MathConstants::LINEAR_TO_DB_MULTIPLIER)));
+}
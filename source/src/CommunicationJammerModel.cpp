@@ -1,6 +1,7 @@
 #include "../header/CommunicationJammerModel.h"
 #include "../header/CommunicationJammerParameterConfig.h"
 #include "../header/CommunicationDistanceModel.h"
+#include "../header/CommunicationJammerBank.h"
 #include "../header/MathConstants.h"
 #include <sstream>
 #include <iomanip>
@@ -202,6 +203,8 @@ double CommunicationJammerModel::getPulseRepetitionRate() const { return pulseRe
 double CommunicationJammerModel::getDutyCycle() const { return dutyCycle; }
 double CommunicationJammerModel::getSweepRate() const { return sweepRate; }
 double CommunicationJammerModel::getSweepRange() const { return sweepRange; }
+double CommunicationJammerModel::getPropagationLoss() const { return propagationLoss; }
+double CommunicationJammerModel::getAtmosphericLoss() const { return atmosphericLoss; }
 
 /// @brief 计算传播损耗
 /// @details 传播损耗 = 20*log10(d) + 20*log10(f) + 32.45
@@ -247,12 +250,24 @@ double CommunicationJammerModel::calculateJammerEffectivePower() const {
 /// @details 干信比 = 有效干扰功率 - 目标信号功率
 /// @return 干信比(dB)
 double CommunicationJammerModel::calculateJammerToSignalRatio() const {
+    return calculateJammerToSignalRatioForTarget(targetFrequency);
+}
+
+/// @brief 按给定目标频率计算干扰干信比
+/// @details 频率无效时与setTargetFrequency失败一致，按当前目标频率计算。供批量求值时代替逐样本复制模型
+/// @param targetFreq_kHz 目标频率
+/// @return 干信比(dB)
+double CommunicationJammerModel::calculateJammerToSignalRatioForTarget(double targetFreq_kHz) const {
+    if (!isFrequencyValid(targetFreq_kHz)) {
+        targetFreq_kHz = targetFrequency;
+    }
+
     // 计算到达目标的有效干扰功率
     double jammer_path_loss = calculatePropagationLoss(jammerToTargetDistance, jammerFrequency_kHz);
     double effective_jammer_power = jammerTransmitPower_dBm - jammer_path_loss - atmosphericLoss;
     
     // 计算目标接收的信号功率（需要获取目标信号相关参数）
-    double signal_path_loss = calculatePropagationLoss(jammerToTargetDistance, targetFrequency);
+    double signal_path_loss = calculatePropagationLoss(jammerToTargetDistance, targetFreq_kHz);
     double received_signal_power = targetSignalTransmitPower_dBm - signal_path_loss - atmosphericLoss;
     
     // 计算干信比 (dB)：J/S = 有效干扰功率 - 接收信号功率
@@ -508,23 +523,12 @@ double CommunicationJammerModel::calculateOptimalJammerFrequency() const {
 }
 
 /// @brief 计算多干扰机协同效果
-/// @details 多干扰机协同效果 = 所有干扰机有效功率的线性组合
-/// @return 多干扰机协同效果(dB)
+/// @details 多干扰机协同效果 = 所有干扰机有效功率按干扰有效性加权后的线性组合，
+///          由CommunicationJammerBank按干扰类型分组批量计算
+/// @return 多干扰机协同效果(0-1)
 double CommunicationJammerModel::calculateCombinedJammerEffect(
     const std::vector<CommunicationJammerModel>& jammers) const {
-    
-    double total_jammer_power = 0.0;
-    
-    for (const auto& jammer : jammers) {
-        double jammer_power_linear = std::pow(10.0, jammer.calculateJammerEffectivePower() / MathConstants::LINEAR_TO_DB_MULTIPLIER);
-        double effectiveness = jammer.calculateJammerEffectiveness();
-        total_jammer_power += jammer_power_linear * effectiveness;
-    }
-    
-    double total_jammer_power_dBm = MathConstants::LINEAR_TO_DB_MULTIPLIER * log10(total_jammer_power);
-    double combined_js_ratio = total_jammer_power_dBm - this->targetSignalTransmitPower_dBm;
-    
-    return std::min(MathConstants::MAX_COMBINED_EFFECT, MathConstants::COMBINED_EFFECT_BASE - MathConstants::COMBINED_EFFECT_BASE / (MathConstants::COMBINED_EFFECT_BASE + std::pow(10.0, combined_js_ratio / MathConstants::LINEAR_TO_DB_MULTIPLIER)));
+    return CommunicationJammerBank(jammers).calculateCombinedEffect(this->targetSignalTransmitPower_dBm);
 }
 
 // 信息输出方法实现
@@ -588,6 +592,31 @@ double CommunicationJammerModel::calculateJammerCoverage() const {
     return MathConstants::PI * radius * radius; // 圆面积公式，单位km²
 }
 
+/// @brief 计算干扰有效性随目标距离的变化规律
+/// @details 干扰与目标信号按同一距离传播，干信比中的距离项相互抵消，因此除脉冲干扰外
+///          干扰有效性与距离无关，此时指数为0，系数与上限均为当前的干扰有效性。
+///          脉冲干扰的功率因子以目标信号发射功率为参考，随距离按d^-2下降，
+///          在功率因子饱和于MAX_POWER_FACTOR的近距离内保持上限不变
+/// @return 干扰有效性随距离的变化规律
+JammerDistanceLaw CommunicationJammerModel::calculateEffectivenessDistanceLaw() const {
+    JammerDistanceLaw law;
+    if (jammerType != JammerType::PULSE) {
+        law.coefficient = calculateJammerEffectiveness();
+        law.exponent = 0.0;
+        law.ceiling = law.coefficient;
+        return law;
+    }
+
+    // 与calculatePulseJammerEffect()相同的公式，路径损耗取1km处的值
+    double scale = calculateFrequencyOverlap() * dutyCycle;
+    double pulse_power = jammerTransmitPower_dBm + MathConstants::LINEAR_TO_DB_MULTIPLIER * log10(MathConstants::PULSE_POWER_BASE / dutyCycle);
+    double unit_distance_power = pulse_power - calculatePropagationLoss(1.0, jammerFrequency_kHz);
+    law.coefficient = scale * std::pow(10.0, (unit_distance_power - targetSignalTransmitPower_dBm) / MathConstants::LINEAR_TO_DB_MULTIPLIER);
+    law.exponent = MathConstants::FSPL_DISTANCE_COEFFICIENT / MathConstants::LINEAR_TO_DB_MULTIPLIER;
+    law.ceiling = scale * MathConstants::MAX_POWER_FACTOR;
+    return law;
+}
+
 std::string CommunicationJammerModel::getJammerEffectInfo() const {
     std::ostringstream oss;
     oss << std::fixed << std::setprecision(3);
@@ -0,0 +1,311 @@
+#include "CommunicationLinkEvaluator.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+// 构造函数
+CommunicationLinkEvaluator::CommunicationLinkEvaluator(CommunicationScenario scenario,
+                                                       const CommunicationEnvironment& environment,
+                                                       const JammingEnvironment& jammingEnv,
+                                                       const CommunicationJammerModel& jammerModel,
+                                                       const CommunicationAntiJamModel& antiJamModel)
+    : scenario_(scenario)
+    , environment_(environment)
+    , jammingEnv_(jammingEnv)
+    , jammerModel_(jammerModel)
+    , antiJamModel_(antiJamModel)
+    , baseJammerToSignalRatio_(0.0)
+    , baseAntiJamGain_(0.0) {
+
+    // 环境损耗配置在构造时一次性拷贝，计算过程中不再访问全局配置管理器
+    lossConfigs_[static_cast<int>(EnvironmentType::OPEN_FIELD)] =
+        EnvironmentLossConfigManager::getConfig(EnvironmentType::OPEN_FIELD);
+    lossConfigs_[static_cast<int>(EnvironmentType::URBAN_AREA)] =
+        EnvironmentLossConfigManager::getConfig(EnvironmentType::URBAN_AREA);
+    lossConfigs_[static_cast<int>(EnvironmentType::MOUNTAINOUS)] =
+        EnvironmentLossConfigManager::getConfig(EnvironmentType::MOUNTAINOUS);
+
+    // 基准环境下的干扰与抗干扰修正量只计算一次
+    if (jammingEnv_.isJammed) {
+        baseJammerToSignalRatio_ = jammerModel_.calculateJammerToSignalRatio();
+    }
+    if (scenario_ == CommunicationScenario::ANTI_JAM_COMMUNICATION) {
+        baseAntiJamGain_ = antiJamModel_.calculateAntiJamGain();
+    }
+}
+
+const EnvironmentLossConfig& CommunicationLinkEvaluator::getLossConfig(EnvironmentType envType) const {
+    int index = static_cast<int>(envType);
+    if (index < 0 || index >= ENVIRONMENT_TYPE_COUNT) {
+        // 与EnvironmentLossConfigManager一致：未知环境按开阔地处理
+        index = static_cast<int>(EnvironmentType::OPEN_FIELD);
+    }
+    return lossConfigs_[index];
+}
+
+/// @brief 计算干信比
+/// @details 干扰模型中仅目标频率随通信环境变化，频率与基准环境一致时直接使用预计算结果，
+///          否则在快照干扰模型上按该频率直接计算，不逐样本复制模型
+/// @param frequency 通信频率 (MHz)
+/// @return 干信比(dB)
+double CommunicationLinkEvaluator::calculateJammerToSignalRatio(double frequency) const {
+    if (frequency == environment_.frequency) {
+        return baseJammerToSignalRatio_;
+    }
+    return jammerModel_.calculateJammerToSignalRatioForTarget(frequency);
+}
+
+/// @brief 计算抗干扰增益
+/// @details 抗干扰增益中只有波束成形增益随系统带宽变化；发射功率与噪声功率只参与模型的参数校验，
+///          模型中这两项总是有效值（默认值有效，设置方法拒绝无效值），替换后校验结果不变，因此增益只取决于带宽。
+///          带宽与基准环境一致时直接使用预计算结果，否则在快照抗干扰模型上按该带宽直接计算
+/// @return 抗干扰增益(dB)
+double CommunicationLinkEvaluator::calculateAntiJamGain(double bandwidth) const {
+    if (bandwidth == environment_.bandwidth) {
+        return baseAntiJamGain_;
+    }
+    return antiJamModel_.calculateAntiJamGainForBandwidth(bandwidth);
+}
+
+/// @brief 计算总路径损耗
+/// @details 总路径损耗 = 自由空间损耗 + 环境路径损耗 + 环境损耗 + 频率因子损耗，
+///          与CommunicationDistanceModel::calculateTotalPathLoss一致，但log10(d)只计算一次
+double CommunicationLinkEvaluator::calculateTotalPathLoss(double distance, double frequency, EnvironmentType envType) const {
+    if (distance <= 0.0 || frequency <= 0.0) {
+        return 0.0;
+    }
+
+    const EnvironmentLossConfig& config = getLossConfig(envType);
+    double logDistance = std::log10(distance);
+
+    double freeSpacePathLoss = MathConstants::FSPL_DISTANCE_COEFFICIENT * logDistance +
+                               MathConstants::FSPL_FREQUENCY_COEFFICIENT * std::log10(frequency) +
+                               MathConstants::FSPL_CONSTANT;
+    double environmentPathLoss = MathConstants::LINEAR_TO_DB_MULTIPLIER *
+                                 (config.pathLossExponent - MathConstants::FREE_SPACE_PATH_LOSS_EXPONENT) * logDistance;
+    double frequencyFactorLoss = config.frequencyFactor *
+                                 std::log10(frequency / MathConstants::FREQUENCY_CONVERSION_FACTOR) *
+                                 MathConstants::FREQ_FACTOR_MULTIPLIER;
+
+    return freeSpacePathLoss + environmentPathLoss + config.environmentLoss + frequencyFactorLoss;
+}
+
+/// @brief 由信号强度和信噪比推导链路指标
+/// @details 线性信噪比与误码率各计算一次，吞吐量、延迟、丢包率、质量等级和连接状态均在此基础上推导
+CommunicationLinkStatus CommunicationLinkEvaluator::deriveLinkStatus(double signalStrength, double snr,
+                                                                     double bandwidth, double distance) {
+    CommunicationLinkStatus status;
+    status.signalStrength = signalStrength;
+    status.signalToNoiseRatio = snr;
+
+    // 误码率（BPSK）
+    double linearSnr = std::pow(MathConstants::LINEAR_TO_DB_MULTIPLIER, snr / MathConstants::LINEAR_TO_DB_MULTIPLIER);
+    double ber = MathConstants::BER_COEFFICIENT * std::erfc(std::sqrt(linearSnr));
+    ber = std::max(MathConstants::MIN_BER, std::min(MathConstants::MAX_BER, ber));
+    status.bitErrorRate = ber;
+
+    // 吞吐量
+    double theoreticalCapacity = bandwidth * std::log2(MathConstants::SHANNON_BASE + linearSnr);
+    double efficiency = MathConstants::EFFICIENCY_BASE - MathConstants::BER_EFFICIENCY_FACTOR * ber;
+    efficiency = std::max(MathConstants::MIN_EFFICIENCY, std::min(MathConstants::MAX_EFFICIENCY, efficiency));
+    status.throughput = theoreticalCapacity * efficiency;
+
+    // 延迟
+    status.latency = distance / MathConstants::SPEED_OF_LIGHT +
+                     MathConstants::DEFAULT_PROCESSING_DELAY +
+                     ber * MathConstants::RETRANSMISSION_DELAY_FACTOR;
+
+    // 丢包率
+    double packetErrorRate = MathConstants::UNITY - std::pow(MathConstants::UNITY - ber, MathConstants::PACKET_LENGTH_BITS);
+    status.packetLossRate = std::max(MathConstants::ZERO, std::min(MathConstants::UNITY, packetErrorRate));
+
+    status.quality = assessQuality(status.signalToNoiseRatio, status.bitErrorRate, status.packetLossRate);
+    status.isConnected = (status.signalToNoiseRatio > MathConstants::LOW_SNR_THRESHOLD &&
+                          status.bitErrorRate < MathConstants::CONNECTION_BER_THRESHOLD &&
+                          status.packetLossRate < MathConstants::CONNECTION_PACKET_LOSS_THRESHOLD);
+    return status;
+}
+
+/// @brief 读取列式参数中的第index个样本
+/// @details 空列保持env中原有取值
+void CommunicationLinkEvaluator::loadEnvironment(const CommunicationEnvironmentArrays& environments, size_t index,
+                                                 CommunicationEnvironment& env) {
+    if (environments.frequency) env.frequency = environments.frequency[index];
+    if (environments.bandwidth) env.bandwidth = environments.bandwidth[index];
+    if (environments.transmitPower) env.transmitPower = environments.transmitPower[index];
+    if (environments.noisePower) env.noisePower = environments.noisePower[index];
+    if (environments.distance) env.distance = environments.distance[index];
+    if (environments.environmentType) env.environmentType = environments.environmentType[index];
+}
+
+/// @brief 计算信噪比的干扰与抗干扰修正量
+/// @return 修正量(dB) = 抗干扰增益 - 干信比
+double CommunicationLinkEvaluator::calculateSnrCorrection(const CommunicationEnvironment& env) const {
+    double correction = 0.0;
+    if (jammingEnv_.isJammed) {
+        correction -= calculateJammerToSignalRatio(env.frequency);
+    }
+    if (scenario_ == CommunicationScenario::ANTI_JAM_COMMUNICATION) {
+        correction += calculateAntiJamGain(env.bandwidth);
+    }
+    return correction;
+}
+
+/// @brief 计算链路预算的距离系数
+/// @details 总路径损耗中只有自由空间损耗和环境路径损耗与距离有关，
+///          斜率 = FSPL距离系数 + 10·(路径损耗指数 - 2)，截距取1km处的取值
+LinkBudgetCoefficients CommunicationLinkEvaluator::calculateLinkBudgetCoefficients(const CommunicationEnvironment& env) const {
+    const EnvironmentLossConfig& config = getLossConfig(env.environmentType);
+
+    LinkBudgetCoefficients coefficients;
+    coefficients.signalAtUnitDistance = env.transmitPower - calculateTotalPathLoss(1.0, env.frequency, env.environmentType);
+    coefficients.snrAtUnitDistance = coefficients.signalAtUnitDistance - env.noisePower + calculateSnrCorrection(env);
+    coefficients.distanceSlope = MathConstants::FSPL_DISTANCE_COEFFICIENT +
+                                 MathConstants::LINEAR_TO_DB_MULTIPLIER *
+                                 (config.pathLossExponent - MathConstants::FREE_SPACE_PATH_LOSS_EXPONENT);
+    return coefficients;
+}
+
+/// @brief 计算位置相关的链路系数
+/// @details 距离系数中的信噪比已扣除基准干信比，这里将其加回，由调用方按接收点位置重新计入干扰
+PositionalLinkCoefficients CommunicationLinkEvaluator::calculatePositionalLinkCoefficients(const CommunicationEnvironment& env) const {
+    LinkBudgetCoefficients base = calculateLinkBudgetCoefficients(env);
+
+    PositionalLinkCoefficients coefficients;
+    coefficients.jammed = jammingEnv_.isJammed;
+    coefficients.jammerFreeSnrAtUnitDistance = base.snrAtUnitDistance;
+    coefficients.distanceSlope = base.distanceSlope;
+    coefficients.unitJammerToSignalRatio = 0.0;
+    if (coefficients.jammed) {
+        coefficients.jammerFreeSnrAtUnitDistance += calculateJammerToSignalRatio(env.frequency);
+        coefficients.unitJammerToSignalRatio = calculateUnitDistanceJammerToSignalRatio(env.frequency);
+    }
+    return coefficients;
+}
+
+/// @brief 计算单位距离干信比
+/// @details 在干扰模型副本上将干扰距离与信号距离均设为1km，不修改快照中的干扰模型
+double CommunicationLinkEvaluator::calculateUnitDistanceJammerToSignalRatio(double frequency) const {
+    CommunicationJammerModel jammer = jammerModel_;
+    jammer.setTargetDistance(1.0);
+    return jammer.calculateJammerToSignalRatio(1.0, frequency);
+}
+
+CommunicationLinkStatus CommunicationLinkEvaluator::evaluateValues(const CommunicationEnvironment& env) const {
+    // 信号强度与信噪比
+    double signalStrength = env.transmitPower - calculateTotalPathLoss(env.distance, env.frequency, env.environmentType);
+    double snr = signalStrength - env.noisePower + calculateSnrCorrection(env);
+
+    return deriveLinkStatus(signalStrength, snr, env.bandwidth, env.distance);
+}
+
+CommunicationLinkStatus CommunicationLinkEvaluator::evaluate(const CommunicationEnvironment& env, bool withDescription) const {
+    CommunicationLinkStatus status = evaluateValues(env);
+    if (withDescription) {
+        status.statusDescription = formatStatusDescription(status);
+    }
+    return status;
+}
+
+CommunicationLinkMetrics CommunicationLinkEvaluator::evaluateMetrics(const CommunicationEnvironment& env) const {
+    return toLinkMetrics(evaluateValues(env));
+}
+
+void CommunicationLinkEvaluator::evaluateBatch(const CommunicationEnvironment* environments, size_t count,
+                                               CommunicationLinkStatus* results, bool withDescription) const {
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = evaluate(environments[i], withDescription);
+    }
+}
+
+void CommunicationLinkEvaluator::evaluateBatch(const CommunicationEnvironmentArrays& environments,
+                                               CommunicationLinkStatus* results, bool withDescription) const {
+    // 未提供的列沿用基准环境参数
+    CommunicationEnvironment env = environment_;
+    for (size_t i = 0; i < environments.count; ++i) {
+        loadEnvironment(environments, i, env);
+        results[i] = evaluate(env, withDescription);
+    }
+}
+
+void CommunicationLinkEvaluator::evaluateMetricsBatch(const CommunicationEnvironment* environments, size_t count,
+                                                      CommunicationLinkMetrics* results) const {
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = evaluateMetrics(environments[i]);
+    }
+}
+
+void CommunicationLinkEvaluator::evaluateMetricsBatch(const CommunicationEnvironmentArrays& environments,
+                                                      CommunicationLinkMetrics* results) const {
+    CommunicationEnvironment env = environment_;
+    for (size_t i = 0; i < environments.count; ++i) {
+        loadEnvironment(environments, i, env);
+        results[i] = evaluateMetrics(env);
+    }
+}
+
+CommunicationLinkMetrics CommunicationLinkEvaluator::toLinkMetrics(const CommunicationLinkStatus& status) {
+    CommunicationLinkMetrics metrics;
+    metrics.signalStrength = static_cast<float>(status.signalStrength);
+    metrics.signalToNoiseRatio = static_cast<float>(status.signalToNoiseRatio);
+    metrics.bitErrorRate = static_cast<float>(status.bitErrorRate);
+    metrics.throughput = static_cast<float>(status.throughput);
+    metrics.latency = static_cast<float>(status.latency);
+    metrics.packetLossRate = static_cast<float>(status.packetLossRate);
+    metrics.quality = status.quality;
+    metrics.isConnected = status.isConnected;
+    return metrics;
+}
+
+double CommunicationLinkEvaluator::calculateAvailability(double snr) {
+    return MathConstants::UNITY / (MathConstants::UNITY +
+        std::exp(-(snr - MathConstants::AVAILABILITY_SNR_OFFSET) / MathConstants::AVAILABILITY_DIVISOR));
+}
+
+/// @brief 评估通信质量等级
+/// @details 按信噪比、误码率、丢包率综合评分
+CommunicationQuality CommunicationLinkEvaluator::assessQuality(double snr, double ber, double packetLoss) {
+    int score = 0;
+
+    // 信噪比评分
+    if (snr > MathConstants::HIGH_SNR_THRESHOLD) score += 2;
+    else if (snr > MathConstants::MEDIUM_SNR_THRESHOLD) score += 1;
+    else if (snr < MathConstants::LOW_SNR_THRESHOLD) score -= 1;
+
+    // 误码率评分
+    if (ber < MathConstants::EXCELLENT_BER_THRESHOLD) score += 2;
+    else if (ber < MathConstants::GOOD_BER_THRESHOLD) score += 1;
+    else if (ber > MathConstants::POOR_BER_THRESHOLD_API) score -= 1;
+
+    // 丢包率评分
+    if (packetLoss < MathConstants::LOW_PACKET_LOSS_THRESHOLD) score += 1;
+    else if (packetLoss > MathConstants::HIGH_PACKET_LOSS_THRESHOLD) score -= 1;
+
+    if (score >= MathConstants::EXCELLENT_QUALITY_SCORE) return CommunicationQuality::EXCELLENT;
+    else if (score >= MathConstants::GOOD_QUALITY_SCORE) return CommunicationQuality::GOOD;
+    else if (score >= MathConstants::FAIR_QUALITY_SCORE) return CommunicationQuality::FAIR;
+    else if (score >= MathConstants::POOR_QUALITY_SCORE) return CommunicationQuality::POOR;
+    else return CommunicationQuality::FAILED;
+}
+
+std::string CommunicationLinkEvaluator::formatDescription(double signalStrength, double snr,
+                                                          double ber, double throughput) {
+    std::ostringstream oss;
+    oss << "信号强度: " << std::fixed << std::setprecision(1) << signalStrength << " dBm, ";
+    oss << "信噪比: " << snr << " dB, ";
+    oss << "误码率: " << std::scientific << std::setprecision(2) << ber << ", ";
+    oss << "吞吐量: " << std::fixed << std::setprecision(2) << throughput << " Mbps";
+    return oss.str();
+}
+
+std::string CommunicationLinkEvaluator::formatStatusDescription(const CommunicationLinkStatus& status) {
+    return formatDescription(status.signalStrength, status.signalToNoiseRatio,
+                             status.bitErrorRate, status.throughput);
+}
+
+std::string CommunicationLinkEvaluator::formatStatusDescription(const CommunicationLinkMetrics& metrics) {
+    return formatDescription(metrics.signalStrength, metrics.signalToNoiseRatio,
+                             metrics.bitErrorRate, metrics.throughput);
+}
@@ -0,0 +1,148 @@
+#include "CommunicationLinkPredictor.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    bool isPositiveFinite(double value) {
+        return value > 0.0 && std::isfinite(value);
+    }
+
+    bool isHorizonValid(double horizon) {
+        return horizon >= 0.0 && std::isfinite(horizon);
+    }
+}
+
+CommunicationLinkPredictor::CommunicationLinkPredictor(size_t linkCount, double processNoise, double measurementNoise)
+    : processNoise_(processNoise)
+    , measurementNoise_(measurementNoise) {
+    if (linkCount == 0) {
+        throw std::invalid_argument("预测链路数必须大于0");
+    }
+    if (!isPositiveFinite(processNoise) || !isPositiveFinite(measurementNoise)) {
+        throw std::invalid_argument("预测器噪声参数必须为正数");
+    }
+    lastTimestamp_.resize(linkCount);
+    signalLevel_.resize(linkCount);
+    signalTrend_.resize(linkCount);
+    snrLevel_.resize(linkCount);
+    snrTrend_.resize(linkCount);
+    covarianceLevel_.resize(linkCount);
+    covarianceCross_.resize(linkCount);
+    covarianceTrend_.resize(linkCount);
+    initialized_.resize(linkCount);
+    reset();
+}
+
+void CommunicationLinkPredictor::reset() {
+    for (size_t link = 0; link < getLinkCount(); ++link) {
+        reset(link);
+    }
+}
+
+void CommunicationLinkPredictor::reset(size_t link) {
+    if (link >= getLinkCount()) return;
+    lastTimestamp_[link] = 0.0;
+    signalLevel_[link] = 0.0;
+    signalTrend_[link] = 0.0;
+    snrLevel_[link] = 0.0;
+    snrTrend_[link] = 0.0;
+    covarianceLevel_[link] = 0.0;
+    covarianceCross_[link] = 0.0;
+    covarianceTrend_[link] = 0.0;
+    initialized_[link] = 0;
+}
+
+/// @brief 以一个新样本更新链路状态
+/// @details 首个样本直接作为水平、趋势取0并赋较大的趋势方差；此后先按采样间隔dt外推：
+///          P = F P F^T + Q，F = [[1, dt], [0, 1]]，Q = q * [[dt³/3, dt²/2], [dt²/2, dt]]，
+///          再以增益K = P[:, 0] / (P[0][0] + r)修正两个指标的水平与趋势
+bool CommunicationLinkPredictor::update(size_t link, double timestamp, double signalStrength, double snr) {
+    if (link >= getLinkCount() || !std::isfinite(timestamp) ||
+        !std::isfinite(signalStrength) || !std::isfinite(snr)) {
+        return false;
+    }
+
+    if (!initialized_[link]) {
+        lastTimestamp_[link] = timestamp;
+        signalLevel_[link] = signalStrength;
+        signalTrend_[link] = 0.0;
+        snrLevel_[link] = snr;
+        snrTrend_[link] = 0.0;
+        covarianceLevel_[link] = measurementNoise_;
+        covarianceCross_[link] = 0.0;
+        covarianceTrend_[link] = MathConstants::LINK_PREDICTOR_INITIAL_TREND_VARIANCE;
+        initialized_[link] = 1;
+        return true;
+    }
+
+    const double dt = timestamp - lastTimestamp_[link];
+    if (dt < 0.0) return false;
+
+    // 外推
+    const double dt2 = dt * dt;
+    const double p11 = covarianceTrend_[link];
+    const double p01 = covarianceCross_[link] + dt * p11 + processNoise_ * dt2 / 2.0;
+    const double p00 = covarianceLevel_[link] + dt * (2.0 * covarianceCross_[link] + dt * p11) +
+                       processNoise_ * dt2 * dt / 3.0;
+    const double pTrend = p11 + processNoise_ * dt;
+    signalLevel_[link] += signalTrend_[link] * dt;
+    snrLevel_[link] += snrTrend_[link] * dt;
+
+    // 量测修正
+    const double gainLevel = p00 / (p00 + measurementNoise_);
+    const double gainTrend = p01 / (p00 + measurementNoise_);
+    const double signalInnovation = signalStrength - signalLevel_[link];
+    const double snrInnovation = snr - snrLevel_[link];
+    signalLevel_[link] += gainLevel * signalInnovation;
+    signalTrend_[link] += gainTrend * signalInnovation;
+    snrLevel_[link] += gainLevel * snrInnovation;
+    snrTrend_[link] += gainTrend * snrInnovation;
+
+    covarianceLevel_[link] = (1.0 - gainLevel) * p00;
+    covarianceCross_[link] = (1.0 - gainLevel) * p01;
+    covarianceTrend_[link] = pTrend - gainTrend * p01;
+    lastTimestamp_[link] = timestamp;
+    return true;
+}
+
+size_t CommunicationLinkPredictor::updateBatch(const double* timestamps, const double* signalStrengths,
+                                               const double* snrs, size_t count) {
+    if (!timestamps || !signalStrengths || !snrs) return 0;
+    size_t updated = 0;
+    const size_t links = std::min(count, getLinkCount());
+    for (size_t link = 0; link < links; ++link) {
+        updated += update(link, timestamps[link], signalStrengths[link], snrs[link]) ? 1 : 0;
+    }
+    return updated;
+}
+
+bool CommunicationLinkPredictor::predict(size_t link, double horizon, double& signalStrength, double& snr) const {
+    if (!hasEstimate(link) || !isHorizonValid(horizon)) return false;
+    signalStrength = signalLevel_[link] + signalTrend_[link] * horizon;
+    snr = snrLevel_[link] + snrTrend_[link] * horizon;
+    return true;
+}
+
+bool CommunicationLinkPredictor::predictBatch(double horizon, double* signalStrengths, double* snrs) const {
+    if (!isHorizonValid(horizon) || !signalStrengths || !snrs) return false;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (size_t link = 0; link < getLinkCount(); ++link) {
+        const bool valid = initialized_[link] != 0;
+        signalStrengths[link] = valid ? signalLevel_[link] + signalTrend_[link] * horizon : nan;
+        snrs[link] = valid ? snrLevel_[link] + snrTrend_[link] * horizon : nan;
+    }
+    return true;
+}
+
+/// @brief 获取预测值的标准差
+/// @details 方差 = P00 + 2h P01 + h² P11 + q h³ / 3，即外推h后水平分量的方差
+double CommunicationLinkPredictor::getPredictionStandardDeviation(size_t link, double horizon) const {
+    if (!hasEstimate(link) || !isHorizonValid(horizon)) return std::numeric_limits<double>::infinity();
+    const double variance = covarianceLevel_[link] +
+                            horizon * (2.0 * covarianceCross_[link] + horizon * covarianceTrend_[link]) +
+                            processNoise_ * horizon * horizon * horizon / 3.0;
+    return std::sqrt(std::max(0.0, variance));
+}
@@ -0,0 +1,180 @@
+#include "CommunicationMobilitySimulator.h"
+#include "CommunicationParallelExecutor.h"
+#include "CommunicationVectorMath.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief 线程私有的分块缓冲区
+ *
+ * 分块内与前一航迹点重合的点不单独计算，uniqueIndex[k]为第k个航迹点对应的去重后下标，
+ * 其余数组按去重后下标存储。
+ */
+struct CommunicationMobilitySimulator::ChunkWorkspace {
+    explicit ChunkWorkspace(size_t capacity)
+        : uniqueIndex(capacity), signalLog(capacity), jammerLog(capacity),
+          signalStrength(capacity), snr(capacity), distance(capacity) {}
+
+    size_t uniqueCount = 0;
+    std::vector<size_t> uniqueIndex;
+    std::vector<double> signalLog;       // log10(ds²)
+    std::vector<double> jammerLog;       // log10(dj²)
+    std::vector<double> signalStrength;  // 信号强度 (dBm)
+    std::vector<double> snr;             // 信噪比 (dB)
+    std::vector<double> distance;        // 收发距离 (km)
+};
+
+CommunicationMobilitySimulator::CommunicationMobilitySimulator(const CommunicationLinkEvaluator& evaluator,
+                                                               double jammerX, double jammerY, int threadCount)
+    : coefficients_(evaluator.calculatePositionalLinkCoefficients(evaluator.getEnvironment()))
+    , signalAtUnitDistance_(evaluator.calculateLinkBudgetCoefficients(evaluator.getEnvironment()).signalAtUnitDistance)
+    , bandwidth_(evaluator.getEnvironment().bandwidth)
+    , jammerX_(jammerX)
+    , jammerY_(jammerY)
+    , threadCount_(threadCount) {}
+
+bool CommunicationMobilitySimulator::isTrajectoryValid(const std::pair<double, double>* waypoints, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (!std::isfinite(waypoints[i].first) || !std::isfinite(waypoints[i].second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief 计算一块航迹点的信号强度与信噪比
+/// @details 只为位置发生变化的航迹点求距离，对数按整块批量计算
+void CommunicationMobilitySimulator::evaluateChunk(const std::pair<double, double>* waypoints, size_t count,
+                                                   ChunkWorkspace& workspace) const {
+    const double minSquaredDistance = MathConstants::MIN_DISTANCE_LIMIT * MathConstants::MIN_DISTANCE_LIMIT;
+    const double halfSlope = 0.5 * coefficients_.distanceSlope;
+    const double halfFsplCoefficient = 0.5 * MathConstants::FSPL_DISTANCE_COEFFICIENT;
+
+    size_t unique = 0;
+    for (size_t k = 0; k < count; ++k) {
+        const std::pair<double, double>& point = waypoints[k];
+        if (k == 0 || point != waypoints[k - 1]) {
+            double jx = point.first - jammerX_;
+            double jy = point.second - jammerY_;
+            workspace.signalLog[unique] = std::max(point.first * point.first + point.second * point.second,
+                                                   minSquaredDistance);
+            workspace.jammerLog[unique] = std::max(jx * jx + jy * jy, minSquaredDistance);
+            ++unique;
+        }
+        workspace.uniqueIndex[k] = unique - 1;
+    }
+    workspace.uniqueCount = unique;
+
+    for (size_t u = 0; u < unique; ++u) {
+        workspace.distance[u] = std::sqrt(workspace.signalLog[u]);
+    }
+    CommunicationVectorMath::log10Batch(workspace.signalLog.data(), workspace.signalLog.data(), unique);
+
+    for (size_t u = 0; u < unique; ++u) {
+        double loss = halfSlope * workspace.signalLog[u];
+        workspace.signalStrength[u] = signalAtUnitDistance_ - loss;
+        workspace.snr[u] = coefficients_.jammerFreeSnrAtUnitDistance - loss;
+    }
+
+    if (coefficients_.jammed) {
+        CommunicationVectorMath::log10Batch(workspace.jammerLog.data(), workspace.jammerLog.data(), unique);
+        for (size_t u = 0; u < unique; ++u) {
+            workspace.snr[u] -= coefficients_.unitJammerToSignalRatio +
+                                halfFsplCoefficient * (workspace.signalLog[u] - workspace.jammerLog[u]);
+        }
+    }
+}
+
+CommunicationLinkStatus CommunicationMobilitySimulator::evaluateWaypoint(const std::pair<double, double>& waypoint) const {
+    ChunkWorkspace workspace(1);
+    evaluateChunk(&waypoint, 1, workspace);
+    return CommunicationLinkEvaluator::deriveLinkStatus(workspace.signalStrength[0], workspace.snr[0],
+                                                        bandwidth_, workspace.distance[0]);
+}
+
+bool CommunicationMobilitySimulator::evaluateTrajectory(const std::pair<double, double>* waypoints, size_t count,
+                                                        CommunicationLinkStatus* results) const {
+    if (count > 0 && (!waypoints || !results)) return false;
+    if (!isTrajectoryValid(waypoints, count)) return false;
+
+    const size_t chunkSize = static_cast<size_t>(MathConstants::CHANNEL_SIMULATION_CHUNK_SIZE);
+    const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    int threads = CommunicationParallelExecutor::resolveThreadCount(threadCount_, chunkCount);
+
+    CommunicationParallelExecutor::parallelFor(chunkCount, threads,
+        [&](size_t begin, size_t end, int) {
+            ChunkWorkspace workspace(chunkSize);
+            for (size_t c = begin; c < end; ++c) {
+                size_t first = c * chunkSize;
+                size_t length = std::min(chunkSize, count - first);
+                evaluateChunk(waypoints + first, length, workspace);
+                for (size_t k = 0; k < length; ++k) {
+                    size_t u = workspace.uniqueIndex[k];
+                    if (k > 0 && u == workspace.uniqueIndex[k - 1]) {
+                        results[first + k] = results[first + k - 1];
+                    } else {
+                        results[first + k] = CommunicationLinkEvaluator::deriveLinkStatus(
+                            workspace.signalStrength[u], workspace.snr[u], bandwidth_, workspace.distance[u]);
+                    }
+                }
+            }
+        });
+    return true;
+}
+
+/// @brief 流式仿真
+/// @details 输出缓冲区与工作区按线程数预先分配，整个仿真过程中不再分配内存
+bool CommunicationMobilitySimulator::simulate(const std::pair<double, double>* waypoints, size_t count, double timeStep,
+                                              const CommunicationMobilitySampleCallback& callback) const {
+    if (!callback || !(timeStep > 0.0) || std::isinf(timeStep)) return false;
+    if (count > 0 && !waypoints) return false;
+    if (!isTrajectoryValid(waypoints, count)) return false;
+
+    const size_t chunkSize = static_cast<size_t>(MathConstants::CHANNEL_SIMULATION_CHUNK_SIZE);
+    const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    const int threads = CommunicationParallelExecutor::resolveThreadCount(threadCount_, chunkCount);
+
+    std::vector<CommunicationMobilitySample> buffer(std::min(count, chunkSize * static_cast<size_t>(threads)));
+    std::vector<ChunkWorkspace> workspaces(static_cast<size_t>(threads), ChunkWorkspace(chunkSize));
+
+    for (size_t batchStart = 0; batchStart < chunkCount; batchStart += threads) {
+        const size_t batchChunks = std::min(static_cast<size_t>(threads), chunkCount - batchStart);
+
+        CommunicationParallelExecutor::parallelFor(batchChunks, static_cast<int>(batchChunks),
+            [&](size_t begin, size_t end, int threadIndex) {
+                ChunkWorkspace& workspace = workspaces[threadIndex];
+                for (size_t c = begin; c < end; ++c) {
+                    size_t first = (batchStart + c) * chunkSize;
+                    size_t length = std::min(chunkSize, count - first);
+                    CommunicationMobilitySample* samples = buffer.data() + c * chunkSize;
+
+                    evaluateChunk(waypoints + first, length, workspace);
+                    for (size_t k = 0; k < length; ++k) {
+                        size_t u = workspace.uniqueIndex[k];
+                        CommunicationMobilitySample& sample = samples[k];
+                        sample.time = static_cast<double>(first + k) * timeStep;
+                        if (k > 0 && u == workspace.uniqueIndex[k - 1]) {
+                            sample.distance = samples[k - 1].distance;
+                            sample.metrics = samples[k - 1].metrics;
+                            continue;
+                        }
+                        sample.distance = workspace.distance[u];
+                        sample.metrics = CommunicationLinkEvaluator::toLinkMetrics(
+                            CommunicationLinkEvaluator::deriveLinkStatus(workspace.signalStrength[u], workspace.snr[u],
+                                                                         bandwidth_, workspace.distance[u]));
+                    }
+                }
+            });
+
+        for (size_t c = 0; c < batchChunks; ++c) {
+            size_t first = (batchStart + c) * chunkSize;
+            size_t length = std::min(chunkSize, count - first);
+            if (!callback(buffer.data() + c * chunkSize, length)) {
+                return true;
+            }
+        }
+    }
+    return true;
+}
@@ -1,4 +1,22 @@
 #include "CommunicationModelAPI.h"
+#include "CommunicationLinkEvaluator.h"
+#include "CommunicationParallelExecutor.h"
+#include "CommunicationNetworkAnalyzer.h"
+#include "CommunicationRelayPlanner.h"
+#include "CommunicationRasterEngine.h"
+#include "CommunicationCoverageAnalyzer.h"
+#include "CommunicationChannelSimulator.h"
+#include "CommunicationMobilitySimulator.h"
+#include "CommunicationStatusMonitor.h"
+#include "CommunicationMonteCarloEngine.h"
+#include "CommunicationTimingSimulator.h"
+#include "CommunicationHoppingSimulator.h"
+#include "CommunicationLinkPredictor.h"
+#include "CommunicationCheckpoint.h"
+#include "CommunicationJammerAggregator.h"
+#include "CommunicationJammerAssigner.h"
+#include "CommunicationBandOverlapIndex.h"
+#include "CommunicationJammerParameterConfig.h"
 #include "MathConstants.h"
 #include <cmath>
 #include <algorithm>
@@ -9,12 +27,84 @@
 
 
 #include <thread>
-#include <random>
+#include <mutex>
+#include <atomic>
+
+/**
+ * @brief 不可变求值快照
+ *
+ * 保存某一时刻的场景、环境参数、随机数主种子、状态描述开关、线程数、五个子模型的副本与链路评估器，
+ * const查询只从快照读取配置。快照一经发布不再修改，
+ * 当前链路状态在构建时计算一次，状态描述在首次需要时线程安全地生成。
+ */
+struct CommunicationModelAPI::EvaluationSnapshot {
+    explicit EvaluationSnapshot(const CommunicationModelAPI& api)
+        : scenario(api.currentScenario_)
+        , environment(api.environment_)
+        , jammingEnv(api.jammingEnv_)
+        , randomSeed(api.randomSeed_)
+        , statusDescriptionEnabled(api.statusDescriptionEnabled_)
+        , threadCount(api.threadCount_)
+        , signalModel(*api.signalModel_)
+        , distanceModel(*api.distanceModel_)
+        , receiveModel(*api.receiveModel_)
+        , jammerModel(*api.jammerModel_)
+        , antiJamModel(*api.antiJamModel_)
+        , evaluator(scenario, environment, jammingEnv, jammerModel, antiJamModel)
+        , status(evaluator.evaluate(environment, false)) {}
+
+    const std::string& getStatusDescription() const {
+        std::call_once(descriptionOnce, [this]() {
+            statusDescription = CommunicationLinkEvaluator::formatStatusDescription(status);
+        });
+        return statusDescription;
+    }
+
+    const CommunicationScenario scenario;
+    const CommunicationEnvironment environment;
+    const JammingEnvironment jammingEnv;
+    const uint64_t randomSeed;
+    const bool statusDescriptionEnabled;
+    const int threadCount;
+    const SignalTransmissionModel signalModel;
+    const CommunicationDistanceModel distanceModel;
+    const CommunicationReceiveModel receiveModel;
+    const CommunicationJammerModel jammerModel;
+    const CommunicationAntiJamModel antiJamModel;
+    const CommunicationLinkEvaluator evaluator;
+    const CommunicationLinkStatus status;     // 不含状态描述
+
+private:
+    mutable std::once_flag descriptionOnce;
+    mutable std::string statusDescription;
+};
+
+/// @brief 链路预测状态
+/// @details 记录已消费的监控记录数，只以新增记录更新预测器；新增记录读入按监控历史容量预分配的缓冲区，
+///          预测时不分配内存。查询可能并发，以互斥锁保护
+struct CommunicationModelAPI::PredictionState {
+    explicit PredictionState(size_t capacity) : records(capacity) {}
+
+    std::mutex mutex;
+    CommunicationLinkPredictor predictor;
+    std::vector<CommunicationStatusRecord> records;
+    uint64_t consumedRecords = 0;
+};
+
+/// @brief 快照同步状态
+/// @details 互斥锁串行化快照重建；stale在交出可写子模型指针后置位，下一次查询据此以实时子模型重建快照
+struct CommunicationModelAPI::SnapshotSync {
+    std::mutex mutex;
+    std::atomic<bool> stale{false};
+};
 
 // 构造函数
 CommunicationModelAPI::CommunicationModelAPI() 
     : currentScenario_(CommunicationScenario::NORMAL_COMMUNICATION)
-    , resultsValid_(false) {
+    , snapshotSync_(std::make_unique<SnapshotSync>())
+    , statusDescriptionEnabled_(true)
+    , threadCount_(0)
+    , randomSeed_(CommunicationRandomStream::DEFAULT_SEED) {
     
     // 初始化所有模型
     signalModel_ = std::make_unique<SignalTransmissionModel>();
@@ -53,9 +143,57 @@ CommunicationModelAPI::CommunicationModelAPI(CommunicationScenario scenario)
 
 CommunicationModelAPI::~CommunicationModelAPI() = default;
 
+CommunicationModelAPI::CommunicationModelAPI(CommunicationModelAPI&&) = default;
+CommunicationModelAPI& CommunicationModelAPI::operator=(CommunicationModelAPI&&) = default;
+
 // 内部方法
-void CommunicationModelAPI::invalidateCache() {
-    resultsValid_ = false;
+/// @brief 重建求值快照
+/// @details 以当前场景、环境参数和子模型状态构造新快照并原子替换，
+///          正在使用旧快照的并发查询不受影响
+void CommunicationModelAPI::rebuildSnapshot() {
+    std::lock_guard<std::mutex> lock(snapshotSync_->mutex);
+    publishSnapshot();
+}
+
+/// @brief 构造并发布新快照
+/// @details 调用方须持有snapshotSync_->mutex；监控器存在时同时令其改为对新快照求值
+void CommunicationModelAPI::publishSnapshot() const {
+    snapshotSync_->stale.store(false, std::memory_order_relaxed);
+    auto snapshot = std::make_shared<const EvaluationSnapshot>(*this);
+    if (monitor_) {
+        monitor_->publish(makeMonitorSampler(snapshot));
+    }
+    std::atomic_store(&snapshot_, std::move(snapshot));
+}
+
+/// @brief 构造监控采样函数
+/// @details 采样函数持有快照的共享引用而非API本身，API移动或析构期间监控线程仍可安全求值
+/// @param snapshot 被采样的求值快照
+/// @return 每次调用都以快照中的评估器重新求值链路指标的函数
+std::function<CommunicationLinkMetrics()> CommunicationModelAPI::makeMonitorSampler(
+    std::shared_ptr<const EvaluationSnapshot> snapshot) {
+    return [snapshot]() {
+        return snapshot->evaluator.evaluateMetrics(snapshot->environment);
+    };
+}
+
+/// @brief 标记快照失效
+/// @details 可写子模型指针交出后调用，下一次查询以届时的子模型状态重建快照
+void CommunicationModelAPI::invalidateSnapshot() const {
+    snapshotSync_->stale.store(true, std::memory_order_release);
+}
+
+/// @brief 获取当前求值快照
+/// @details 快照已失效时先在锁内重建，多个并发查询只重建一次
+/// @return 快照的共享引用，调用方持有期间快照保持有效
+std::shared_ptr<const CommunicationModelAPI::EvaluationSnapshot> CommunicationModelAPI::loadSnapshot() const {
+    if (snapshotSync_->stale.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(snapshotSync_->mutex);
+        if (snapshotSync_->stale.load(std::memory_order_relaxed)) {
+            publishSnapshot();
+        }
+    }
+    return std::atomic_load(&snapshot_);
 }
 
 /// @brief 更新所有模型参数
@@ -98,137 +236,7 @@ void CommunicationModelAPI::updateModelsFromEnvironment() {
         antiJamModel_->setInterferenceLevel(jammingEnv_.jammerPower);
     }
     
-    invalidateCache();
-}
-
-/// @brief 计算总信号强度
-/// @details 总信号强度 = 发射功率 - 路径损耗 - 环境损耗 - 频率因子
-/// @return 总信号强度(dBm)
-double CommunicationModelAPI::calculateOverallSignalStrength() const {
-    if (!signalModel_ || !distanceModel_) return MathConstants::DEFAULT_SIGNAL_STRENGTH;
-    
-    // 基础信号强度
-    double baseSignal = environment_.transmitPower;
-    
-    // 使用距离模型计算总路径损耗（包含所有损耗因子）
-    double totalPathLoss = distanceModel_->calculateTotalPathLoss(environment_.distance, environment_.frequency);
-    
-    return baseSignal - totalPathLoss;
-}
-
-/// @brief 计算信噪比
-/// @details 信噪比 = 总信号强度 - 环境噪声功率
-/// @return 信噪比(dB)
-double CommunicationModelAPI::calculateOverallSNR() const {
-    if (!receiveModel_) return MathConstants::DEFAULT_SNR;
-    
-    double signalStrength = calculateOverallSignalStrength();
-    double snr = signalStrength - environment_.noisePower;
-    
-    // 考虑干扰的影响
-    if (jammingEnv_.isJammed && jammerModel_) {
-        double jammerEffect = jammerModel_->calculateJammerToSignalRatio();
-        snr -= jammerEffect;
-    }
-    
-    // 考虑抗干扰增益
-    if (currentScenario_ == CommunicationScenario::ANTI_JAM_COMMUNICATION && antiJamModel_) {
-        double antiJamGain = antiJamModel_->calculateAntiJamGain();
-        snr += antiJamGain;
-    }
-    
-    return snr;
-}
-
-/// @brief 计算误码率
-/// @details 误码率 = 0.5 * erfc(sqrt(10^(信噪比/10)))
-/// @return 误码率
-double CommunicationModelAPI::calculateOverallBER() const {
-    double snr = calculateOverallSNR();
-    
-    // 简化的BPSK误码率计算
-    double linearSnr = std::pow(MathConstants::LINEAR_TO_DB_MULTIPLIER, snr / MathConstants::LINEAR_TO_DB_MULTIPLIER);
-    double ber = MathConstants::BER_COEFFICIENT * std::erfc(std::sqrt(linearSnr));
-    
-    return std::max(MathConstants::MIN_BER, std::min(MathConstants::MAX_BER, ber));
-}
-
-/// @brief 计算吞吐量
-/// @details 吞吐量 = 带宽 * log2(1 + 10^(信噪比/10)) * (1 - 误码率)
-/// @return 吞吐量 (bps)
-double CommunicationModelAPI::calculateThroughput() const {
-    double snr = calculateOverallSNR();
-    double ber = calculateOverallBER();
-    
-    // 基于香农定理的理论容量
-    double theoreticalCapacity = environment_.bandwidth * std::log2(MathConstants::SHANNON_BASE + std::pow(MathConstants::LINEAR_TO_DB_MULTIPLIER, snr / MathConstants::LINEAR_TO_DB_MULTIPLIER));
-    
-    // 考虑误码率的影响
-    double efficiency = MathConstants::EFFICIENCY_BASE - MathConstants::BER_EFFICIENCY_FACTOR * ber; // 简化的效率模型
-    efficiency = std::max(MathConstants::MIN_EFFICIENCY, std::min(MathConstants::MAX_EFFICIENCY, efficiency));
-    
-    return theoreticalCapacity * efficiency;
-}
-
-/// @brief 计算延迟
-/// @details 延迟 = 距离 / 光速 + 处理延迟 + 重传延迟
-/// @return 延迟 (ms)
-double CommunicationModelAPI::calculateLatency() const {
-    double baseLatency = environment_.distance / MathConstants::SPEED_OF_LIGHT; // 光速传播延迟 (ms)
-    
-    // 处理延迟
-    double processingDelay = MathConstants::DEFAULT_PROCESSING_DELAY; // 基础处理延迟 1ms
-    
-    // 重传延迟（基于误码率）
-    double ber = calculateOverallBER();
-    double retransmissionDelay = ber * MathConstants::RETRANSMISSION_DELAY_FACTOR; // 简化模型
-    
-    return baseLatency + processingDelay + retransmissionDelay;
-}
-
-/// @brief 计算丢包率
-/// @details 丢包率 = 1 - (1 - BER)^(数据包长度 * 8)
-/// @return 丢包率
-double CommunicationModelAPI::calculatePacketLossRate() const {
-    double ber = calculateOverallBER();
-    
-    // 假设数据包长度为1000字节
-    int packetLengthBits = MathConstants::PACKET_LENGTH_BITS;
-    
-    // 数据包错误率 = 1 - (1 - BER)^数据包长度
-    double packetErrorRate = MathConstants::UNITY - std::pow(MathConstants::UNITY - ber, packetLengthBits);
-    
-    return std::max(MathConstants::ZERO, std::min(MathConstants::UNITY, packetErrorRate));
-}
-/// @return 通信质量
-CommunicationQuality CommunicationModelAPI::assessCommunicationQuality() const {
-    double snr = calculateOverallSNR();
-    double ber = calculateOverallBER();
-    double packetLoss = calculatePacketLossRate();
-    
-    // 综合评估通信质量
-    int score = 0;
-    
-    // 信噪比评分
-    if (snr > MathConstants::HIGH_SNR_THRESHOLD) score += 2;
-    else if (snr > MathConstants::MEDIUM_SNR_THRESHOLD) score += 1;
-    else if (snr < MathConstants::LOW_SNR_THRESHOLD) score -= 1;
-    
-    // 误码率评分
-    if (ber < MathConstants::EXCELLENT_BER_THRESHOLD) score += 2;
-    else if (ber < MathConstants::GOOD_BER_THRESHOLD) score += 1;
-    else if (ber > MathConstants::POOR_BER_THRESHOLD_API) score -= 1;
-    
-    // 丢包率评分
-    if (packetLoss < MathConstants::LOW_PACKET_LOSS_THRESHOLD) score += 1;
-    else if (packetLoss > MathConstants::HIGH_PACKET_LOSS_THRESHOLD) score -= 1;
-    
-    // 根据总分确定质量等级
-    if (score >= MathConstants::EXCELLENT_QUALITY_SCORE) return CommunicationQuality::EXCELLENT;
-    else if (score >= MathConstants::GOOD_QUALITY_SCORE) return CommunicationQuality::GOOD;
-    else if (score >= MathConstants::FAIR_QUALITY_SCORE) return CommunicationQuality::FAIR;
-    else if (score >= MathConstants::POOR_QUALITY_SCORE) return CommunicationQuality::POOR;
-    else return CommunicationQuality::FAILED;
+    rebuildSnapshot();
 }
 
 /// @brief 设置通信场景
@@ -275,6 +283,13 @@ bool CommunicationModelAPI::setEnvironment(const CommunicationEnvironment& env)
 }
 
 bool CommunicationModelAPI::setJammingEnvironment(const JammingEnvironment& jammingEnv) {
+    if (!jammingEnv.jammerPositions.empty()) {
+        size_t emitterCount = jammingEnv.jammerFrequencies.empty() ? 1 : jammingEnv.jammerFrequencies.size();
+        if (jammingEnv.jammerPositions.size() != emitterCount) return false;
+        for (const auto& position : jammingEnv.jammerPositions) {
+            if (!std::isfinite(position.first) || !std::isfinite(position.second)) return false;
+        }
+    }
     jammingEnv_ = jammingEnv;
     updateModelsFromEnvironment();
     return true;
@@ -314,132 +329,295 @@ bool CommunicationModelAPI::setEnvironmentType(EnvironmentType type) {
     return true;
 }
 
+// 子模型设置
+/// @brief 替换信号传输模型
+/// @details 整体替换子模型并重建求值快照，与环境参数setter一样立即对查询生效；
+///          之后修改环境参数时，环境参数仍按updateModelsFromEnvironment同步到子模型。
+///          其余子模型的替换方法相同
+/// @param model 新的信号传输模型
+/// @return 设置是否成功
+bool CommunicationModelAPI::setSignalModel(const SignalTransmissionModel& model) {
+    *signalModel_ = model;
+    rebuildSnapshot();
+    return true;
+}
+
+bool CommunicationModelAPI::setDistanceModel(const CommunicationDistanceModel& model) {
+    *distanceModel_ = model;
+    rebuildSnapshot();
+    return true;
+}
+
+bool CommunicationModelAPI::setReceiveModel(const CommunicationReceiveModel& model) {
+    *receiveModel_ = model;
+    rebuildSnapshot();
+    return true;
+}
+
+bool CommunicationModelAPI::setJammerModel(const CommunicationJammerModel& model) {
+    *jammerModel_ = model;
+    rebuildSnapshot();
+    return true;
+}
+
+bool CommunicationModelAPI::setAntiJamModel(const CommunicationAntiJamModel& model) {
+    *antiJamModel_ = model;
+    rebuildSnapshot();
+    return true;
+}
+
+// 子模型直接访问
+/// @brief 获取信号传输模型
+/// @details 调用方可能经返回指针修改子模型，因此先标记快照失效，下一次查询以修改后的子模型重建快照。
+///          其余子模型的访问方法相同
+/// @return 信号传输模型指针
+SignalTransmissionModel* CommunicationModelAPI::getSignalModel() const {
+    invalidateSnapshot();
+    return signalModel_.get();
+}
+
+CommunicationDistanceModel* CommunicationModelAPI::getDistanceModel() const {
+    invalidateSnapshot();
+    return distanceModel_.get();
+}
+
+CommunicationReceiveModel* CommunicationModelAPI::getReceiveModel() const {
+    invalidateSnapshot();
+    return receiveModel_.get();
+}
+
+CommunicationJammerModel* CommunicationModelAPI::getJammerModel() const {
+    invalidateSnapshot();
+    return jammerModel_.get();
+}
+
+CommunicationAntiJamModel* CommunicationModelAPI::getAntiJamModel() const {
+    invalidateSnapshot();
+    return antiJamModel_.get();
+}
+
+// 配置查询
+CommunicationScenario CommunicationModelAPI::getScenario() const {
+    auto snapshot = loadSnapshot();
+    return snapshot ? snapshot->scenario : currentScenario_;
+}
+
+CommunicationEnvironment CommunicationModelAPI::getEnvironment() const {
+    auto snapshot = loadSnapshot();
+    return snapshot ? snapshot->environment : environment_;
+}
+
+JammingEnvironment CommunicationModelAPI::getJammingEnvironment() const {
+    auto snapshot = loadSnapshot();
+    return snapshot ? snapshot->jammingEnv : jammingEnv_;
+}
+
 // 核心计算接口
+/// @brief 计算当前链路状态
+/// @details 直接读取求值快照中预先计算的结果，不修改任何成员，可被多个线程并发调用
+/// @return 链路状态
 CommunicationLinkStatus CommunicationModelAPI::calculateLinkStatus() const {
-    if (resultsValid_) {
-        return cachedLinkStatus_;
-    }
-    
-    CommunicationLinkStatus status;
-    
-    status.signalStrength = calculateOverallSignalStrength();
-    status.signalToNoiseRatio = calculateOverallSNR();
-    status.bitErrorRate = calculateOverallBER();
-    status.throughput = calculateThroughput();
-    status.latency = calculateLatency();
-    status.packetLossRate = calculatePacketLossRate();
-    status.quality = assessCommunicationQuality();
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return CommunicationLinkStatus();
     
-    // 判断是否连接
-    status.isConnected = (status.signalToNoiseRatio > MathConstants::LOW_SNR_THRESHOLD && 
-                         status.bitErrorRate < MathConstants::CONNECTION_BER_THRESHOLD && 
-                         status.packetLossRate < MathConstants::CONNECTION_PACKET_LOSS_THRESHOLD);
+    CommunicationLinkStatus status = snapshot->status;
     
     // 生成状态描述
-    std::ostringstream oss;
-    oss << "信号强度: " << std::fixed << std::setprecision(1) << status.signalStrength << " dBm, ";
-    oss << "信噪比: " << status.signalToNoiseRatio << " dB, ";
-    oss << "误码率: " << std::scientific << std::setprecision(2) << status.bitErrorRate << ", ";
-    oss << "吞吐量: " << std::fixed << std::setprecision(2) << status.throughput << " Mbps";
-    status.statusDescription = oss.str();
-    
-    // 缓存结果
-    cachedLinkStatus_ = status;
-    resultsValid_ = true;
+    if (snapshot->statusDescriptionEnabled) {
+        status.statusDescription = snapshot->getStatusDescription();
+    }
     
     return status;
 }
 
 CommunicationPerformance CommunicationModelAPI::calculatePerformance() const {
-    CommunicationPerformance performance;
+    CommunicationPerformance performance = {};
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return performance;
+    const CommunicationEnvironment& environment = snapshot->environment;
     
     // 有效通信距离
-    if (distanceModel_) {
-        performance.effectiveRange = distanceModel_->calculateEffectiveDistance();
-    } else {
-        performance.effectiveRange = 0.0;
-    }
+    performance.effectiveRange = snapshot->distanceModel.calculateEffectiveDistance();
+    
+    // 链路指标取自快照
+    const CommunicationLinkStatus& status = snapshot->status;
     
     // 最大数据速率
-    performance.maxDataRate = calculateThroughput();
+    performance.maxDataRate = status.throughput;
     
     // 功率效率 (bps/W)
-    double powerWatts = std::pow(MathConstants::LINEAR_TO_DB_MULTIPLIER, (environment_.transmitPower - MathConstants::POWER_CONVERSION_OFFSET) / MathConstants::LINEAR_TO_DB_MULTIPLIER);
+    double powerWatts = std::pow(MathConstants::LINEAR_TO_DB_MULTIPLIER, (environment.transmitPower - MathConstants::POWER_CONVERSION_OFFSET) / MathConstants::LINEAR_TO_DB_MULTIPLIER);
     performance.powerEfficiency = (performance.maxDataRate * MathConstants::MEGA_MULTIPLIER) / powerWatts;
     
     // 频谱效率 (bps/Hz)
-    performance.spectralEfficiency = (performance.maxDataRate * MathConstants::MEGA_MULTIPLIER) / (environment_.bandwidth * MathConstants::MEGA_MULTIPLIER);
+    performance.spectralEfficiency = (performance.maxDataRate * MathConstants::MEGA_MULTIPLIER) / (environment.bandwidth * MathConstants::MEGA_MULTIPLIER);
     
     // 可靠性（基于误码率）
-    double ber = calculateOverallBER();
-    performance.reliability = MathConstants::UNITY - std::min(MathConstants::UNITY, ber * MathConstants::RELIABILITY_MULTIPLIER);
+    performance.reliability = MathConstants::UNITY - std::min(MathConstants::UNITY, status.bitErrorRate * MathConstants::RELIABILITY_MULTIPLIER);
     
     // 可用性（基于信噪比）
-    double snr = calculateOverallSNR();
-    performance.availability = MathConstants::UNITY / (MathConstants::UNITY + std::exp(-(snr - MathConstants::AVAILABILITY_SNR_OFFSET) / MathConstants::AVAILABILITY_DIVISOR));
+    performance.availability = CommunicationLinkEvaluator::calculateAvailability(status.signalToNoiseRatio);
     
     // 抗干扰能力
-    if (antiJamModel_) {
-        performance.jammerResistance = antiJamModel_->calculateJammerResistance();
-    } else {
-        performance.jammerResistance = 0.0;
-    }
+    performance.jammerResistance = snapshot->antiJamModel.calculateJammerResistance();
     
     // 抗截获能力
-    if (antiJamModel_) {
-        performance.interceptionResistance = antiJamModel_->calculateInterceptionResistance();
-    } else {
-        performance.interceptionResistance = 0.0;
-    }
+    performance.interceptionResistance = snapshot->antiJamModel.calculateInterceptionResistance();
     
     return performance;
 }
 
+/// @brief 批量计算链路状态
+/// @details 每个样本独立求值，不调用setter、不修改API对象及其子模型
+/// @param environments 通信环境数组
+/// @param count 数组长度
+/// @param results 输出数组，长度不小于count
+/// @return 参数有效返回true
+bool CommunicationModelAPI::calculateLinkStatusBatch(const CommunicationEnvironment* environments, size_t count,
+                                                     CommunicationLinkStatus* results) const {
+    if (count == 0) return true;
+    if (!environments || !results) return false;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+
+    snapshot->evaluator.evaluateBatch(environments, count, results, snapshot->statusDescriptionEnabled);
+    return true;
+}
+
+/// @brief 批量计算链路状态（列式输入）
+/// @param environments 列式通信环境参数，空列沿用当前环境取值
+/// @param results 输出数组，长度不小于environments.count
+/// @return 参数有效返回true
+bool CommunicationModelAPI::calculateLinkStatusBatch(const CommunicationEnvironmentArrays& environments,
+                                                     CommunicationLinkStatus* results) const {
+    if (environments.count == 0) return true;
+    if (!results) return false;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+
+    snapshot->evaluator.evaluateBatch(environments, results, snapshot->statusDescriptionEnabled);
+    return true;
+}
+
+std::vector<CommunicationLinkStatus> CommunicationModelAPI::calculateLinkStatusBatch(
+    const std::vector<CommunicationEnvironment>& environments) const {
+    std::vector<CommunicationLinkStatus> results(environments.size());
+    if (!calculateLinkStatusBatch(environments.data(), environments.size(), results.data())) {
+        results.clear();
+    }
+    return results;
+}
+
+/// @brief 计算当前环境下的链路数值指标
+/// @return 链路数值指标
+CommunicationLinkMetrics CommunicationModelAPI::calculateLinkMetrics() const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return CommunicationLinkMetrics();
+    return CommunicationLinkEvaluator::toLinkMetrics(snapshot->status);
+}
+
+/// @brief 批量计算链路数值指标
+/// @param environments 通信环境数组
+/// @param count 数组长度
+/// @param results 输出数组，长度不小于count
+/// @return 参数有效返回true
+bool CommunicationModelAPI::calculateLinkMetricsBatch(const CommunicationEnvironment* environments, size_t count,
+                                                      CommunicationLinkMetrics* results) const {
+    if (count == 0) return true;
+    if (!environments || !results) return false;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+
+    snapshot->evaluator.evaluateMetricsBatch(environments, count, results);
+    return true;
+}
+
+/// @brief 批量计算链路数值指标（列式输入）
+/// @param environments 列式通信环境参数，空列沿用当前环境取值
+/// @param results 输出数组，长度不小于environments.count
+/// @return 参数有效返回true
+bool CommunicationModelAPI::calculateLinkMetricsBatch(const CommunicationEnvironmentArrays& environments,
+                                                      CommunicationLinkMetrics* results) const {
+    if (environments.count == 0) return true;
+    if (!results) return false;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+
+    snapshot->evaluator.evaluateMetricsBatch(environments, results);
+    return true;
+}
+
+/// @brief 设置是否在链路状态中生成状态描述
+/// @details 重建求值快照，正在进行的查询仍按原设置完成
+void CommunicationModelAPI::enableStatusDescription(bool enable) {
+    statusDescriptionEnabled_ = enable;
+    rebuildSnapshot();
+}
+
+bool CommunicationModelAPI::isStatusDescriptionEnabled() const {
+    return loadSnapshot()->statusDescriptionEnabled;
+}
+
+std::string CommunicationModelAPI::describeLinkStatus(const CommunicationLinkStatus& status) {
+    return CommunicationLinkEvaluator::formatStatusDescription(status);
+}
+
+std::string CommunicationModelAPI::describeLinkMetrics(const CommunicationLinkMetrics& metrics) {
+    return CommunicationLinkEvaluator::formatStatusDescription(metrics);
+}
+
 double CommunicationModelAPI::calculateCommunicationRange() const {
-    if (!distanceModel_) return 0.0;
-    return distanceModel_->calculateEffectiveDistance();
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return 0.0;
+    return snapshot->distanceModel.calculateEffectiveDistance();
+}
+
+namespace {
+    /// @brief 以给定评估器与环境求达到目标距离所需的发射功率
+    double calculateRequiredPowerFor(const CommunicationLinkEvaluator& evaluator,
+                                     const CommunicationEnvironment& environment, double targetRange) {
+        double totalPathLoss = evaluator.calculateTotalPathLoss(
+            targetRange, environment.frequency, environment.environmentType);
+        
+        return environment.noisePower + 10.0 + totalPathLoss; // 10dB SNR余量
+    }
+
+    /// @brief 按环境类型的损耗特性求最优工作频率
+    double calculateOptimalFrequencyFor(EnvironmentType environmentType) {
+        // 从配置获取环境特性
+        const EnvironmentLossConfig& config = EnvironmentLossConfigManager::getConfig(environmentType);
+        
+        // 基于环境损耗特性计算最优频率
+        // 频率因子越高，选择越低的频率
+        double baseFrequency = 2400.0; // 基准频率 2.4 GHz
+        double optimalFreq = baseFrequency / config.frequencyFactor;
+        
+        // 考虑路径损耗指数的影响
+        if (config.pathLossExponent > 3.0) {
+            optimalFreq *= 0.7; // 高损耗环境选择更低频率
+        } else if (config.pathLossExponent < 2.5) {
+            optimalFreq *= 1.3; // 低损耗环境可以选择更高频率
+        }
+        
+        // 限制频率范围在合理区间内
+        return std::max(400.0, std::min(6000.0, optimalFreq));
+    }
 }
 
+/// @brief 计算达到目标距离所需的发射功率
+/// @details 直接以目标距离求总路径损耗，不修改当前环境参数
+/// @param targetRange 目标通信距离(km)
+/// @return 所需发射功率(dBm)
 double CommunicationModelAPI::calculateRequiredPower(double targetRange) const {
-    if (!distanceModel_) return 0.0;
-    
-    // 保存当前距离
-    double originalDistance = environment_.distance;
-    
-    // 设置目标距离
-    const_cast<CommunicationModelAPI*>(this)->environment_.distance = targetRange;
-    const_cast<CommunicationModelAPI*>(this)->updateModelsFromEnvironment();
-    
-    // 使用CommunicationDistanceModel计算总路径损耗
-    double totalPathLoss = distanceModel_->calculateTotalPathLoss(targetRange, environment_.frequency);
-    
-    double requiredPower = environment_.noisePower + 10.0 + totalPathLoss; // 10dB SNR余量
-    
-    // 恢复原始距离
-    const_cast<CommunicationModelAPI*>(this)->environment_.distance = originalDistance;
-    const_cast<CommunicationModelAPI*>(this)->updateModelsFromEnvironment();
-    
-    return requiredPower;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return 0.0;
+    return calculateRequiredPowerFor(snapshot->evaluator, snapshot->environment, targetRange);
 }
 
 double CommunicationModelAPI::calculateOptimalFrequency() const {
-    // 从配置获取环境特性
-    const EnvironmentLossConfig& config = EnvironmentLossConfigManager::getConfig(environment_.environmentType);
-    
-    // 基于环境损耗特性计算最优频率
-    // 频率因子越高，选择越低的频率
-    double baseFrequency = 2400.0; // 基准频率 2.4 GHz
-    double optimalFreq = baseFrequency / config.frequencyFactor;
-    
-    // 考虑路径损耗指数的影响
-    if (config.pathLossExponent > 3.0) {
-        optimalFreq *= 0.7; // 高损耗环境选择更低频率
-    } else if (config.pathLossExponent < 2.5) {
-        optimalFreq *= 1.3; // 低损耗环境可以选择更高频率
-    }
-    
-    // 限制频率范围在合理区间内
-    return std::max(400.0, std::min(6000.0, optimalFreq));
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return 0.0;
+    return calculateOptimalFrequencyFor(snapshot->environment.environmentType);
 }
 
 double CommunicationModelAPI::calculateOptimalBandwidth() const {
@@ -452,57 +630,266 @@ double CommunicationModelAPI::calculateOptimalBandwidth() const {
 
 // 干扰分析接口
 double CommunicationModelAPI::calculateJammerEffectiveness() const {
-    if (!jammerModel_ || !jammingEnv_.isJammed) return 0.0;
-    return jammerModel_->calculateJammerEffectiveness();
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !snapshot->jammingEnv.isJammed) return 0.0;
+    return snapshot->jammerModel.calculateJammerEffectiveness();
 }
 
 double CommunicationModelAPI::calculateAntiJamEffectiveness() const {
-    if (!antiJamModel_) return 0.0;
-    return antiJamModel_->calculateProtectionEffectiveness();
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return 0.0;
+    return snapshot->antiJamModel.calculateProtectionEffectiveness();
 }
 
 double CommunicationModelAPI::calculateJammerToSignalRatio() const {
-    if (!jammerModel_ || !jammingEnv_.isJammed) return -100.0;
-    return jammerModel_->calculateJammerToSignalRatio();
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !snapshot->jammingEnv.isJammed) return -100.0;
+    return snapshot->jammerModel.calculateJammerToSignalRatio();
 }
 
 double CommunicationModelAPI::calculateRequiredAntiJamGain(double targetBER) const {
-    if (!antiJamModel_) return 0.0;
-    return antiJamModel_->calculateRequiredAntiJamGain(targetBER);
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return 0.0;
+    return snapshot->antiJamModel.calculateRequiredAntiJamGain(targetBER);
 }
 
+/// @brief 计算0.1-100km内每隔0.5km的干扰有效性
+/// @details 按干扰有效性随距离的变化规律直接求值，不修改也不复制干扰模型
 std::vector<double> CommunicationModelAPI::calculateJammerCoverage() const {
     std::vector<double> coverage;
     
-    if (!jammerModel_ || !jammingEnv_.isJammed) {
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !snapshot->jammingEnv.isJammed) {
         return coverage;
     }
     
-    // 计算不同距离下的干扰覆盖
+    const JammerDistanceLaw law = snapshot->jammerModel.calculateEffectivenessDistanceLaw();
     for (double distance = 0.1; distance <= 100.0; distance += 0.5) {
-        jammerModel_->setTargetDistance(distance);
-        double effectiveness = jammerModel_->calculateJammerEffectiveness();
-        coverage.push_back(effectiveness);
+        coverage.push_back(law.evaluate(distance));
     }
     
     return coverage;
 }
 
+namespace {
+    /// @brief 在[start, end]内自适应二分采样，追加(start, end]内的采样点
+    /// @details 区间中点的实际值与两端线性插值之差超过容差时二分，否则只保留区间终点
+    void refineCoverageProfile(const JammerDistanceLaw& law, double start, double startValue,
+                               double end, double endValue, double tolerance, int depth,
+                               CommunicationJammerCoverageProfile& profile) {
+        const double middle = (start + end) / 2.0;
+        const double middleValue = law.evaluate(middle);
+        if (depth < MathConstants::JAMMER_COVERAGE_PROFILE_MAX_DEPTH &&
+            std::fabs(middleValue - (startValue + endValue) / 2.0) > tolerance) {
+            refineCoverageProfile(law, start, startValue, middle, middleValue, tolerance, depth + 1, profile);
+            refineCoverageProfile(law, middle, middleValue, end, endValue, tolerance, depth + 1, profile);
+            return;
+        }
+        profile.distances.push_back(end);
+        profile.effectiveness.push_back(endValue);
+    }
+}
+
+/// @brief 计算干扰有效性随距离变化的剖面
+/// @details 干扰有效性随距离单调不增（见CommunicationJammerModel::calculateEffectivenessDistanceLaw），
+///          饱和边界与各门限的覆盖半径均由变化规律解析求出，并作为剖面的分段点；
+///          各分段内有效性为常数或按幂律平滑下降，只在线性插值误差超过容差处二分加密。
+///          全程按变化规律求值，不修改干扰模型
+/// @param minDistance 起始距离 (km)
+/// @param maxDistance 终止距离 (km)，须大于起始距离，二者均在干扰距离的有效范围内
+/// @param levels 干扰有效性门限
+/// @param profile 输出的干扰覆盖剖面
+/// @param tolerance 线性插值容差，须大于0
+/// @return 参数有效且处于干扰状态时返回true
+bool CommunicationModelAPI::calculateJammerCoverageProfile(double minDistance, double maxDistance,
+                                                           const std::vector<double>& levels,
+                                                           CommunicationJammerCoverageProfile& profile,
+                                                           double tolerance) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !snapshot->jammingEnv.isJammed) return false;
+    if (!CommunicationJammerParameterConfig::isRangeValid(minDistance) ||
+        !CommunicationJammerParameterConfig::isRangeValid(maxDistance) || minDistance >= maxDistance) {
+        return false;
+    }
+    if (!(tolerance > 0.0)) return false;
+
+    const JammerDistanceLaw law = snapshot->jammerModel.calculateEffectivenessDistanceLaw();
+    const double nearValue = law.evaluate(minDistance);
+    const double farValue = law.evaluate(maxDistance);
+
+    profile.levels = levels;
+    profile.coverageRadii.clear();
+    profile.saturationDistance = 0.0;
+    std::vector<double> breakpoints = {minDistance, maxDistance};
+    if (law.exponent > 0.0 && law.ceiling > 0.0) {
+        profile.saturationDistance = std::pow(law.coefficient / law.ceiling, 1.0 / law.exponent);
+        breakpoints.push_back(profile.saturationDistance);
+    }
+    for (double level : levels) {
+        double radius = maxDistance;
+        if (!(nearValue >= level)) {
+            radius = 0.0;
+        } else if (farValue < level) {
+            // 门限落在幂律下降段内：coefficient × d^(-exponent) = level
+            radius = std::min(maxDistance, std::max(minDistance,
+                std::pow(law.coefficient / level, 1.0 / law.exponent)));
+            breakpoints.push_back(radius);
+        }
+        profile.coverageRadii.push_back(radius);
+    }
+
+    std::sort(breakpoints.begin(), breakpoints.end());
+    profile.distances.assign(1, minDistance);
+    profile.effectiveness.assign(1, nearValue);
+    for (double breakpoint : breakpoints) {
+        if (breakpoint <= profile.distances.back() || breakpoint > maxDistance) continue;
+        refineCoverageProfile(law, profile.distances.back(), profile.effectiveness.back(),
+                              breakpoint, law.evaluate(breakpoint), tolerance, 0, profile);
+    }
+    return true;
+}
+
+/// @brief 干扰机-目标分配
+/// @details 以当前干扰模型为模板生成各干扰机的干扰模型，并行构建干扰有效性矩阵后按配置求解，
+///          详见CommunicationJammerAssigner
+/// @return 干扰机、目标与配置均有效时返回true
+bool CommunicationModelAPI::assignJammers(const std::vector<CommunicationAssignmentJammer>& jammers,
+                                          const std::vector<CommunicationAssignmentTarget>& targets,
+                                          const CommunicationAssignmentConfig& config,
+                                          CommunicationAssignmentResult& result) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    try {
+        CommunicationJammerAssigner assigner(snapshot->jammerModel, jammers, targets, snapshot->threadCount);
+        return assigner.assign(config, result);
+    } catch (const std::invalid_argument&) {
+        return false;
+    }
+}
+
+/// @brief 计算全部重叠的(干扰频段, 信道)配对
+/// @details 以信道频段构建CommunicationBandOverlapIndex后扫描一次干扰频段
+/// @param overlaps 输出的重叠配对，按干扰频段序号升序
+/// @return 全部频段有效时返回true
+bool CommunicationModelAPI::calculateBandOverlaps(const std::vector<CommunicationFrequencyBand>& jammers,
+                                                  const std::vector<CommunicationFrequencyBand>& channels,
+                                                  std::vector<CommunicationBandOverlap>& overlaps) const {
+    for (const CommunicationFrequencyBand& band : jammers) {
+        if (!CommunicationBandOverlapIndex::isBandValid(band)) return false;
+    }
+    for (const CommunicationFrequencyBand& band : channels) {
+        if (!CommunicationBandOverlapIndex::isBandValid(band)) return false;
+    }
+    CommunicationBandOverlapIndex index(channels);
+    index.findOverlaps(jammers, overlaps);
+    return true;
+}
+
+/// @brief 由干扰环境生成干扰源列表
+/// @details jammerFrequencies中的每个频率对应一个干扰源，为空时取jammerFrequency；
+///          第k个干扰源位于jammerPositions[k]，未配置位置时均位于(jammerDistance, 0)；
+///          功率与带宽取干扰环境的jammerPower与jammerBandwidth。
+///          jammerDensity描述的是抗干扰模型中的威胁程度，不参与功率聚合
+/// @return 干扰源列表，无干扰时为空
+std::vector<CommunicationJammerEmitter> CommunicationModelAPI::getJammerEmitters() const {
+    std::vector<CommunicationJammerEmitter> jammers;
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !snapshot->jammingEnv.isJammed) {
+        return jammers;
+    }
+    const JammingEnvironment& jammingEnv = snapshot->jammingEnv;
+
+    std::vector<double> frequencies = jammingEnv.jammerFrequencies;
+    if (frequencies.empty()) {
+        frequencies.push_back(jammingEnv.jammerFrequency);
+    }
+    const bool positioned = jammingEnv.jammerPositions.size() == frequencies.size();
+    jammers.reserve(frequencies.size());
+    for (size_t k = 0; k < frequencies.size(); ++k) {
+        CommunicationJammerEmitter jammer;
+        jammer.x = positioned ? jammingEnv.jammerPositions[k].first : jammingEnv.jammerDistance;
+        jammer.y = positioned ? jammingEnv.jammerPositions[k].second : 0.0;
+        jammer.frequency = frequencies[k];
+        jammer.bandwidth = jammingEnv.jammerBandwidth;
+        jammer.power = jammingEnv.jammerPower;
+        jammers.push_back(jammer);
+    }
+    return jammers;
+}
+
+/// @brief 计算多干扰机在各接收点的聚合干扰
+/// @details 发射机位于原点，接收点的信号强度与不计干扰的信噪比按当前环境的链路预算求得；
+///          各干扰源落入接收带宽（工作频率±带宽/2）的功率在线性域求和，
+///          信干噪比 = 信号强度 - 10·log10(等效噪声 + 干扰总功率)，其中等效噪声已计入抗干扰增益
+/// @param jammers 干扰源列表，可以为空
+/// @param receivers 接收点坐标 (km)
+/// @param results 输出的聚合结果，与receivers一一对应
+/// @return 干扰源参数有效返回true
+bool CommunicationModelAPI::calculateAggregateInterference(const std::vector<CommunicationJammerEmitter>& jammers,
+                                                           const std::vector<std::pair<double, double>>& receivers,
+                                                           std::vector<CommunicationAggregateInterference>& results) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    for (const CommunicationJammerEmitter& jammer : jammers) {
+        if (!CommunicationJammerAggregator::isEmitterValid(jammer)) return false;
+    }
+
+    const CommunicationEnvironment& env = snapshot->environment;
+    const LinkBudgetCoefficients budget = snapshot->evaluator.calculateLinkBudgetCoefficients(env);
+    const PositionalLinkCoefficients positional = snapshot->evaluator.calculatePositionalLinkCoefficients(env);
+    const double noisePower = budget.signalAtUnitDistance - positional.jammerFreeSnrAtUnitDistance;
+    const double noiseLinear = std::pow(10.0, noisePower / MathConstants::LINEAR_TO_DB_MULTIPLIER);
+
+    const size_t count = receivers.size();
+    std::vector<double> powers(count);
+    std::vector<uint32_t> activeCounts(count);
+    CommunicationJammerAggregator aggregator(jammers.data(), jammers.size(), snapshot->threadCount);
+    aggregator.calculateInterferencePowerBatch(receivers.data(), count,
+                                               env.frequency - env.bandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR,
+                                               env.frequency + env.bandwidth / MathConstants::BANDWIDTH_HALF_DIVISOR,
+                                               powers.data(), activeCounts.data());
+
+    results.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const double distance = std::max(std::hypot(receivers[i].first, receivers[i].second),
+                                         MathConstants::MIN_DISTANCE_LIMIT);
+        CommunicationAggregateInterference& result = results[i];
+        result.signalStrength = budget.signalAtUnitDistance - budget.distanceSlope * std::log10(distance);
+        result.interferencePower = MathConstants::LINEAR_TO_DB_MULTIPLIER * std::log10(powers[i]);
+        result.jammerToSignalRatio = result.interferencePower - result.signalStrength;
+        result.signalToInterferenceNoiseRatio = result.signalStrength -
+            MathConstants::LINEAR_TO_DB_MULTIPLIER * std::log10(noiseLinear + powers[i]);
+        result.activeJammerCount = activeCounts[i];
+    }
+    return true;
+}
+
+/// @brief 计算当前干扰环境中全部干扰源在各接收点的聚合干扰
+/// @details 干扰源由getJammerEmitters()生成
+bool CommunicationModelAPI::calculateAggregateInterference(const std::vector<std::pair<double, double>>& receivers,
+                                                           std::vector<CommunicationAggregateInterference>& results) const {
+    return calculateAggregateInterference(getJammerEmitters(), receivers, results);
+}
+
 // 性能优化接口
 CommunicationEnvironment CommunicationModelAPI::optimizeForRange(double targetRange) const {
-    CommunicationEnvironment optimized = environment_;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return CommunicationEnvironment();
+    CommunicationEnvironment optimized = snapshot->environment;
     
     // 计算所需功率
-    optimized.transmitPower = calculateRequiredPower(targetRange);
+    optimized.transmitPower = calculateRequiredPowerFor(snapshot->evaluator, snapshot->environment, targetRange);
     
     // 选择最优频率
-    optimized.frequency = calculateOptimalFrequency();
+    optimized.frequency = calculateOptimalFrequencyFor(snapshot->environment.environmentType);
     
     return optimized;
 }
 
 CommunicationEnvironment CommunicationModelAPI::optimizeForDataRate(double targetDataRate) const {
-    CommunicationEnvironment optimized = environment_;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return CommunicationEnvironment();
+    CommunicationEnvironment optimized = snapshot->environment;
     
     // 计算所需带宽
     double spectralEfficiency = 2.0; // 假设值
@@ -516,7 +903,9 @@ CommunicationEnvironment CommunicationModelAPI::optimizeForDataRate(double targe
 }
 
 CommunicationEnvironment CommunicationModelAPI::optimizeForPowerEfficiency() const {
-    CommunicationEnvironment optimized = environment_;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return CommunicationEnvironment();
+    CommunicationEnvironment optimized = snapshot->environment;
     
     // 降低功率到最小可接受水平
     double minSNR = 10.0; // 最小信噪比要求
@@ -529,33 +918,710 @@ CommunicationEnvironment CommunicationModelAPI::optimizeForPowerEfficiency() con
     optimized.transmitPower = std::max(calculatedPower, minTransmitPower);
     
     // 选择功率效率最高的频率
-    optimized.frequency = calculateOptimalFrequency();
+    optimized.frequency = calculateOptimalFrequencyFor(optimized.environmentType);
     
     return optimized;
 }
 
 CommunicationEnvironment CommunicationModelAPI::optimizeForJammerResistance() const {
-    CommunicationEnvironment optimized = environment_;
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return CommunicationEnvironment();
+    CommunicationEnvironment optimized = snapshot->environment;
+    const CommunicationAntiJamModel& antiJamModel = snapshot->antiJamModel;
+    
+    // 增加功率以对抗干扰
+    double requiredGain = antiJamModel.calculateRequiredAntiJamGain(1e-6);
+    optimized.transmitPower += requiredGain;
+    
+    // 选择抗干扰性能最好的频率
+    // 基于抗干扰技术计算最优频率
+    double baseFreq = optimized.frequency;
+    double antiJamGain = antiJamModel.calculateAntiJamGain();
+    
+    // 根据抗干扰增益调整频率选择
+    if (antiJamGain > 20.0) {
+        optimized.frequency = baseFreq * 1.1; // 高抗干扰增益时选择稍高频率
+    } else if (antiJamGain < 10.0) {
+        optimized.frequency = baseFreq * 0.9; // 低抗干扰增益时选择稍低频率
+    }
     
-    if (antiJamModel_) {
-        // 增加功率以对抗干扰
-        double requiredGain = antiJamModel_->calculateRequiredAntiJamGain(1e-6);
-        optimized.transmitPower += requiredGain;
-        
-        // 选择抗干扰性能最好的频率
-        // 基于抗干扰技术计算最优频率
-        double baseFreq = optimized.frequency;
-        double antiJamGain = antiJamModel_->calculateAntiJamGain();
+    return optimized;
+}
+
+// 多场景分析
+/// @brief 参数扫描
+/// @details 扫描点按[start, end]等步长生成，各工作线程处理连续的扫描点区间，
+///          使用线程私有的环境参数副本和共享的只读链路评估器，结果按扫描顺序连续存储
+/// @param parameter 扫描参数
+/// @param start 起始值
+/// @param end 结束值
+/// @param step 步长，必须为正
+/// @return 扫描结果，参数无效时为空
+CommunicationSweepResult CommunicationModelAPI::analyzeParameterSweep(
+    SweepParameter parameter, double start, double end, double step) const {
+    CommunicationSweepResult result;
+    result.parameter = parameter;
+    
+    auto snapshot = loadSnapshot();
+    if (!(step > 0.0) || !(end >= start) || !snapshot) {
+        return result;
+    }
+    
+    double intervals = std::floor((end - start) / step + MathConstants::SWEEP_STEP_TOLERANCE);
+    if (!(intervals < MathConstants::MAX_SWEEP_POINTS)) {
+        return result;
+    }
+    size_t pointCount = static_cast<size_t>(intervals) + 1;
+    
+    result.values.resize(pointCount);
+    result.statuses.resize(pointCount);
+    for (size_t i = 0; i < pointCount; ++i) {
+        result.values[i] = start + static_cast<double>(i) * step;
+    }
+    
+    const CommunicationLinkEvaluator& evaluator = snapshot->evaluator;
+    const bool withDescription = snapshot->statusDescriptionEnabled;
+    int threads = CommunicationParallelExecutor::resolveThreadCount(
+        snapshot->threadCount, pointCount, MathConstants::PARALLEL_MIN_ITEMS_PER_THREAD);
+    
+    CommunicationParallelExecutor::parallelFor(pointCount, threads,
+        [&](size_t begin, size_t endIndex, int) {
+            CommunicationEnvironment env = snapshot->environment;
+            for (size_t i = begin; i < endIndex; ++i) {
+                switch (parameter) {
+                    case SweepParameter::FREQUENCY:
+                        env.frequency = result.values[i];
+                        break;
+                    case SweepParameter::TRANSMIT_POWER:
+                        env.transmitPower = result.values[i];
+                        break;
+                    case SweepParameter::DISTANCE:
+                        env.distance = result.values[i];
+                        break;
+                }
+                result.statuses[i] = evaluator.evaluate(env, withDescription);
+            }
+        });
+    
+    return result;
+}
+
+namespace {
+    std::map<double, CommunicationLinkStatus> toStatusMap(CommunicationSweepResult&& sweep) {
+        std::map<double, CommunicationLinkStatus> statusMap;
+        for (size_t i = 0; i < sweep.values.size(); ++i) {
+            statusMap.emplace_hint(statusMap.end(), sweep.values[i], std::move(sweep.statuses[i]));
+        }
+        return statusMap;
+    }
+}
+
+std::map<double, CommunicationLinkStatus> CommunicationModelAPI::analyzeFrequencyRange(
+    double startFreq, double endFreq, double step) const {
+    return toStatusMap(analyzeParameterSweep(SweepParameter::FREQUENCY, startFreq, endFreq, step));
+}
+
+std::map<double, CommunicationLinkStatus> CommunicationModelAPI::analyzePowerRange(
+    double startPower, double endPower, double step) const {
+    return toStatusMap(analyzeParameterSweep(SweepParameter::TRANSMIT_POWER, startPower, endPower, step));
+}
+
+std::map<double, CommunicationLinkStatus> CommunicationModelAPI::analyzeDistanceRange(
+    double startDistance, double endDistance, double step) const {
+    return toStatusMap(analyzeParameterSweep(SweepParameter::DISTANCE, startDistance, endDistance, step));
+}
+
+// 网络拓扑分析
+/// @brief 计算节点间链路信噪比矩阵
+/// @details 结果写入连续的行主序缓冲区，矩阵容量足够时复用已有内存
+/// @param nodePositions 节点坐标 (km)
+/// @param matrix 输出链路矩阵
+/// @return 计算成功返回true
+bool CommunicationModelAPI::calculateLinkMatrix(const std::vector<std::pair<double, double>>& nodePositions,
+                                                CommunicationLinkMatrix& matrix) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    
+    size_t count = nodePositions.size();
+    matrix.nodeCount = count;
+    matrix.values.resize(count * count);
+    
+    CommunicationNetworkAnalyzer analyzer(snapshot->evaluator, snapshot->threadCount);
+    analyzer.calculateLinkMatrix(nodePositions.data(), count, matrix.values.data());
+    return true;
+}
+
+/// @brief 分析网络连通性
+/// @details 基于均匀网格与并查集，只检查单跳最大连接距离内的候选节点对
+/// @param nodePositions 节点坐标 (km)
+/// @param result 输出的连通性分析结果
+/// @return 计算成功返回true
+bool CommunicationModelAPI::analyzeNetworkConnectivity(const std::vector<std::pair<double, double>>& nodePositions,
+                                                       CommunicationNetworkConnectivity& result) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    
+    CommunicationNetworkAnalyzer analyzer(snapshot->evaluator, snapshot->threadCount);
+    analyzer.analyzeConnectivity(nodePositions.data(), nodePositions.size(), result);
+    return true;
+}
+
+/// @brief 规划中继路径
+/// @details 干扰机位于(jammerDistance, 0)，各跳按接收端到干扰机的距离计算干信比，
+///          在候选网格上求满足连接条件的跳数最少、同跳数下最弱一跳信噪比最大的路径，详见CommunicationRelayPlanner
+/// @param source 源节点坐标 (km)
+/// @param destination 目的节点坐标 (km)
+/// @param maxRelays 最大中继数量
+/// @param plan 输出的中继规划结果
+/// @return 参数有效返回true
+bool CommunicationModelAPI::planRelayPath(const std::pair<double, double>& source,
+                                          const std::pair<double, double>& destination,
+                                          int maxRelays, CommunicationRelayPlan& plan) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    
+    const CommunicationLinkEvaluator& evaluator = snapshot->evaluator;
+    CommunicationRelayPlanner planner(evaluator, evaluator.getJammingEnvironment().jammerDistance, 0.0, snapshot->threadCount);
+    return planner.plan(source, destination, maxRelays, plan);
+}
+
+/// @brief 寻找最优中继位置
+/// @return 中继在候选网格中的编号（见CommunicationRelayPlan），无可行路径或无需中继时为空
+std::vector<int> CommunicationModelAPI::findOptimalRelayPositions(
+    const std::pair<double, double>& source,
+    const std::pair<double, double>& destination,
+    int maxRelays) const {
+    CommunicationRelayPlan plan;
+    if (!planRelayPath(source, destination, maxRelays, plan) || !plan.feasible) {
+        return {};
+    }
+    return plan.relayIndices;
+}
+
+/// @brief 计算网络连通度
+/// @return 多跳可达的节点对占全部节点对的比例 (0-1)
+double CommunicationModelAPI::calculateNetworkConnectivity(
+    const std::vector<std::pair<double, double>>& nodePositions) const {
+    CommunicationNetworkConnectivity result;
+    if (!analyzeNetworkConnectivity(nodePositions, result)) {
+        return 0.0;
+    }
+    return result.connectivity;
+}
+
+std::vector<std::vector<double>> CommunicationModelAPI::calculateLinkMatrix(
+    const std::vector<std::pair<double, double>>& nodePositions) const {
+    CommunicationLinkMatrix matrix;
+    if (!calculateLinkMatrix(nodePositions, matrix)) {
+        return {};
+    }
+    
+    std::vector<std::vector<double>> result(matrix.nodeCount);
+    for (size_t i = 0; i < matrix.nodeCount; ++i) {
+        const float* row = matrix.values.data() + i * matrix.nodeCount;
+        result[i].assign(row, row + matrix.nodeCount);
+    }
+    return result;
+}
+
+// 可视化数据接口
+namespace {
+    /// @brief 由快照构建栅格计算引擎，干扰机位于(jammerDistance, 0)
+    CommunicationRasterEngine makeRasterEngine(const CommunicationLinkEvaluator& evaluator, int threadCount) {
+        return CommunicationRasterEngine(evaluator, evaluator.getJammingEnvironment().jammerDistance, 0.0, threadCount);
+    }
+
+    /// @brief 将栅格转换为(像元中心到发射机距离, 像元值)列表
+    std::vector<std::pair<double, double>> toDistanceValuePairs(const CommunicationRaster& raster) {
+        const CommunicationRasterSpec& spec = raster.spec;
+        double cellWidth = (spec.xMax - spec.xMin) / spec.width;
+        double cellHeight = (spec.yMax - spec.yMin) / spec.height;
         
-        // 根据抗干扰增益调整频率选择
-        if (antiJamGain > 20.0) {
-            optimized.frequency = baseFreq * 1.1; // 高抗干扰增益时选择稍高频率
-        } else if (antiJamGain < 10.0) {
-            optimized.frequency = baseFreq * 0.9; // 低抗干扰增益时选择稍低频率
+        std::vector<std::pair<double, double>> result;
+        result.reserve(raster.values.size());
+        for (int row = 0; row < spec.height; ++row) {
+            double y = spec.yMin + (row + 0.5) * cellHeight;
+            for (int col = 0; col < spec.width; ++col) {
+                double x = spec.xMin + (col + 0.5) * cellWidth;
+                result.emplace_back(std::hypot(x, y), raster.at(row, col));
+            }
         }
+        return result;
+    }
+}
+
+/// @brief 提取覆盖等值线
+/// @details 覆盖判据为可用性（见calculatePerformance）不低于阈值，
+///          采用自适应四叉树细分与marching squares，详见CommunicationCoverageAnalyzer
+/// @param threshold 可用性阈值 (0-1)
+/// @param maxDepth 四叉树最大层级，最细网格为2^maxDepth×2^maxDepth
+/// @param contour 输出的覆盖等值线
+/// @return 参数有效返回true
+bool CommunicationModelAPI::analyzeCoverageContour(double threshold, int maxDepth,
+                                                   CommunicationCoverageContour& contour) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    
+    const CommunicationLinkEvaluator& evaluator = snapshot->evaluator;
+    CommunicationCoverageAnalyzer analyzer(evaluator, evaluator.getJammingEnvironment().jammerDistance, 0.0);
+    return analyzer.extractContour(threshold, maxDepth, contour);
+}
+
+/// @brief 获取覆盖边界
+/// @details 以默认层级提取覆盖等值线，返回其中最长的一条折线（覆盖区域外边界）
+/// @param threshold 可用性阈值 (0-1)
+/// @return 边界点坐标 (km)，闭合时首尾点相同；参数无效或无覆盖区域时为空
+std::vector<std::pair<double, double>> CommunicationModelAPI::getCoverageContour(double threshold) const {
+    CommunicationCoverageContour contour;
+    if (!analyzeCoverageContour(threshold, MathConstants::COVERAGE_CONTOUR_DEFAULT_DEPTH, contour) ||
+        contour.polylines.empty()) {
+        return {};
     }
     
-    return optimized;
+    auto longest = std::max_element(contour.polylines.begin(), contour.polylines.end(),
+        [](const std::vector<std::pair<double, double>>& a, const std::vector<std::pair<double, double>>& b) {
+            return a.size() < b.size();
+        });
+    return std::move(*longest);
+}
+
+/// @brief 计算接收信号强度栅格
+/// @details 栅格容量足够时复用已有内存
+/// @param spec 栅格规格
+/// @param raster 输出栅格，像元值为接收信号强度 (dBm)
+/// @return 规格有效返回true
+bool CommunicationModelAPI::renderSignalStrengthRaster(const CommunicationRasterSpec& spec,
+                                                       CommunicationRaster& raster) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !CommunicationRasterEngine::isSpecValid(spec)) return false;
+    
+    raster.spec = spec;
+    raster.values.resize(static_cast<size_t>(spec.width) * static_cast<size_t>(spec.height));
+    return makeRasterEngine(snapshot->evaluator, snapshot->threadCount).render(
+        RasterQuantity::SIGNAL_STRENGTH, spec, raster.values.data());
+}
+
+/// @brief 计算干信比栅格
+/// @param spec 栅格规格
+/// @param raster 输出栅格，像元值为干信比 (dB)
+/// @return 处于干扰环境且规格有效时返回true
+bool CommunicationModelAPI::renderInterferenceRaster(const CommunicationRasterSpec& spec,
+                                                     CommunicationRaster& raster) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !snapshot->evaluator.getJammingEnvironment().isJammed ||
+        !CommunicationRasterEngine::isSpecValid(spec)) {
+        return false;
+    }
+    
+    raster.spec = spec;
+    raster.values.resize(static_cast<size_t>(spec.width) * static_cast<size_t>(spec.height));
+    return makeRasterEngine(snapshot->evaluator, snapshot->threadCount).render(
+        RasterQuantity::JAMMER_TO_SIGNAL_RATIO, spec, raster.values.data());
+}
+
+/// @brief 计算接收信号强度栅格并写入文件
+/// @details 文件格式见CommunicationRasterFileHeader
+bool CommunicationModelAPI::renderSignalStrengthRasterToFile(const CommunicationRasterSpec& spec,
+                                                             const std::string& filename) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    return makeRasterEngine(snapshot->evaluator, snapshot->threadCount).renderToFile(
+        RasterQuantity::SIGNAL_STRENGTH, spec, filename);
+}
+
+/// @brief 计算干信比栅格并写入文件
+/// @details 文件格式见CommunicationRasterFileHeader
+bool CommunicationModelAPI::renderInterferenceRasterToFile(const CommunicationRasterSpec& spec,
+                                                           const std::string& filename) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !snapshot->evaluator.getJammingEnvironment().isJammed) return false;
+    return makeRasterEngine(snapshot->evaluator, snapshot->threadCount).renderToFile(
+        RasterQuantity::JAMMER_TO_SIGNAL_RATIO, spec, filename);
+}
+
+/// @brief 获取信号强度分布
+/// @details resolution×resolution行主序像元，第0行对应yMin一侧
+/// @return (像元中心到发射机距离 km, 接收信号强度 dBm)列表，参数无效时为空
+std::vector<std::pair<double, double>> CommunicationModelAPI::getSignalStrengthMap(
+    double xMin, double xMax, double yMin, double yMax, int resolution) const {
+    CommunicationRaster raster;
+    if (!renderSignalStrengthRaster({xMin, xMax, yMin, yMax, resolution, resolution}, raster)) {
+        return {};
+    }
+    return toDistanceValuePairs(raster);
+}
+
+/// @brief 获取干扰分布
+/// @details resolution×resolution行主序像元，第0行对应yMin一侧
+/// @return (像元中心到发射机距离 km, 干信比 dB)列表，无干扰或参数无效时为空
+std::vector<std::pair<double, double>> CommunicationModelAPI::getInterferenceMap(
+    double xMin, double xMax, double yMin, double yMax, int resolution) const {
+    CommunicationRaster raster;
+    if (!renderInterferenceRaster({xMin, xMax, yMin, yMax, resolution, resolution}, raster)) {
+        return {};
+    }
+    return toDistanceValuePairs(raster);
+}
+
+// 实时监控接口
+namespace {
+    /**
+     * @brief 由监控记录中的数值指标还原链路状态
+     */
+    CommunicationLinkStatus toLinkStatus(const CommunicationLinkMetrics& metrics, bool withDescription) {
+        CommunicationLinkStatus status;
+        status.isConnected = metrics.isConnected;
+        status.signalStrength = metrics.signalStrength;
+        status.signalToNoiseRatio = metrics.signalToNoiseRatio;
+        status.bitErrorRate = metrics.bitErrorRate;
+        status.throughput = metrics.throughput;
+        status.latency = metrics.latency;
+        status.packetLossRate = metrics.packetLossRate;
+        status.quality = metrics.quality;
+        if (withDescription) {
+            status.statusDescription = CommunicationLinkEvaluator::formatStatusDescription(metrics);
+        }
+        return status;
+    }
+}
+
+/// @brief 以默认周期启动实时监控
+/// @return 启动成功返回true，已在监控时返回false
+bool CommunicationModelAPI::startRealTimeMonitoring() {
+    return startRealTimeMonitoring(MathConstants::MONITOR_DEFAULT_INTERVAL_MS);
+}
+
+/// @brief 启动实时监控
+/// @details 后台线程每隔intervalMs以当前求值快照重新求值一次链路指标并写入历史记录，
+///          参数修改后的链路指标在下一个采样时刻生效；再次启动时保留已有历史记录
+/// @param intervalMs 采样周期 (ms)
+/// @return 启动成功返回true，周期无效或已在监控时返回false
+bool CommunicationModelAPI::startRealTimeMonitoring(int intervalMs) {
+    if (intervalMs <= 0 || isMonitoring()) return false;
+    if (!monitor_) {
+        monitor_ = std::make_unique<CommunicationStatusMonitor>(
+            static_cast<size_t>(MathConstants::MONITOR_HISTORY_CAPACITY));
+        prediction_ = std::make_unique<PredictionState>(monitor_->getCapacity());
+    }
+    auto snapshot = loadSnapshot();
+    if (snapshot) {
+        monitor_->publish(makeMonitorSampler(std::move(snapshot)));
+    }
+    return monitor_->start(intervalMs);
+}
+
+/// @brief 停止实时监控
+/// @return 停止前正在监控返回true
+bool CommunicationModelAPI::stopRealTimeMonitoring() {
+    return monitor_ && monitor_->stop();
+}
+
+bool CommunicationModelAPI::isMonitoring() const {
+    return monitor_ && monitor_->isRunning();
+}
+
+/// @brief 获取当前链路状态
+/// @details 监控中返回最近一次采样结果，否则直接计算当前链路状态
+CommunicationLinkStatus CommunicationModelAPI::getCurrentStatus() const {
+    CommunicationStatusRecord record;
+    if (isMonitoring() && monitor_->getLatest(record)) {
+        return toLinkStatus(record.metrics, loadSnapshot()->statusDescriptionEnabled);
+    }
+    return calculateLinkStatus();
+}
+
+/// @brief 获取监控历史
+/// @param count 最多返回的记录数
+/// @return 最近count条记录对应的链路状态，按时间从早到晚排列
+std::vector<CommunicationLinkStatus> CommunicationModelAPI::getStatusHistory(int count) const {
+    std::vector<CommunicationLinkStatus> statuses;
+    if (count <= 0 || !monitor_) return statuses;
+
+    std::vector<CommunicationStatusRecord> records(
+        std::min(static_cast<size_t>(count), monitor_->getCapacity()));
+    records.resize(monitor_->getHistory(records.data(), records.size()));
+    const bool withDescription = loadSnapshot()->statusDescriptionEnabled;
+    statuses.reserve(records.size());
+    for (const auto& record : records) {
+        statuses.push_back(toLinkStatus(record.metrics, withDescription));
+    }
+    return statuses;
+}
+
+/// @brief 获取监控历史（不分配内存）
+/// @details 读取过程不加锁，不阻塞监控线程
+/// @param records 输出数组，长度不小于count
+/// @param count 请求的记录数
+/// @return 实际写入的记录数，按时间从早到晚排列
+size_t CommunicationModelAPI::getStatusHistory(CommunicationStatusRecord* records, size_t count) const {
+    if (!monitor_) return 0;
+    return monitor_->getHistory(records, count);
+}
+
+// 预测和仿真
+/// @brief 预测未来链路状态
+/// @details 以监控历史中尚未消费的记录增量更新卡尔曼预测器（每条记录O(1)），
+///          再把信号强度与信噪比外推到最近一次采样后timeSeconds秒，由二者推导其余指标；
+///          尚无监控历史时链路参数视为不变，返回当前链路状态。
+///          新增记录读入预测状态持有的缓冲区，除生成状态描述外不分配内存
+/// @param timeSeconds 预测时长 (s)，负值或非有限值时返回当前链路状态
+/// @return 预测的链路状态
+CommunicationLinkStatus CommunicationModelAPI::predictFutureStatus(double timeSeconds) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !monitor_ || !prediction_ || !(timeSeconds >= 0.0) || !std::isfinite(timeSeconds)) {
+        return getCurrentStatus();
+    }
+
+    double signalStrength = 0.0;
+    double snr = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(prediction_->mutex);
+        const uint64_t recordCount = monitor_->getRecordCount();
+        const size_t pending = static_cast<size_t>(std::min<uint64_t>(
+            recordCount - prediction_->consumedRecords, monitor_->getCapacity()));
+        if (pending > 0) {
+            // 读取期间可能有新记录写入，按时刻跳过已消费过的记录
+            const CommunicationStatusRecord* records = prediction_->records.data();
+            const size_t count = monitor_->getHistory(prediction_->records.data(), pending);
+            CommunicationLinkPredictor& predictor = prediction_->predictor;
+            for (size_t i = 0; i < count; ++i) {
+                if (!predictor.hasEstimate(0) || records[i].timestamp > predictor.getLastTimestamp(0)) {
+                    predictor.update(0, records[i]);
+                }
+            }
+            prediction_->consumedRecords = recordCount;
+        }
+        if (!prediction_->predictor.predict(0, timeSeconds, signalStrength, snr)) {
+            return getCurrentStatus();
+        }
+    }
+
+    CommunicationLinkStatus status = CommunicationLinkEvaluator::deriveLinkStatus(
+        signalStrength, snr, snapshot->environment.bandwidth, snapshot->environment.distance);
+    if (snapshot->statusDescriptionEnabled) {
+        status.statusDescription = CommunicationLinkEvaluator::formatStatusDescription(status);
+    }
+    return status;
+}
+
+/// @brief 流式时变信道仿真
+/// @details 样本按时间顺序分块交付给回调，不在内存中保存完整序列，适合长时间仿真；
+///          相同种子下结果与线程数无关
+/// @param duration 仿真时长 (s)
+/// @param timeStep 时间步长 (s)
+/// @param callback 样本回调，返回false时停止仿真
+/// @return 参数有效返回true
+bool CommunicationModelAPI::simulateTimeVaryingChannel(double duration, double timeStep,
+                                                       const CommunicationChannelSampleCallback& callback) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    CommunicationChannelSimulator simulator(snapshot->evaluator, snapshot->randomSeed, snapshot->threadCount);
+    return simulator.simulate(duration, timeStep, callback);
+}
+
+/// @brief 分段流式时变信道仿真
+/// @details 从progress.completedSamples起继续交付样本，回调返回false时停在已交付的位置；
+///          进度可写入检查点，恢复后再次调用即从中断处续跑，样本与一次仿真完全相同
+/// @param progress 仿真进度，completedSamples为0时取当前种子
+/// @param callback 样本回调，返回false时停止仿真
+/// @return 参数有效返回true
+bool CommunicationModelAPI::simulateTimeVaryingChannel(CommunicationChannelProgress& progress,
+                                                       const CommunicationChannelSampleCallback& callback) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    if (progress.completedSamples == 0) {
+        progress.seed = snapshot->randomSeed;
+    }
+    CommunicationChannelSimulator simulator(snapshot->evaluator, progress.seed, snapshot->threadCount);
+    return simulator.simulate(progress.duration, progress.timeStep, progress.completedSamples, callback);
+}
+
+/// @brief 时变信道仿真
+/// @details 与流式接口的样本一一对应，样本数超过MAX_SWEEP_POINTS时返回空列表
+/// @return 各采样时刻的链路状态，参数无效时为空
+std::vector<CommunicationLinkStatus> CommunicationModelAPI::simulateTimeVaryingChannel(
+    double duration, double timeStep) const {
+    std::vector<CommunicationLinkStatus> statuses;
+    auto snapshot = loadSnapshot();
+    uint64_t sampleCount = 0;
+    if (!snapshot || !CommunicationChannelSimulator::calculateSampleCount(duration, timeStep, sampleCount) ||
+        !(static_cast<double>(sampleCount) <= MathConstants::MAX_SWEEP_POINTS)) {
+        return statuses;
+    }
+
+    CommunicationChannelSimulator simulator(snapshot->evaluator, snapshot->randomSeed, snapshot->threadCount);
+    const bool withDescription = snapshot->statusDescriptionEnabled;
+    statuses.reserve(static_cast<size_t>(sampleCount));
+    simulator.simulate(duration, timeStep, [&](const CommunicationChannelSample* samples, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            // 由阴影损耗重新推导双精度链路状态，样本中的数值指标为单精度
+            statuses.push_back(simulator.evaluateSample(samples[i].shadowingLoss));
+            if (withDescription) {
+                statuses.back().statusDescription =
+                    CommunicationLinkEvaluator::formatStatusDescription(statuses.back());
+            }
+        }
+        return true;
+    });
+    return statuses;
+}
+
+/// @brief 流式移动场景仿真
+/// @details 接收机依次位于各航迹点，发射机位于原点，干扰机位于(jammerDistance, 0)；
+///          结果分块交付给回调，内存占用与航迹长度无关
+/// @param trajectory 航迹点数组 (km)
+/// @param count 航迹点数量
+/// @param timeStep 相邻航迹点的时间间隔 (s)
+/// @param callback 样本回调，返回false时停止仿真
+/// @return 参数有效返回true
+bool CommunicationModelAPI::simulateMobilityScenario(const std::pair<double, double>* trajectory, size_t count,
+                                                     double timeStep,
+                                                     const CommunicationMobilitySampleCallback& callback) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    CommunicationMobilitySimulator simulator(snapshot->evaluator,
+                                             snapshot->evaluator.getJammingEnvironment().jammerDistance, 0.0,
+                                             snapshot->threadCount);
+    return simulator.simulate(trajectory, count, timeStep, callback);
+}
+
+/// @brief 移动场景仿真
+/// @details 与流式接口的样本一一对应（链路状态为双精度）
+/// @return 各航迹点的链路状态，参数无效时为空
+std::vector<CommunicationLinkStatus> CommunicationModelAPI::simulateMobilityScenario(
+    const std::vector<std::pair<double, double>>& trajectory, double timeStep) const {
+    std::vector<CommunicationLinkStatus> statuses;
+    auto snapshot = loadSnapshot();
+    if (!snapshot || !(timeStep > 0.0) || std::isinf(timeStep)) {
+        return statuses;
+    }
+
+    CommunicationMobilitySimulator simulator(snapshot->evaluator,
+                                             snapshot->evaluator.getJammingEnvironment().jammerDistance, 0.0,
+                                             snapshot->threadCount);
+    statuses.resize(trajectory.size());
+    if (!simulator.evaluateTrajectory(trajectory.data(), trajectory.size(), statuses.data())) {
+        return {};
+    }
+    if (snapshot->statusDescriptionEnabled) {
+        for (auto& status : statuses) {
+            status.statusDescription = CommunicationLinkEvaluator::formatStatusDescription(status);
+        }
+    }
+    return statuses;
+}
+
+/// @brief 蒙特卡洛链路可用性分析
+/// @details 在当前链路预算上随机抽取阴影衰落、瑞利衰落与干扰参数扰动，
+///          并行求各次试验的链路指标，以单遍累加器给出均值、方差与置信区间；
+///          相同种子下结果与线程数无关
+/// @param config 分析配置
+/// @param result 输出的统计结果
+/// @return 配置有效返回true
+bool CommunicationModelAPI::analyzeAvailabilityMonteCarlo(const CommunicationMonteCarloConfig& config,
+                                                          CommunicationMonteCarloResult& result) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    CommunicationMonteCarloEngine engine(snapshot->evaluator, snapshot->randomSeed, snapshot->threadCount);
+    return engine.run(config, result);
+}
+
+/// @brief 分段蒙特卡洛链路可用性分析
+/// @details 每次调用再执行至少maxTrials次试验并累加到progress，直至完成config.trialCount次；
+///          各段之间可写入检查点，恢复后继续调用的最终结果与一次分析逐位一致
+/// @param progress 分析进度，completedTrials为0时取当前种子并清空结果
+/// @param maxTrials 本段最少执行的试验次数
+/// @return 配置与进度有效返回true
+bool CommunicationModelAPI::analyzeAvailabilityMonteCarlo(CommunicationMonteCarloProgress& progress,
+                                                          uint64_t maxTrials) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    if (progress.completedTrials == 0) {
+        progress.seed = snapshot->randomSeed;
+    }
+    CommunicationMonteCarloEngine engine(snapshot->evaluator, progress.seed, snapshot->threadCount);
+    return engine.resume(progress, maxTrials);
+}
+
+/// @brief 干扰时序离散事件仿真
+/// @details 数据包占用当前工作频率与带宽；配置未给出干扰源时，
+///          若存在干扰则按当前干扰环境的频率、带宽与干扰模型的脉冲、扫频参数构造一个干扰源
+bool CommunicationModelAPI::simulateJammerTiming(const CommunicationTimingConfig& config,
+                                                 CommunicationTimingResult& result) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    const JammingEnvironment& jammingEnv = snapshot->jammingEnv;
+    CommunicationTimingSimulator simulator(snapshot->environment.frequency, snapshot->environment.bandwidth);
+    if (!config.jammers.empty() || !jammingEnv.isJammed) {
+        return simulator.run(config, result);
+    }
+
+    CommunicationTimingConfig jammedConfig = config;
+    jammedConfig.jammers.push_back(CommunicationTimingSimulator::fromJammerModel(
+        snapshot->jammerModel, jammingEnv.jammerFrequency, jammingEnv.jammerBandwidth));
+    return simulator.run(jammedConfig, result);
+}
+
+/// @brief 跳频与干扰碰撞仿真
+/// @details 跳频信道数、信道间隔、跳频速率与驻留时间取自抗干扰模型，跳频频带以当前工作频率为中心；
+///          干扰源的缺省规则与simulateJammerTiming相同
+bool CommunicationModelAPI::simulateFrequencyHopping(const CommunicationHoppingConfig& config,
+                                                     CommunicationHoppingResult& result) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+    const CommunicationAntiJamModel& antiJamModel = snapshot->antiJamModel;
+    const JammingEnvironment& jammingEnv = snapshot->jammingEnv;
+    CommunicationHoppingSimulator simulator(snapshot->environment.frequency, antiJamModel.getHoppingChannels(),
+                                            antiJamModel.getChannelSpacing(), antiJamModel.getHoppingRate(),
+                                            antiJamModel.getDwellTime(), snapshot->randomSeed,
+                                            snapshot->threadCount);
+    if (!config.jammers.empty() || !jammingEnv.isJammed) {
+        return simulator.run(config, result);
+    }
+
+    CommunicationHoppingConfig jammedConfig = config;
+    jammedConfig.jammers.push_back(CommunicationTimingSimulator::fromJammerModel(
+        snapshot->jammerModel, jammingEnv.jammerFrequency, jammingEnv.jammerBandwidth));
+    return simulator.run(jammedConfig, result);
+}
+
+// 高级功能
+/// @brief 设置并行计算线程数
+/// @details 重建求值快照，正在进行的查询仍按原线程数完成
+/// @param count 线程数，小于等于0表示使用硬件线程数
+void CommunicationModelAPI::setThreadCount(int count) {
+    threadCount_ = count > 0 ? count : 0;
+    rebuildSnapshot();
+}
+
+/// @brief 获取并行计算线程数
+/// @return 实际使用的最大线程数
+int CommunicationModelAPI::getThreadCount() const {
+    const int threadCount = loadSnapshot()->threadCount;
+    return threadCount > 0 ? threadCount : CommunicationParallelExecutor::getHardwareThreadCount();
+}
+
+/// @brief 设置随机数主种子
+/// @details 时变信道、蒙特卡洛与跳频仿真的各随机数子流均由主种子派生，
+///          第i个样本只由(主种子, 子流编号, i)决定，相同主种子下结果与线程数无关
+/// @param seed 主种子
+void CommunicationModelAPI::setRandomSeed(uint64_t seed) {
+    randomSeed_ = seed;
+    rebuildSnapshot();
+}
+
+uint64_t CommunicationModelAPI::getRandomSeed() const {
+    auto snapshot = loadSnapshot();
+    return snapshot ? snapshot->randomSeed : randomSeed_;
+}
+
+/// @brief 派生调用方使用的随机数子流
+/// @details 由主种子的USER_DEFINED子流按index派生，可按线程、分块或样本编号分配，
+///          各子流互不相关且可任意跳转；配合CommunicationRandomSequence可顺序读取
+/// @param index 子流编号
+/// @return 随机数流
+CommunicationRandomStream CommunicationModelAPI::createRandomStream(uint64_t index) const {
+    return CommunicationRandomStream(getRandomSeed(), RandomStreamId::USER_DEFINED).substream(index);
 }
 
 // 版本信息
@@ -573,7 +1639,7 @@ std::string CommunicationModelAPI::getModelInfo() const {
     oss << "包含模型: 信号传输、通信距离、接收机、干扰机、抗干扰" << std::endl;
     oss << "当前场景: ";
     
-    switch (currentScenario_) {
+    switch (getScenario()) {
         case CommunicationScenario::NORMAL_COMMUNICATION:
             oss << "正常通信";
             break;
@@ -604,12 +1670,13 @@ bool CommunicationModelAPI::saveConfiguration(const std::string& filename) const
         return false;
     }
     
+    const CommunicationEnvironment environment = getEnvironment();
     file << "# Communication Model Configuration" << std::endl;
-    file << "frequency=" << environment_.frequency << std::endl;
-    file << "transmitPower=" << environment_.transmitPower << std::endl;
-    file << "bandwidth=" << environment_.bandwidth << std::endl;
-    file << "distance=" << environment_.distance << std::endl;
-    file << "environmentType=" << static_cast<int>(environment_.environmentType) << std::endl;
+    file << "frequency=" << environment.frequency << std::endl;
+    file << "transmitPower=" << environment.transmitPower << std::endl;
+    file << "bandwidth=" << environment.bandwidth << std::endl;
+    file << "distance=" << environment.distance << std::endl;
+    file << "environmentType=" << static_cast<int>(environment.environmentType) << std::endl;
     
     file.close();
     return true;
@@ -651,13 +1718,14 @@ bool CommunicationModelAPI::loadConfiguration(const std::string& filename) {
 }
 
 std::string CommunicationModelAPI::exportConfigurationToJSON() const {
+    const CommunicationEnvironment environment = getEnvironment();
     std::ostringstream oss;
     oss << "{" << std::endl;
-    oss << "  \"frequency\": " << environment_.frequency << "," << std::endl;
-    oss << "  \"transmitPower\": " << environment_.transmitPower << "," << std::endl;
-    oss << "  \"bandwidth\": " << environment_.bandwidth << "," << std::endl;
-    oss << "  \"distance\": " << environment_.distance << "," << std::endl;
-    oss << "  \"environmentType\": " << static_cast<int>(environment_.environmentType) << std::endl;
+    oss << "  \"frequency\": " << environment.frequency << "," << std::endl;
+    oss << "  \"transmitPower\": " << environment.transmitPower << "," << std::endl;
+    oss << "  \"bandwidth\": " << environment.bandwidth << "," << std::endl;
+    oss << "  \"distance\": " << environment.distance << "," << std::endl;
+    oss << "  \"environmentType\": " << static_cast<int>(environment.environmentType) << std::endl;
     oss << "}" << std::endl;
     return oss.str();
 }
@@ -725,6 +1793,529 @@ bool CommunicationModelAPI::importConfigurationFromJSON(const std::string& jsonS
     }
 }
 
+// 检查点
+namespace {
+    // 各节按字段顺序写入：枚举写为int32_t，布尔写为uint8_t，数值按原类型写入，
+    // 不经过带对齐填充的结构体，同一状态总是写出相同的字节。布局长度为各字段字节数之和
+    constexpr uint32_t SETTINGS_LAYOUT = sizeof(int32_t) + sizeof(uint8_t);
+    constexpr uint32_t ENVIRONMENT_LAYOUT = 8 * sizeof(double) + sizeof(int32_t);
+    constexpr uint32_t JAMMING_LAYOUT = sizeof(uint8_t) + sizeof(int32_t) + 5 * sizeof(double);
+    constexpr uint32_t SIGNAL_MODEL_LAYOUT = 2 * sizeof(int32_t) + 3 * sizeof(double);
+    constexpr uint32_t DISTANCE_MODEL_LAYOUT = sizeof(int32_t) + 6 * sizeof(double);
+    constexpr uint32_t RECEIVE_MODEL_LAYOUT = 2 * sizeof(int32_t) + 7 * sizeof(double);
+    constexpr uint32_t JAMMER_MODEL_LAYOUT = 2 * sizeof(int32_t) + 15 * sizeof(double);
+    constexpr uint32_t ANTI_JAM_MODEL_LAYOUT = 4 * sizeof(int32_t) + 15 * sizeof(double);
+    constexpr uint32_t MONTE_CARLO_LAYOUT = sizeof(uint64_t) + 2 * sizeof(uint8_t) + 3 * sizeof(double);
+
+    // 以下对象直接按原始内存写入，须保证没有对齐填充
+    static_assert(sizeof(CommunicationChannelProgress) == 2 * sizeof(double) + 2 * sizeof(uint64_t),
+                  "时变信道仿真进度不能含对齐填充");
+    static_assert(sizeof(CommunicationRunningStatistics) == sizeof(uint64_t) + 4 * sizeof(double),
+                  "累加器不能含对齐填充");
+
+    // 各枚举的取值个数，读取时据此检查范围
+    constexpr int32_t SCENARIO_COUNT = static_cast<int32_t>(CommunicationScenario::MESH_COMMUNICATION) + 1;
+    constexpr int32_t ENVIRONMENT_TYPE_COUNT = static_cast<int32_t>(EnvironmentType::MOUNTAINOUS) + 1;
+    constexpr int32_t JAMMER_TYPE_COUNT = static_cast<int32_t>(JammerType::SPOT) + 1;
+    constexpr int32_t JAMMER_STRATEGY_COUNT = static_cast<int32_t>(JammerStrategy::RANDOM) + 1;
+    constexpr int32_t FREQUENCY_BAND_COUNT = static_cast<int32_t>(FrequencyBand::MICROWAVE) + 1;
+    constexpr int32_t MODULATION_COUNT = static_cast<int32_t>(ModulationType::QAM16) + 1;
+    constexpr int32_t RECEIVE_MODULATION_COUNT = static_cast<int32_t>(ReceiveModulationType::QAM16) + 1;
+    constexpr int32_t RECEIVER_TYPE_COUNT = static_cast<int32_t>(ReceiverType::SOFTWARE_DEFINED) + 1;
+    constexpr int32_t ANTI_JAM_TECHNIQUE_COUNT = static_cast<int32_t>(AntiJamTechnique::INTERFERENCE_CANCELLATION) + 1;
+    constexpr int32_t ANTI_JAM_STRATEGY_COUNT = static_cast<int32_t>(AntiJamStrategy::COGNITIVE) + 1;
+
+    template <typename E>
+    void writeEnum(CommunicationCheckpointWriter& writer, E value) {
+        writer.write(static_cast<int32_t>(value));
+    }
+
+    void writeFlag(CommunicationCheckpointWriter& writer, bool value) {
+        writer.write(static_cast<uint8_t>(value ? 1 : 0));
+    }
+
+    /// @brief 读取枚举，取值必须在[0, count)内
+    template <typename E>
+    bool readEnum(CommunicationCheckpointReader& reader, int32_t count, E& value) {
+        int32_t raw = 0;
+        if (!reader.read(raw) || raw < 0 || raw >= count) return false;
+        value = static_cast<E>(raw);
+        return true;
+    }
+
+    /// @brief 读取布尔值，只接受0与1
+    bool readFlag(CommunicationCheckpointReader& reader, bool& value) {
+        uint8_t raw = 0;
+        if (!reader.read(raw) || raw > 1) return false;
+        value = raw != 0;
+        return true;
+    }
+
+    bool readFinite(CommunicationCheckpointReader& reader, double& value) {
+        return reader.read(value) && std::isfinite(value);
+    }
+
+    template <typename T>
+    void writeObjectSection(CommunicationCheckpointWriter& writer, uint32_t tag, const T& value) {
+        writer.beginSection(tag, static_cast<uint32_t>(sizeof(T)));
+        writer.write(value);
+        writer.endSection();
+    }
+
+    template <typename T>
+    bool readObjectSection(CommunicationCheckpointReader& reader, uint32_t tag, T& value) {
+        return reader.openSection(tag, static_cast<uint32_t>(sizeof(T))) && reader.read(value);
+    }
+
+    void writeEnvironment(CommunicationCheckpointWriter& writer, const CommunicationEnvironment& environment) {
+        writer.beginSection(CommunicationCheckpointFormat::SECTION_ENVIRONMENT, ENVIRONMENT_LAYOUT);
+        writer.write(environment.frequency);
+        writer.write(environment.bandwidth);
+        writer.write(environment.transmitPower);
+        writer.write(environment.noisePower);
+        writer.write(environment.distance);
+        writeEnum(writer, environment.environmentType);
+        writer.write(environment.temperature);
+        writer.write(environment.humidity);
+        writer.write(environment.atmosphericPressure);
+        writer.endSection();
+    }
+
+    bool readEnvironment(CommunicationCheckpointReader& reader, CommunicationEnvironment& environment) {
+        return reader.openSection(CommunicationCheckpointFormat::SECTION_ENVIRONMENT, ENVIRONMENT_LAYOUT) &&
+               readFinite(reader, environment.frequency) && readFinite(reader, environment.bandwidth) &&
+               readFinite(reader, environment.transmitPower) && readFinite(reader, environment.noisePower) &&
+               readFinite(reader, environment.distance) &&
+               readEnum(reader, ENVIRONMENT_TYPE_COUNT, environment.environmentType) &&
+               readFinite(reader, environment.temperature) && readFinite(reader, environment.humidity) &&
+               readFinite(reader, environment.atmosphericPressure);
+    }
+
+    void writeJamming(CommunicationCheckpointWriter& writer, const JammingEnvironment& jamming) {
+        writer.beginSection(CommunicationCheckpointFormat::SECTION_JAMMING, JAMMING_LAYOUT);
+        writeFlag(writer, jamming.isJammed);
+        writeEnum(writer, jamming.jammerType);
+        writer.write(jamming.jammerPower);
+        writer.write(jamming.jammerFrequency);
+        writer.write(jamming.jammerBandwidth);
+        writer.write(jamming.jammerDistance);
+        writer.write(jamming.jammerDensity);
+        writer.writeArray(jamming.jammerFrequencies.data(), jamming.jammerFrequencies.size());
+        std::vector<double> xs, ys;
+        for (const auto& position : jamming.jammerPositions) {
+            xs.push_back(position.first);
+            ys.push_back(position.second);
+        }
+        writer.writeArray(xs.data(), xs.size());
+        writer.writeArray(ys.data(), ys.size());
+        writer.endSection();
+    }
+
+    bool readJamming(CommunicationCheckpointReader& reader, JammingEnvironment& jamming) {
+        if (!reader.openSection(CommunicationCheckpointFormat::SECTION_JAMMING, JAMMING_LAYOUT) ||
+            !readFlag(reader, jamming.isJammed) || !readEnum(reader, JAMMER_TYPE_COUNT, jamming.jammerType) ||
+            !readFinite(reader, jamming.jammerPower) || !readFinite(reader, jamming.jammerFrequency) ||
+            !readFinite(reader, jamming.jammerBandwidth) || !readFinite(reader, jamming.jammerDistance) ||
+            !readFinite(reader, jamming.jammerDensity) || !reader.readArray(jamming.jammerFrequencies)) {
+            return false;
+        }
+        auto finite = [](double value) { return std::isfinite(value); };
+        if (!std::all_of(jamming.jammerFrequencies.begin(), jamming.jammerFrequencies.end(), finite)) {
+            return false;
+        }
+
+        // 干扰源坐标按横、纵坐标两列写入，个数为0或与干扰源个数一致
+        std::vector<double> xs, ys;
+        size_t emitterCount = jamming.jammerFrequencies.empty() ? 1 : jamming.jammerFrequencies.size();
+        if (!reader.readArray(xs) || !reader.readArray(ys) || xs.size() != ys.size() ||
+            (!xs.empty() && xs.size() != emitterCount) ||
+            !std::all_of(xs.begin(), xs.end(), finite) || !std::all_of(ys.begin(), ys.end(), finite)) {
+            return false;
+        }
+        jamming.jammerPositions.clear();
+        for (size_t k = 0; k < xs.size(); ++k) {
+            jamming.jammerPositions.emplace_back(xs[k], ys[k]);
+        }
+        return true;
+    }
+
+    void writeSignalModel(CommunicationCheckpointWriter& writer, const SignalTransmissionModel& model) {
+        writer.beginSection(CommunicationCheckpointFormat::SECTION_SIGNAL_MODEL, SIGNAL_MODEL_LAYOUT);
+        writeEnum(writer, model.getFrequencyBand());
+        writer.write(model.getCenterFrequency());
+        writeEnum(writer, model.getModulationType());
+        writer.write(model.getSignalBandwidth());
+        writer.write(model.getTransmitPower());
+        writer.endSection();
+    }
+
+    /// @brief 读取信号传输模型，参数经模型的设置方法校验；先设频段再设中心频率
+    bool readSignalModel(CommunicationCheckpointReader& reader, SignalTransmissionModel& model) {
+        FrequencyBand band;
+        ModulationType modulation;
+        double centerFrequency = 0.0;
+        double bandwidth = 0.0;
+        double power = 0.0;
+        if (!reader.openSection(CommunicationCheckpointFormat::SECTION_SIGNAL_MODEL, SIGNAL_MODEL_LAYOUT) ||
+            !readEnum(reader, FREQUENCY_BAND_COUNT, band) || !reader.read(centerFrequency) ||
+            !readEnum(reader, MODULATION_COUNT, modulation) || !reader.read(bandwidth) || !reader.read(power)) {
+            return false;
+        }
+        model.setFrequencyBand(band);
+        model.setModulationType(modulation);
+        return model.setCenterFrequency(centerFrequency) && model.setSignalBandwidth(bandwidth) &&
+               model.setTransmitPower(power);
+    }
+
+    void writeDistanceModel(CommunicationCheckpointWriter& writer, const CommunicationDistanceModel& model) {
+        writer.beginSection(CommunicationCheckpointFormat::SECTION_DISTANCE_MODEL, DISTANCE_MODEL_LAYOUT);
+        writer.write(model.getMaxLineOfSight());
+        writeEnum(writer, model.getEnvironmentType());
+        writer.write(model.getEnvAttenuation());
+        writer.write(model.getReceiveSensitivity());
+        writer.write(model.getLinkMargin());
+        writer.write(model.getTransmitPower());
+        writer.endSection();
+    }
+
+    /// @brief 读取距离模型；设置环境类型会重置衰减系数，因此先设环境类型
+    bool readDistanceModel(CommunicationCheckpointReader& reader, CommunicationDistanceModel& model) {
+        EnvironmentType environmentType;
+        double maxLineOfSight = 0.0;
+        double attenuation = 0.0;
+        double sensitivity = 0.0;
+        double margin = 0.0;
+        double power = 0.0;
+        if (!reader.openSection(CommunicationCheckpointFormat::SECTION_DISTANCE_MODEL, DISTANCE_MODEL_LAYOUT) ||
+            !reader.read(maxLineOfSight) || !readEnum(reader, ENVIRONMENT_TYPE_COUNT, environmentType) ||
+            !reader.read(attenuation) || !reader.read(sensitivity) || !reader.read(margin) || !reader.read(power)) {
+            return false;
+        }
+        model.setEnvironmentType(environmentType);
+        return model.setMaxLineOfSight(maxLineOfSight) && model.setEnvAttenuation(attenuation) &&
+               model.setReceiveSensitivity(sensitivity) && model.setLinkMargin(margin) &&
+               model.setTransmitPower(power);
+    }
+
+    void writeReceiveModel(CommunicationCheckpointWriter& writer, const CommunicationReceiveModel& model) {
+        writer.beginSection(CommunicationCheckpointFormat::SECTION_RECEIVE_MODEL, RECEIVE_MODEL_LAYOUT);
+        writer.write(model.getReceiveSensitivity());
+        writer.write(model.getNoiseFigure());
+        writer.write(model.getSystemBandwidth());
+        writeEnum(writer, model.getModulationType());
+        writeEnum(writer, model.getReceiverType());
+        writer.write(model.getAmbientTemperature());
+        writer.write(model.getAntennaGain());
+        writer.write(model.getDetectionThreshold());
+        writer.write(model.getReceivedPower());
+        writer.endSection();
+    }
+
+    /// @brief 读取接收模型；噪声底由设置方法重新计算，不写入检查点
+    bool readReceiveModel(CommunicationCheckpointReader& reader, CommunicationReceiveModel& model) {
+        ReceiveModulationType modulation;
+        ReceiverType receiverType;
+        double sensitivity = 0.0;
+        double noiseFigure = 0.0;
+        double bandwidth = 0.0;
+        double temperature = 0.0;
+        double antennaGain = 0.0;
+        double threshold = 0.0;
+        double receivedPower = 0.0;
+        if (!reader.openSection(CommunicationCheckpointFormat::SECTION_RECEIVE_MODEL, RECEIVE_MODEL_LAYOUT) ||
+            !reader.read(sensitivity) || !reader.read(noiseFigure) || !reader.read(bandwidth) ||
+            !readEnum(reader, RECEIVE_MODULATION_COUNT, modulation) ||
+            !readEnum(reader, RECEIVER_TYPE_COUNT, receiverType) || !reader.read(temperature) ||
+            !reader.read(antennaGain) || !reader.read(threshold) || !reader.read(receivedPower)) {
+            return false;
+        }
+        model.setModulationType(modulation);
+        model.setReceiverType(receiverType);
+        return model.setReceiveSensitivity(sensitivity) && model.setNoiseFigure(noiseFigure) &&
+               model.setSystemBandwidth(bandwidth) && model.setAmbientTemperature(temperature) &&
+               model.setAntennaGain(antennaGain) && model.setDetectionThreshold(threshold) &&
+               model.setReceivedPower(receivedPower);
+    }
+
+    void writeJammerModel(CommunicationCheckpointWriter& writer, const CommunicationJammerModel& model) {
+        writer.beginSection(CommunicationCheckpointFormat::SECTION_JAMMER_MODEL, JAMMER_MODEL_LAYOUT);
+        writeEnum(writer, model.getJammerType());
+        writeEnum(writer, model.getJammerStrategy());
+        writer.write(model.getJammerPower());
+        writer.write(model.getJammerFrequency());
+        writer.write(model.getJammerBandwidth());
+        writer.write(model.getJammerRange());
+        writer.write(model.getTargetFrequency());
+        writer.write(model.getTargetBandwidth());
+        writer.write(model.getTargetPower());
+        writer.write(model.getTargetDistance());
+        writer.write(model.getPulseWidth());
+        writer.write(model.getPulseRepetitionRate());
+        writer.write(model.getDutyCycle());
+        writer.write(model.getSweepRate());
+        writer.write(model.getSweepRange());
+        writer.write(model.getPropagationLoss());
+        writer.write(model.getAtmosphericLoss());
+        writer.endSection();
+    }
+
+    /// @brief 读取干扰模型；设置脉冲重复频率会按脉宽重算占空比，因此最后设占空比
+    bool readJammerModel(CommunicationCheckpointReader& reader, CommunicationJammerModel& model) {
+        JammerType type;
+        JammerStrategy strategy;
+        double values[15] = {};
+        if (!reader.openSection(CommunicationCheckpointFormat::SECTION_JAMMER_MODEL, JAMMER_MODEL_LAYOUT) ||
+            !readEnum(reader, JAMMER_TYPE_COUNT, type) || !readEnum(reader, JAMMER_STRATEGY_COUNT, strategy)) {
+            return false;
+        }
+        for (double& value : values) {
+            if (!reader.read(value)) return false;
+        }
+        model.setJammerType(type);
+        model.setJammerStrategy(strategy);
+        return model.setJammerPower(values[0]) && model.setJammerFrequency(values[1]) &&
+               model.setJammerBandwidth(values[2]) && model.setJammerRange(values[3]) &&
+               model.setTargetFrequency(values[4]) && model.setTargetBandwidth(values[5]) &&
+               model.setTargetPower(values[6]) && model.setTargetDistance(values[7]) &&
+               model.setPulseWidth(values[8]) && model.setPulseRepetitionRate(values[9]) &&
+               model.setDutyCycle(values[10]) && model.setSweepRate(values[11]) &&
+               model.setSweepRange(values[12]) && model.setPropagationLoss(values[13]) &&
+               model.setAtmosphericLoss(values[14]);
+    }
+
+    void writeAntiJamModel(CommunicationCheckpointWriter& writer, const CommunicationAntiJamModel& model) {
+        writer.beginSection(CommunicationCheckpointFormat::SECTION_ANTI_JAM_MODEL, ANTI_JAM_MODEL_LAYOUT);
+        writeEnum(writer, model.getAntiJamTechnique());
+        writeEnum(writer, model.getAntiJamStrategy());
+        writer.write(static_cast<int32_t>(model.getHoppingChannels()));
+        writer.write(static_cast<int32_t>(model.getChipRate()));
+        writer.write(model.getProcessingGain());
+        writer.write(model.getSpreadingFactor());
+        writer.write(model.getHoppingRate());
+        writer.write(model.getCodingGain());
+        writer.write(model.getSystemBandwidth());
+        writer.write(model.getSignalPower());
+        writer.write(model.getNoisePower());
+        writer.write(model.getInterferenceLevel());
+        writer.write(model.getChannelSpacing());
+        writer.write(model.getDwellTime());
+        writer.write(model.getSequenceLength());
+        writer.write(model.getAdaptationSpeed());
+        writer.write(model.getConvergenceThreshold());
+        writer.write(model.getEnvironmentType());
+        writer.write(model.getJammerDensity());
+        writer.endSection();
+    }
+
+    bool readAntiJamModel(CommunicationCheckpointReader& reader, CommunicationAntiJamModel& model) {
+        AntiJamTechnique technique;
+        AntiJamStrategy strategy;
+        int32_t hoppingChannels = 0;
+        int32_t chipRate = 0;
+        double values[15] = {};
+        if (!reader.openSection(CommunicationCheckpointFormat::SECTION_ANTI_JAM_MODEL, ANTI_JAM_MODEL_LAYOUT) ||
+            !readEnum(reader, ANTI_JAM_TECHNIQUE_COUNT, technique) ||
+            !readEnum(reader, ANTI_JAM_STRATEGY_COUNT, strategy) || !reader.read(hoppingChannels) ||
+            !reader.read(chipRate)) {
+            return false;
+        }
+        for (double& value : values) {
+            if (!reader.read(value)) return false;
+        }
+        // 构造函数的默认码片速率超出设置方法的取值范围，与默认值相同时保留默认值
+        const bool chipRateRestored = chipRate == model.getChipRate() || model.setChipRate(chipRate);
+        return chipRateRestored && model.setAntiJamTechnique(technique) && model.setAntiJamStrategy(strategy) &&
+               model.setHoppingChannels(hoppingChannels) &&
+               model.setProcessingGain(values[0]) && model.setSpreadingFactor(values[1]) &&
+               model.setHoppingRate(values[2]) && model.setCodingGain(values[3]) &&
+               model.setSystemBandwidth(values[4]) && model.setSignalPower(values[5]) &&
+               model.setNoisePower(values[6]) && model.setInterferenceLevel(values[7]) &&
+               model.setChannelSpacing(values[8]) && model.setDwellTime(values[9]) &&
+               model.setSequenceLength(values[10]) && model.setAdaptationSpeed(values[11]) &&
+               model.setConvergenceThreshold(values[12]) && model.setEnvironmentType(values[13]) &&
+               model.setJammerDensity(values[14]);
+    }
+
+    void writeMonteCarloProgress(CommunicationCheckpointWriter& writer, const CommunicationMonteCarloProgress& progress) {
+        const CommunicationMonteCarloConfig& config = progress.config;
+        const CommunicationMonteCarloResult& result = progress.result;
+        writer.beginSection(CommunicationCheckpointFormat::SECTION_MONTE_CARLO_PROGRESS, MONTE_CARLO_LAYOUT);
+        writer.write(config.trialCount);
+        writeFlag(writer, config.shadowing);
+        writeFlag(writer, config.rayleighFading);
+        writer.write(config.jammerPowerStdDev);
+        writer.write(config.jammerDistanceStdDev);
+        writer.write(config.confidence);
+        writer.write(progress.seed);
+        writer.write(progress.completedTrials);
+        writer.write(result.trialCount);
+        writer.write(result.confidence);
+        writer.write(result.snr);
+        writer.write(result.availability);
+        writer.write(result.throughput);
+        writer.write(result.outage);
+        result.snrDistribution.saveState(writer);
+        result.throughputDistribution.saveState(writer);
+        writer.endSection();
+    }
+
+    /// @brief 读取蒙特卡洛分析进度，配置须能通过引擎的校验且已完成的试验数不超过总数；
+    ///        各累加器须自洽且样本数等于已完成的试验数，分位数草图的状态由其loadState校验
+    bool readMonteCarloProgress(CommunicationCheckpointReader& reader, CommunicationMonteCarloProgress& progress) {
+        CommunicationMonteCarloConfig& config = progress.config;
+        CommunicationMonteCarloResult& result = progress.result;
+        if (!reader.openSection(CommunicationCheckpointFormat::SECTION_MONTE_CARLO_PROGRESS, MONTE_CARLO_LAYOUT) ||
+            !reader.read(config.trialCount) || !readFlag(reader, config.shadowing) ||
+            !readFlag(reader, config.rayleighFading) || !reader.read(config.jammerPowerStdDev) ||
+            !reader.read(config.jammerDistanceStdDev) || !reader.read(config.confidence) ||
+            !CommunicationMonteCarloEngine::isConfigValid(config)) {
+            return false;
+        }
+        if (!reader.read(progress.seed) || !reader.read(progress.completedTrials) ||
+            progress.completedTrials > config.trialCount || !reader.read(result.trialCount) ||
+            !reader.read(result.confidence) || !reader.read(result.snr) || !reader.read(result.availability) ||
+            !reader.read(result.throughput) || !reader.read(result.outage)) {
+            return false;
+        }
+        for (const CommunicationRunningStatistics* statistics :
+             {&result.snr, &result.availability, &result.throughput, &result.outage}) {
+            if (!statistics->isValid() || statistics->getCount() != progress.completedTrials) return false;
+        }
+        return result.snrDistribution.loadState(reader) && result.throughputDistribution.loadState(reader);
+    }
+}
+
+/// @brief 写入二进制检查点
+/// @details 依次写入场景与运行选项、通信环境、随机数主种子、干扰环境与五个子模型的参数，
+///          可选地附带时变信道仿真与蒙特卡洛分析的进度（含随机数种子、计数器与累加器）。
+///          各节逐字段写入，不含对齐填充，同一状态两次写出的字节完全相同。
+///          线程数取决于运行主机，不写入检查点
+/// @param buffer 输出缓冲区，原有内容被替换
+/// @param channelProgress 时变信道仿真进度，为空时不写入
+/// @param monteCarloProgress 蒙特卡洛分析进度，为空时不写入
+/// @return 写入成功返回true
+bool CommunicationModelAPI::saveCheckpoint(std::vector<uint8_t>& buffer,
+                                           const CommunicationChannelProgress* channelProgress,
+                                           const CommunicationMonteCarloProgress* monteCarloProgress) const {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return false;
+
+    CommunicationCheckpointWriter writer(buffer);
+    writer.beginSection(CommunicationCheckpointFormat::SECTION_SETTINGS, SETTINGS_LAYOUT);
+    writeEnum(writer, snapshot->scenario);
+    writeFlag(writer, snapshot->statusDescriptionEnabled);
+    writer.endSection();
+    writeEnvironment(writer, snapshot->environment);
+    writeObjectSection(writer, CommunicationCheckpointFormat::SECTION_RANDOM, snapshot->randomSeed);
+    writeJamming(writer, snapshot->jammingEnv);
+
+    writeSignalModel(writer, snapshot->signalModel);
+    writeDistanceModel(writer, snapshot->distanceModel);
+    writeReceiveModel(writer, snapshot->receiveModel);
+    writeJammerModel(writer, snapshot->jammerModel);
+    writeAntiJamModel(writer, snapshot->antiJamModel);
+
+    if (channelProgress) {
+        writeObjectSection(writer, CommunicationCheckpointFormat::SECTION_CHANNEL_PROGRESS, *channelProgress);
+    }
+    if (monteCarloProgress) {
+        writeMonteCarloProgress(writer, *monteCarloProgress);
+    }
+    writer.finish();
+    return true;
+}
+
+/// @brief 从二进制检查点恢复
+/// @details 先把全部节读入临时对象，枚举须在取值范围内、布尔值只能为0或1，
+///          子模型参数逐一经模型的设置方法校验；任何一节缺失、布局不符、取值非法或数据损坏时
+///          返回false且API状态不变。成功后整体替换环境参数与子模型并重建求值快照。
+///          不调用环境到子模型的同步，以保留检查点中单独调整过的子模型参数；
+///          线程数、实时监控状态与历史不属于检查点
+/// @param data 检查点数据
+/// @param size 数据长度
+/// @param channelProgress 输出的时变信道仿真进度，非空时检查点必须包含该进度
+/// @param monteCarloProgress 输出的蒙特卡洛分析进度，非空时检查点必须包含该进度
+/// @return 恢复成功返回true
+bool CommunicationModelAPI::loadCheckpoint(const uint8_t* data, size_t size,
+                                           CommunicationChannelProgress* channelProgress,
+                                           CommunicationMonteCarloProgress* monteCarloProgress) {
+    CommunicationCheckpointReader reader(data, size);
+    if (!reader.isValid()) return false;
+
+    CommunicationScenario scenario;
+    bool statusDescriptionEnabled = false;
+    CommunicationEnvironment environment;
+    JammingEnvironment jammingEnv;
+    SignalTransmissionModel signalModel;
+    CommunicationDistanceModel distanceModel;
+    CommunicationReceiveModel receiveModel;
+    CommunicationJammerModel jammerModel;
+    CommunicationAntiJamModel antiJamModel;
+    if (!reader.openSection(CommunicationCheckpointFormat::SECTION_SETTINGS, SETTINGS_LAYOUT) ||
+        !readEnum(reader, SCENARIO_COUNT, scenario) || !readFlag(reader, statusDescriptionEnabled) ||
+        !readEnvironment(reader, environment) || !readJamming(reader, jammingEnv) ||
+        !readSignalModel(reader, signalModel) || !readDistanceModel(reader, distanceModel) ||
+        !readReceiveModel(reader, receiveModel) || !readJammerModel(reader, jammerModel) ||
+        !readAntiJamModel(reader, antiJamModel)) {
+        return false;
+    }
+
+    uint64_t randomSeed = CommunicationRandomStream::DEFAULT_SEED;
+    if (!readObjectSection(reader, CommunicationCheckpointFormat::SECTION_RANDOM, randomSeed)) {
+        return false;
+    }
+
+    CommunicationChannelProgress channel;
+    if (channelProgress &&
+        !readObjectSection(reader, CommunicationCheckpointFormat::SECTION_CHANNEL_PROGRESS, channel)) {
+        return false;
+    }
+    CommunicationMonteCarloProgress monteCarlo;
+    if (monteCarloProgress && !readMonteCarloProgress(reader, monteCarlo)) {
+        return false;
+    }
+
+    currentScenario_ = scenario;
+    statusDescriptionEnabled_ = statusDescriptionEnabled;
+    randomSeed_ = randomSeed;
+    environment_ = environment;
+    jammingEnv_ = std::move(jammingEnv);
+    *signalModel_ = signalModel;
+    *distanceModel_ = distanceModel;
+    *receiveModel_ = receiveModel;
+    *jammerModel_ = jammerModel;
+    *antiJamModel_ = antiJamModel;
+    rebuildSnapshot();
+
+    if (channelProgress) *channelProgress = channel;
+    if (monteCarloProgress) *monteCarloProgress = std::move(monteCarlo);
+    return true;
+}
+
+bool CommunicationModelAPI::saveCheckpointToFile(const std::string& filename,
+                                                 const CommunicationChannelProgress* channelProgress,
+                                                 const CommunicationMonteCarloProgress* monteCarloProgress) const {
+    std::vector<uint8_t> buffer;
+    if (!saveCheckpoint(buffer, channelProgress, monteCarloProgress)) return false;
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(file);
+}
+
+bool CommunicationModelAPI::loadCheckpointFromFile(const std::string& filename,
+                                                   CommunicationChannelProgress* channelProgress,
+                                                   CommunicationMonteCarloProgress* monteCarloProgress) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+    std::streamoff length = file.tellg();
+    if (length <= 0) return false;
+    std::vector<uint8_t> buffer(static_cast<size_t>(length));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), length)) return false;
+    return loadCheckpoint(buffer.data(), buffer.size(), channelProgress, monteCarloProgress);
+}
+
 std::string CommunicationModelAPI::getCapabilities() const {
     std::ostringstream oss;
     oss << "通信模型API功能列表:" << std::endl;
@@ -748,15 +2339,18 @@ std::string CommunicationModelAPI::generateDetailedReport() const {
     oss << "构建信息: " << getBuildInfo() << std::endl;
     oss << std::endl;
     
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return oss.str();
+    const CommunicationEnvironment& environment = snapshot->environment;
     oss << "当前环境参数:" << std::endl;
-    oss << "- 频率: " << environment_.frequency << " MHz" << std::endl;
-    oss << "- 带宽: " << environment_.bandwidth << " MHz" << std::endl;
-    oss << "- 发射功率: " << environment_.transmitPower << " dBm" << std::endl;
-    oss << "- 距离: " << environment_.distance << " km" << std::endl;
-    oss << "- 环境类型: " << static_cast<int>(environment_.environmentType) << std::endl;
+    oss << "- 频率: " << environment.frequency << " MHz" << std::endl;
+    oss << "- 带宽: " << environment.bandwidth << " MHz" << std::endl;
+    oss << "- 发射功率: " << environment.transmitPower << " dBm" << std::endl;
+    oss << "- 距离: " << environment.distance << " km" << std::endl;
+    oss << "- 环境类型: " << static_cast<int>(environment.environmentType) << std::endl;
     oss << std::endl;
     
-    auto status = calculateLinkStatus();
+    const CommunicationLinkStatus& status = snapshot->status;
     oss << "链路状态:" << std::endl;
     oss << "- 信号强度: " << status.signalStrength << " dBm" << std::endl;
     oss << "- 信噪比: " << status.signalToNoiseRatio << " dB" << std::endl;
@@ -806,23 +2400,26 @@ std::string CommunicationModelAPI::generateJammingAnalysisReport() const {
     std::ostringstream oss;
     oss << "=== 干扰分析报告 ===" << std::endl;
     
-    if (jammingEnv_.isJammed) {
+    auto snapshot = loadSnapshot();
+    if (!snapshot) return oss.str();
+    const JammingEnvironment& jammingEnv = snapshot->jammingEnv;
+    if (jammingEnv.isJammed) {
         oss << "干扰状态: 存在干扰" << std::endl;
-        oss << "干扰类型: " << static_cast<int>(jammingEnv_.jammerType) << std::endl;
-        oss << "干扰功率: " << jammingEnv_.jammerPower << " dBm" << std::endl;
-        oss << "干扰频率: " << jammingEnv_.jammerFrequency << " MHz" << std::endl;
-        oss << "干扰距离: " << jammingEnv_.jammerDistance << " km" << std::endl;
+        oss << "干扰类型: " << static_cast<int>(jammingEnv.jammerType) << std::endl;
+        oss << "干扰功率: " << jammingEnv.jammerPower << " dBm" << std::endl;
+        oss << "干扰频率: " << jammingEnv.jammerFrequency << " MHz" << std::endl;
+        oss << "干扰距离: " << jammingEnv.jammerDistance << " km" << std::endl;
         oss << std::endl;
         
-        double jammerEffect = calculateJammerEffectiveness();
+        double jammerEffect = snapshot->jammerModel.calculateJammerEffectiveness();
         oss << "干扰效果分析:" << std::endl;
         oss << "- 干扰有效性: " << jammerEffect << std::endl;
         
-        double jsr = calculateJammerToSignalRatio();
+        double jsr = snapshot->jammerModel.calculateJammerToSignalRatio();
         oss << "- 干信比: " << jsr << " dB" << std::endl;
         
-        if (currentScenario_ == CommunicationScenario::ANTI_JAM_COMMUNICATION) {
-            double antiJamEffect = calculateAntiJamEffectiveness();
+        if (snapshot->scenario == CommunicationScenario::ANTI_JAM_COMMUNICATION) {
+            double antiJamEffect = snapshot->antiJamModel.calculateProtectionEffectiveness();
             oss << "- 抗干扰效果: " << antiJamEffect << std::endl;
         }
     } else {
@@ -178,6 +178,25 @@ namespace {
         perf->interceptionResistance = cppPerf.interceptionResistance;
     }
 
+    // 将扫描结果复制到C数组（由CommModel_FreeDoubleArray/CommModel_FreeLinkStatusArray释放）
+    void ToCSweepResult(const CommunicationSweepResult& sweep, DoubleArray* values, LinkStatusArray* results) {
+        int count = static_cast<int>(sweep.values.size());
+        values->count = count;
+        values->values = nullptr;
+        results->count = count;
+        results->statuses = nullptr;
+        if (count == 0) return;
+        
+        std::unique_ptr<double[]> cValues(new double[count]);
+        std::unique_ptr<CommLinkStatus[]> cStatuses(new CommLinkStatus[count]);
+        for (int i = 0; i < count; ++i) {
+            cValues[i] = sweep.values[i];
+            ToCLinkStatus(sweep.statuses[i], &cStatuses[i]);
+        }
+        values->values = cValues.release();
+        results->statuses = cStatuses.release();
+    }
+
     // 错误处理宏
     #define SAFE_CALL(call) \
         try { \
@@ -481,6 +500,67 @@ CommModel_OptimizeForJammerResistance(CommModelHandle handle, CommEnvironment* o
     );
 }
 
+// ============================================================================
+// 多场景分析
+// ============================================================================
+
+COMMUNICATION_MODEL_API CommResult COMMUNICATION_MODEL_CALL 
+CommModel_AnalyzeFrequencyRange(CommModelHandle handle, 
+                                double startFreq, 
+                                double endFreq, 
+                                double step,
+                                DoubleArray* frequencies,
+                                LinkStatusArray* results) {
+    VALIDATE_HANDLE(handle);
+    VALIDATE_POINTER(frequencies);
+    VALIDATE_POINTER(results);
+    
+    if (step <= 0.0 || endFreq < startFreq) return COMM_ERROR_INVALID_PARAMETER;
+    
+    SAFE_CALL(
+        auto sweep = api->analyzeParameterSweep(SweepParameter::FREQUENCY, startFreq, endFreq, step);
+        ToCSweepResult(sweep, frequencies, results);
+    );
+}
+
+COMMUNICATION_MODEL_API CommResult COMMUNICATION_MODEL_CALL 
+CommModel_AnalyzePowerRange(CommModelHandle handle, 
+                            double startPower, 
+                            double endPower, 
+                            double step,
+                            DoubleArray* powers,
+                            LinkStatusArray* results) {
+    VALIDATE_HANDLE(handle);
+    VALIDATE_POINTER(powers);
+    VALIDATE_POINTER(results);
+    
+    if (step <= 0.0 || endPower < startPower) return COMM_ERROR_INVALID_PARAMETER;
+    
+    SAFE_CALL(
+        auto sweep = api->analyzeParameterSweep(SweepParameter::TRANSMIT_POWER, startPower, endPower, step);
+        ToCSweepResult(sweep, powers, results);
+    );
+}
+
+COMMUNICATION_MODEL_API CommResult COMMUNICATION_MODEL_CALL 
+CommModel_AnalyzeDistanceRange(CommModelHandle handle, 
+                               double startDistance, 
+                               double endDistance, 
+                               double step,
+                               DoubleArray* distances,
+                               LinkStatusArray* results) {
+    VALIDATE_HANDLE(handle);
+    VALIDATE_POINTER(distances);
+    VALIDATE_POINTER(results);
+    
+    if (step <= 0.0 || endDistance < startDistance) return COMM_ERROR_INVALID_PARAMETER;
+    
+    SAFE_CALL(
+        auto sweep = api->analyzeParameterSweep(SweepParameter::DISTANCE, startDistance, endDistance, step);
+        ToCSweepResult(sweep, distances, results);
+    );
+}
+
 // ============================================================================
 // 报告生成
 // ============================================================================
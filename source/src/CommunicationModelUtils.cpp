@@ -5,6 +5,7 @@
 #include <cmath>
 #include <algorithm>
 #include <numeric>
+#include <limits>
 
 // 前向声明的枚举类型定义
 enum class CommunicationQuality {
@@ -167,19 +168,68 @@ namespace CommunicationModelUtils {
     double calculatePercentile(const std::vector<double>& values, double percentile) {
         if (values.empty()) return 0.0;
         
-        std::vector<double> sortedValues = values;
-        std::sort(sortedValues.begin(), sortedValues.end());
+        double result = 0.0;
+        std::vector<double> workspace = values;
+        calculatePercentilesInPlace(workspace, &percentile, 1, &result);
+        return result;
+    }
+    
+    std::vector<double> calculatePercentiles(const std::vector<double>& values, const std::vector<double>& percentiles) {
+        std::vector<double> results(percentiles.size(), 0.0);
+        if (values.empty() || percentiles.empty()) return results;
         
-        double index = (percentile / 100.0) * (sortedValues.size() - 1);
-        int lowerIndex = static_cast<int>(std::floor(index));
-        int upperIndex = static_cast<int>(std::ceil(index));
+        std::vector<double> workspace = values;
+        calculatePercentilesInPlace(workspace, percentiles.data(), percentiles.size(), results.data());
+        return results;
+    }
+    
+    void calculatePercentilesInPlace(std::vector<double>& values, const double* percentiles, size_t count,
+                                     double* results) {
+        if (count == 0) return;
+        if (values.empty()) {
+            std::fill(results, results + count, 0.0);
+            return;
+        }
         
-        if (lowerIndex == upperIndex) {
-            return sortedValues[lowerIndex];
+        // 按秩从小到大处理，每次只在上一个秩之后的区间内选择，总代价约为O(n)；
+        // NaN不满足严格弱序，不参与排序，其结果直接为NaN
+        std::vector<size_t> order;
+        order.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (std::isnan(percentiles[i])) {
+                results[i] = std::numeric_limits<double>::quiet_NaN();
+            } else {
+                order.push_back(i);
+            }
         }
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return percentiles[a] < percentiles[b]; });
         
-        double weight = index - lowerIndex;
-        return sortedValues[lowerIndex] * (1.0 - weight) + sortedValues[upperIndex] * weight;
+        const size_t lastIndex = values.size() - 1;
+        auto begin = values.begin();
+        size_t partitioned = 0;     // [0, partitioned)已位于最终位置
+        for (size_t k : order) {
+            double index = std::min(1.0, std::max(0.0, percentiles[k] / 100.0)) * lastIndex;
+            size_t lowerIndex = static_cast<size_t>(std::floor(index));
+            
+            if (lowerIndex >= partitioned) {
+                std::nth_element(begin + partitioned, begin + lowerIndex, values.end());
+                partitioned = lowerIndex + 1;
+            }
+            double lower = values[lowerIndex];
+            double weight = index - lowerIndex;
+            if (weight == 0.0 || lowerIndex == lastIndex) {
+                results[k] = lower;
+                continue;
+            }
+            
+            // 上侧相邻秩的值为右侧区间的最小值
+            if (partitioned <= lowerIndex + 1) {
+                std::nth_element(begin + lowerIndex + 1, begin + lowerIndex + 1, values.end());
+                partitioned = lowerIndex + 2;
+            }
+            double upper = values[lowerIndex + 1];
+            results[k] = lower * (1.0 - weight) + upper * weight;
+        }
     }
     
     std::pair<double, double> calculateConfidenceInterval(const std::vector<double>& values, double confidence) {
@@ -188,20 +238,19 @@ namespace CommunicationModelUtils {
         double mean = calculateMean(values);
         double stdDev = calculateStandardDeviation(values);
         
-        // 使用t分布的近似值（对于大样本，接近正态分布）
-        double alpha = 1.0 - confidence;
-        double tValue = MathConstants::CONFIDENCE_T_VALUE_95; // 95%置信度的近似值
-        
-        if (confidence > 0.99) tValue = MathConstants::CONFIDENCE_T_VALUE_99;
-        else if (confidence > 0.95) tValue = MathConstants::CONFIDENCE_T_VALUE_95;
-        else if (confidence > 0.90) tValue = MathConstants::CONFIDENCE_T_VALUE_90;
-        else tValue = 1.28;
-        
-        double margin = tValue * stdDev / std::sqrt(values.size());
+        double margin = calculateConfidenceCriticalValue(confidence) * stdDev / std::sqrt(values.size());
         
         return {mean - margin, mean + margin};
     }
     
+    double calculateConfidenceCriticalValue(double confidence) {
+        // 使用t分布的近似值（对于大样本，接近正态分布）
+        if (confidence > 0.99) return MathConstants::CONFIDENCE_T_VALUE_99;
+        if (confidence > 0.95) return MathConstants::CONFIDENCE_T_VALUE_95;
+        if (confidence > 0.90) return MathConstants::CONFIDENCE_T_VALUE_90;
+        return 1.28;
+    }
+    
     // ==================== 兼容性函数 ====================
     
     CommunicationQuality evaluateQuality(double snr, double ber) {
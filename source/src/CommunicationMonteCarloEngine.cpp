@@ -0,0 +1,159 @@
+#include "CommunicationMonteCarloEngine.h"
+#include "CommunicationParallelExecutor.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+namespace {
+    // 每批分配给单个线程的分块数，分摊批间同步开销
+    constexpr size_t BLOCKS_PER_THREAD_PER_BATCH = 16;
+}
+
+struct CommunicationMonteCarloEngine::BlockStatistics {
+    CommunicationRunningStatistics snr;
+    CommunicationRunningStatistics availability;
+    CommunicationRunningStatistics throughput;
+    CommunicationRunningStatistics outage;
+    CommunicationQuantileSketch snrDistribution;
+    CommunicationQuantileSketch throughputDistribution;
+};
+
+CommunicationMonteCarloEngine::CommunicationMonteCarloEngine(const CommunicationLinkEvaluator& evaluator,
+                                                             uint64_t seed, int threadCount)
+    : shadowingStream_(seed, RandomStreamId::MONTE_CARLO_SHADOWING)
+    , fadingStream_(seed, RandomStreamId::MONTE_CARLO_FADING)
+    , jammerPowerStream_(seed, RandomStreamId::MONTE_CARLO_JAMMER_POWER)
+    , jammerDistanceStream_(seed, RandomStreamId::MONTE_CARLO_JAMMER_DISTANCE)
+    , threadCount_(threadCount) {
+    const CommunicationEnvironment& env = evaluator.getEnvironment();
+    CommunicationLinkStatus base = evaluator.evaluate(env, false);
+    baseSignalStrength_ = base.signalStrength;
+    baseSnr_ = base.signalToNoiseRatio;
+    bandwidth_ = env.bandwidth;
+    distance_ = env.distance;
+    shadowingStdDev_ = evaluator.getLossConfig(env.environmentType).shadowingStdDev;
+    jammerDistance_ = evaluator.getJammingEnvironment().jammerDistance;
+    jammed_ = evaluator.getJammingEnvironment().isJammed;
+}
+
+bool CommunicationMonteCarloEngine::isConfigValid(const CommunicationMonteCarloConfig& config) {
+    return config.trialCount >= 2 &&
+           static_cast<double>(config.trialCount) <= MathConstants::MAX_MONTE_CARLO_TRIALS &&
+           config.jammerPowerStdDev >= 0.0 && std::isfinite(config.jammerPowerStdDev) &&
+           config.jammerDistanceStdDev >= 0.0 && std::isfinite(config.jammerDistanceStdDev) &&
+           config.confidence > 0.0 && config.confidence < 1.0;
+}
+
+/// @brief 计算第index次试验的链路状态
+/// @details 阴影与衰落同时降低信号强度与信噪比；干扰功率升高ΔP dB或干扰距离由dj变为dj'时，
+///          干信比增加 ΔP + FSPL系数 * log10(dj / dj')，信噪比相应降低
+CommunicationLinkStatus CommunicationMonteCarloEngine::evaluateTrial(const CommunicationMonteCarloConfig& config,
+                                                                     uint64_t index) const {
+    double loss = 0.0;
+    if (config.shadowing && shadowingStdDev_ > 0.0) {
+        loss += shadowingStdDev_ * shadowingStream_.normal(index);
+    }
+    if (config.rayleighFading) {
+        double gain = -std::log(fadingStream_.uniform(index));
+        loss -= MathConstants::LINEAR_TO_DB_MULTIPLIER * std::log10(gain);
+    }
+
+    double jammerToSignalShift = 0.0;
+    if (jammed_) {
+        if (config.jammerPowerStdDev > 0.0) {
+            jammerToSignalShift += config.jammerPowerStdDev * jammerPowerStream_.normal(index);
+        }
+        if (config.jammerDistanceStdDev > 0.0) {
+            double distance = std::max(jammerDistance_ + config.jammerDistanceStdDev * jammerDistanceStream_.normal(index),
+                                       MathConstants::MIN_DISTANCE_LIMIT);
+            jammerToSignalShift += MathConstants::FSPL_DISTANCE_COEFFICIENT * std::log10(jammerDistance_ / distance);
+        }
+    }
+
+    return CommunicationLinkEvaluator::deriveLinkStatus(baseSignalStrength_ - loss,
+                                                        baseSnr_ - loss - jammerToSignalShift,
+                                                        bandwidth_, distance_);
+}
+
+void CommunicationMonteCarloEngine::runBlock(const CommunicationMonteCarloConfig& config, uint64_t first,
+                                             uint64_t count, BlockStatistics& statistics) const {
+    for (uint64_t i = first; i < first + count; ++i) {
+        CommunicationLinkStatus status = evaluateTrial(config, i);
+        statistics.snr.add(status.signalToNoiseRatio);
+        statistics.availability.add(CommunicationLinkEvaluator::calculateAvailability(status.signalToNoiseRatio));
+        statistics.throughput.add(status.throughput);
+        statistics.outage.add(status.isConnected ? 0.0 : 1.0);
+        statistics.snrDistribution.add(status.signalToNoiseRatio);
+        statistics.throughputDistribution.add(status.throughput);
+    }
+}
+
+bool CommunicationMonteCarloEngine::run(const CommunicationMonteCarloConfig& config,
+                                        CommunicationMonteCarloResult& result) const {
+    CommunicationMonteCarloProgress progress;
+    progress.config = config;
+    progress.seed = 0;
+    progress.completedTrials = 0;
+    if (!resume(progress, config.trialCount)) return false;
+    result = progress.result;
+    return true;
+}
+
+bool CommunicationMonteCarloEngine::resume(CommunicationMonteCarloProgress& progress, uint64_t maxTrials) const {
+    const CommunicationMonteCarloConfig& config = progress.config;
+    const uint64_t blockSize = static_cast<uint64_t>(MathConstants::MONTE_CARLO_BLOCK_SIZE);
+    if (!isConfigValid(config) || maxTrials == 0 || progress.completedTrials % blockSize != 0 ||
+        progress.completedTrials > config.trialCount) {
+        return false;
+    }
+
+    CommunicationMonteCarloResult& result = progress.result;
+    if (progress.completedTrials == 0) {
+        result.snr.reset();
+        result.availability.reset();
+        result.throughput.reset();
+        result.outage.reset();
+        result.snrDistribution.reset();
+        result.throughputDistribution.reset();
+    }
+
+    // 向上取整写为 商 + (余数非0)，maxTrials取UINT64_MAX（运行到结束）时不会溢出
+    const uint64_t blockCount = config.trialCount / blockSize + (config.trialCount % blockSize != 0);
+    const uint64_t firstBlock = progress.completedTrials / blockSize;
+    const uint64_t lastBlock = firstBlock + std::min(blockCount - firstBlock,
+                                                     maxTrials / blockSize + (maxTrials % blockSize != 0));
+    const int threads = CommunicationParallelExecutor::resolveThreadCount(threadCount_,
+                                                                          static_cast<size_t>(lastBlock - firstBlock));
+    const size_t batchSize = static_cast<size_t>(threads) * BLOCKS_PER_THREAD_PER_BATCH;
+
+    std::vector<BlockStatistics> batch(static_cast<size_t>(std::min<uint64_t>(lastBlock - firstBlock, batchSize)));
+
+    for (uint64_t batchStart = firstBlock; batchStart < lastBlock; batchStart += batchSize) {
+        const size_t batchBlocks = static_cast<size_t>(std::min<uint64_t>(batchSize, lastBlock - batchStart));
+        const int batchThreads = CommunicationParallelExecutor::resolveThreadCount(threads, batchBlocks);
+
+        CommunicationParallelExecutor::parallelFor(batchBlocks, batchThreads,
+            [&](size_t begin, size_t end, int) {
+                for (size_t b = begin; b < end; ++b) {
+                    uint64_t first = (batchStart + b) * blockSize;
+                    batch[b] = BlockStatistics();
+                    runBlock(config, first, std::min(blockSize, config.trialCount - first), batch[b]);
+                }
+            });
+
+        for (size_t b = 0; b < batchBlocks; ++b) {
+            result.snr.merge(batch[b].snr);
+            result.availability.merge(batch[b].availability);
+            result.throughput.merge(batch[b].throughput);
+            result.outage.merge(batch[b].outage);
+            result.snrDistribution.merge(batch[b].snrDistribution);
+            result.throughputDistribution.merge(batch[b].throughputDistribution);
+        }
+    }
+
+    progress.completedTrials = std::min(config.trialCount, lastBlock * blockSize);
+    result.trialCount = progress.completedTrials;
+    result.confidence = config.confidence;
+    return true;
+}
@@ -0,0 +1,345 @@
+#include "CommunicationNetworkAnalyzer.h"
+#include "CommunicationParallelExecutor.h"
+#include "CommunicationVectorMath.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+
+namespace {
+    /**
+     * @brief 并查集（按规模合并、路径减半）
+     */
+    class DisjointSet {
+    public:
+        explicit DisjointSet(size_t count) : parent_(count), size_(count, 1) {
+            std::iota(parent_.begin(), parent_.end(), size_t(0));
+        }
+
+        size_t find(size_t x) {
+            while (parent_[x] != x) {
+                parent_[x] = parent_[parent_[x]];
+                x = parent_[x];
+            }
+            return x;
+        }
+
+        bool unite(size_t a, size_t b) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (size_[a] < size_[b]) std::swap(a, b);
+            parent_[b] = a;
+            size_[a] += size_[b];
+            return true;
+        }
+
+    private:
+        std::vector<size_t> parent_;
+        std::vector<size_t> size_;
+    };
+
+    /**
+     * @brief 网格单元：按(cy, cx)排序后的节点区间[begin, end)
+     */
+    struct GridCell {
+        int64_t cx;
+        int64_t cy;
+        size_t begin;
+        size_t end;
+    };
+
+    bool cellKeyLess(const GridCell& cell, const std::pair<int64_t, int64_t>& key) {
+        return cell.cy < key.first || (cell.cy == key.first && cell.cx < key.second);
+    }
+
+    // 半模板：只向"后方"的相邻格查找，使每对格只检查一次。
+    // 格边长略小于R/√2，相隔3格及以上的两格最近距离超过R，只需查找5×5邻域的一半
+    const int HALF_STENCIL[][2] = {
+        {1, 0}, {2, 0},
+        {-2, 1}, {-1, 1}, {0, 1}, {1, 1}, {2, 1},
+        {-2, 2}, {-1, 2}, {0, 2}, {1, 2}, {2, 2}
+    };
+}
+
+// 构造函数
+CommunicationNetworkAnalyzer::CommunicationNetworkAnalyzer(const CommunicationLinkEvaluator& evaluator, int threadCount)
+    : coefficients_(evaluator.calculateLinkBudgetCoefficients(evaluator.getEnvironment()))
+    , coincidentSnr_(0.0)
+    , linkRange_(0.0)
+    , threadCount_(threadCount) {
+
+    // 与CommunicationLinkEvaluator一致：距离为0时路径损耗按0计
+    const CommunicationEnvironment& env = evaluator.getEnvironment();
+    coincidentSnr_ = coefficients_.snrAtUnitDistance + (env.transmitPower - coefficients_.signalAtUnitDistance);
+
+    // 信噪比随距离单调下降，连接条件等价于信噪比不低于门限，由此反解单跳最大连接距离
+    double minimumSnr = calculateMinimumConnectedSnr(env.bandwidth);
+    double margin = coefficients_.snrAtUnitDistance - minimumSnr;
+    if (coefficients_.distanceSlope > 0.0) {
+        linkRange_ = std::pow(MathConstants::LINEAR_TO_DB_MULTIPLIER, margin / coefficients_.distanceSlope);
+    } else {
+        linkRange_ = margin >= 0.0 ? std::numeric_limits<double>::infinity() : 0.0;
+    }
+}
+
+/// @brief 计算满足连接条件的最小信噪比
+/// @details 误码率与丢包率只取决于信噪比且随信噪比单调下降，因此连接条件对信噪比单调，
+///          在搜索区间内二分查找其门限
+/// @param bandwidth 系统带宽 (MHz)
+/// @return 最小连接信噪比 (dB)，搜索区间内均不满足时返回正无穷
+double CommunicationNetworkAnalyzer::calculateMinimumConnectedSnr(double bandwidth) {
+    double low = MathConstants::LOW_SNR_THRESHOLD;
+    double high = MathConstants::LOW_SNR_THRESHOLD + MathConstants::CONNECTION_SNR_SEARCH_SPAN;
+    if (!CommunicationLinkEvaluator::deriveLinkStatus(0.0, high, bandwidth, 0.0).isConnected) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    for (int i = 0; i < MathConstants::CONNECTION_SNR_SEARCH_ITERATIONS; ++i) {
+        double middle = 0.5 * (low + high);
+        if (CommunicationLinkEvaluator::deriveLinkStatus(0.0, middle, bandwidth, 0.0).isConnected) {
+            high = middle;
+        } else {
+            low = middle;
+        }
+    }
+    return high;
+}
+
+double CommunicationNetworkAnalyzer::calculateSnrAtDistance(double distance) const {
+    if (distance <= 0.0) {
+        return coincidentSnr_;
+    }
+    return coefficients_.snrAtUnitDistance - coefficients_.distanceSlope * std::log10(distance);
+}
+
+/// @brief 计算节点间链路信噪比矩阵
+/// @details 矩阵按LINK_MATRIX_BLOCK_SIZE划分为分块，只枚举上三角分块（含对角分块）。
+///          每个分块先计算距离平方，再整块调用向量化log10，
+///          snr = snrAtUnitDistance - slope/2 * log10(d²)，避免逐对开方。
+///          分块(ib, jb)只写入矩阵的(ib, jb)与(jb, ib)两个区域，工作线程之间无写冲突。
+void CommunicationNetworkAnalyzer::calculateLinkMatrix(const std::pair<double, double>* nodePositions, size_t count,
+                                                       float* output) const {
+    if (count == 0) return;
+
+    // 坐标转为列式存储
+    std::vector<double> xs(count);
+    std::vector<double> ys(count);
+    for (size_t i = 0; i < count; ++i) {
+        xs[i] = nodePositions[i].first;
+        ys[i] = nodePositions[i].second;
+    }
+
+    const size_t blockSize = static_cast<size_t>(MathConstants::LINK_MATRIX_BLOCK_SIZE);
+    const size_t blockCount = (count + blockSize - 1) / blockSize;
+
+    std::vector<std::pair<size_t, size_t>> tiles;
+    tiles.reserve(blockCount * (blockCount + 1) / 2);
+    for (size_t ib = 0; ib < blockCount; ++ib) {
+        for (size_t jb = ib; jb < blockCount; ++jb) {
+            tiles.emplace_back(ib, jb);
+        }
+    }
+
+    const double intercept = coefficients_.snrAtUnitDistance;
+    const double halfSlope = 0.5 * coefficients_.distanceSlope;
+    const double coincidentSnr = coincidentSnr_;
+    const double minSquaredDistance = std::numeric_limits<double>::min();
+
+    int threads = CommunicationParallelExecutor::resolveThreadCount(threadCount_, tiles.size());
+    CommunicationParallelExecutor::parallelFor(tiles.size(), threads,
+        [&](size_t begin, size_t end, int) {
+            // 线程私有的分块缓冲区
+            std::vector<double> buffer(blockSize * blockSize);
+            std::vector<unsigned char> coincident(blockSize * blockSize);
+
+            for (size_t t = begin; t < end; ++t) {
+                size_t rowBegin = tiles[t].first * blockSize;
+                size_t colBegin = tiles[t].second * blockSize;
+                size_t rows = std::min(blockSize, count - rowBegin);
+                size_t cols = std::min(blockSize, count - colBegin);
+
+                // 距离平方，重合节点以1代入log10并单独标记
+                for (size_t r = 0; r < rows; ++r) {
+                    double xi = xs[rowBegin + r];
+                    double yi = ys[rowBegin + r];
+                    double* row = &buffer[r * cols];
+                    unsigned char* flags = &coincident[r * cols];
+                    for (size_t c = 0; c < cols; ++c) {
+                        double dx = xs[colBegin + c] - xi;
+                        double dy = ys[colBegin + c] - yi;
+                        double squared = dx * dx + dy * dy;
+                        bool isCoincident = squared < minSquaredDistance;
+                        flags[c] = isCoincident ? 1 : 0;
+                        row[c] = isCoincident ? 1.0 : squared;
+                    }
+                }
+
+                size_t cells = rows * cols;
+                CommunicationVectorMath::log10Batch(buffer.data(), buffer.data(), cells);
+                for (size_t k = 0; k < cells; ++k) {
+                    buffer[k] = coincident[k] ? coincidentSnr : intercept - halfSlope * buffer[k];
+                }
+
+                // 写入上三角区域（行连续）
+                for (size_t r = 0; r < rows; ++r) {
+                    size_t i = rowBegin + r;
+                    float* target = output + i * count + colBegin;
+                    for (size_t c = 0; c < cols; ++c) {
+                        target[c] = static_cast<float>(buffer[r * cols + c]);
+                    }
+                }
+
+                // 镜像写入下三角区域（按目标行连续）
+                if (rowBegin != colBegin) {
+                    for (size_t c = 0; c < cols; ++c) {
+                        size_t j = colBegin + c;
+                        float* target = output + j * count + rowBegin;
+                        for (size_t r = 0; r < rows; ++r) {
+                            target[r] = static_cast<float>(buffer[r * cols + c]);
+                        }
+                    }
+                }
+            }
+        });
+
+    // 对角线不是链路
+    for (size_t i = 0; i < count; ++i) {
+        output[i * count + i] = 0.0f;
+    }
+}
+
+/// @brief 分析网络连通性
+/// @details 节点按网格单元排序后连续存放：同格节点直接合并；
+///          相邻格之间逐对检查距离，找到一条连接即可合并两格并停止检查。
+///          节点重合或网格退化时仍保持正确性，总体复杂度接近O(N log N)
+void CommunicationNetworkAnalyzer::analyzeConnectivity(const std::pair<double, double>* nodePositions, size_t count,
+                                                       CommunicationNetworkConnectivity& result) const {
+    result.nodeCount = count;
+    result.linkRange = linkRange_;
+    result.componentCount = 0;
+    result.largestComponentSize = 0;
+    result.connectivity = 0.0;
+    result.componentLabels.assign(count, 0);
+    if (count == 0) return;
+
+    double minX = nodePositions[0].first;
+    double maxX = minX;
+    double minY = nodePositions[0].second;
+    double maxY = minY;
+    for (size_t i = 1; i < count; ++i) {
+        minX = std::min(minX, nodePositions[i].first);
+        maxX = std::max(maxX, nodePositions[i].first);
+        minY = std::min(minY, nodePositions[i].second);
+        maxY = std::max(maxY, nodePositions[i].second);
+    }
+
+    // 按排序后的位置合并，order[k]为第k个位置对应的原始节点编号
+    DisjointSet sets(count);
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), size_t(0));
+
+    const double range = linkRange_;
+    const double rangeSquared = range * range;
+    const double diagonal = std::hypot(maxX - minX, maxY - minY);
+
+    if (range > 0.0 && diagonal <= range) {
+        // 任意两节点间距都不超过R，全部相连
+        for (size_t k = 1; k < count; ++k) {
+            sets.unite(0, k);
+        }
+    } else if (range > 0.0) {
+        const double cellSize = range / MathConstants::SQRT_2 * MathConstants::CONNECTIVITY_GRID_SAFETY_FACTOR;
+        // 防止极小R导致网格坐标溢出
+        const double maxCellIndex = static_cast<double>(std::numeric_limits<int64_t>::max() / 4);
+
+        std::vector<std::pair<int64_t, int64_t>> keys(count);
+        for (size_t i = 0; i < count; ++i) {
+            double cx = std::min(std::floor((nodePositions[i].first - minX) / cellSize), maxCellIndex);
+            double cy = std::min(std::floor((nodePositions[i].second - minY) / cellSize), maxCellIndex);
+            keys[i] = std::make_pair(static_cast<int64_t>(cy), static_cast<int64_t>(cx));
+        }
+        std::sort(order.begin(), order.end(), [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+        std::vector<double> xs(count);
+        std::vector<double> ys(count);
+        std::vector<GridCell> cells;
+        for (size_t k = 0; k < count; ++k) {
+            xs[k] = nodePositions[order[k]].first;
+            ys[k] = nodePositions[order[k]].second;
+            const auto& key = keys[order[k]];
+            if (cells.empty() || cells.back().cy != key.first || cells.back().cx != key.second) {
+                cells.push_back(GridCell{key.second, key.first, k, k + 1});
+            } else {
+                cells.back().end = k + 1;
+                // 同格节点间距小于R，直接合并
+                sets.unite(cells.back().begin, k);
+            }
+        }
+
+        for (const GridCell& cell : cells) {
+            for (const auto& offset : HALF_STENCIL) {
+                std::pair<int64_t, int64_t> neighborKey(cell.cy + offset[1], cell.cx + offset[0]);
+                auto neighbor = std::lower_bound(cells.begin(), cells.end(), neighborKey, cellKeyLess);
+                if (neighbor == cells.end() || neighbor->cy != neighborKey.first || neighbor->cx != neighborKey.second) {
+                    continue;
+                }
+                if (sets.find(cell.begin) == sets.find(neighbor->begin)) {
+                    continue;
+                }
+
+                bool linked = false;
+                for (size_t a = cell.begin; a < cell.end && !linked; ++a) {
+                    for (size_t b = neighbor->begin; b < neighbor->end; ++b) {
+                        double dx = xs[a] - xs[b];
+                        double dy = ys[a] - ys[b];
+                        if (dx * dx + dy * dy <= rangeSquared) {
+                            sets.unite(a, b);
+                            linked = true;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // 按原始节点顺序为连通分量编号并统计规模
+    std::vector<int> rootLabels(count, -1);
+    std::vector<size_t> componentSizes;
+    for (size_t k = 0; k < count; ++k) {
+        size_t root = sets.find(k);
+        if (rootLabels[root] < 0) {
+            rootLabels[root] = static_cast<int>(componentSizes.size());
+            componentSizes.push_back(0);
+        }
+        result.componentLabels[order[k]] = rootLabels[root];
+        ++componentSizes[rootLabels[root]];
+    }
+
+    // 编号按原始节点顺序重新映射，使编号与排序方式无关
+    std::vector<int> remap(componentSizes.size(), -1);
+    std::vector<size_t> orderedSizes;
+    for (size_t i = 0; i < count; ++i) {
+        int& label = result.componentLabels[i];
+        if (remap[label] < 0) {
+            remap[label] = static_cast<int>(orderedSizes.size());
+            orderedSizes.push_back(componentSizes[label]);
+        }
+        label = remap[label];
+    }
+
+    double reachablePairs = 0.0;
+    for (size_t size : orderedSizes) {
+        reachablePairs += static_cast<double>(size) * static_cast<double>(size - 1);
+        result.largestComponentSize = std::max(result.largestComponentSize, size);
+    }
+    result.componentCount = orderedSizes.size();
+
+    // 单个节点视为完全连通
+    double totalPairs = static_cast<double>(count) * static_cast<double>(count - 1);
+    result.connectivity = count > 1 ? reachablePairs / totalPairs : 1.0;
+}
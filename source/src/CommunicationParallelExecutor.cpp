@@ -0,0 +1,89 @@
+#include "CommunicationParallelExecutor.h"
+#include <thread>
+#include <vector>
+#include <exception>
+#include <mutex>
+#include <algorithm>
+#include <system_error>
+
+int CommunicationParallelExecutor::getHardwareThreadCount() {
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 0 ? static_cast<int>(hardwareThreads) : 1;
+}
+
+int CommunicationParallelExecutor::resolveThreadCount(int requestedThreads, size_t workItems, size_t minItemsPerThread) {
+    if (workItems == 0) return 1;
+
+    size_t threads = requestedThreads > 0 ? static_cast<size_t>(requestedThreads)
+                                          : static_cast<size_t>(getHardwareThreadCount());
+
+    // 任务过少时减少线程数，避免线程创建开销超过计算量
+    size_t perThread = std::max<size_t>(1, minItemsPerThread);
+    size_t maxUsefulThreads = std::max<size_t>(1, (workItems + perThread - 1) / perThread);
+    threads = std::min(threads, maxUsefulThreads);
+
+    return static_cast<int>(std::max<size_t>(1, threads));
+}
+
+void CommunicationParallelExecutor::parallelFor(size_t count, int threadCount, const RangeTask& task) {
+    if (count == 0) return;
+
+    size_t threads = static_cast<size_t>(std::max(1, threadCount));
+    threads = std::min(threads, count);
+
+    if (threads == 1) {
+        task(0, count, 0);
+        return;
+    }
+
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    // 连续分块：前remainder个线程各多分配一个任务
+    size_t chunk = count / threads;
+    size_t remainder = count % threads;
+
+    auto runChunk = [&](size_t begin, size_t end, int threadIndex) {
+        try {
+            task(begin, end, threadIndex);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError) {
+                firstError = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    size_t begin = 0;
+    size_t callerBegin = 0;
+    size_t callerEnd = 0;
+    for (size_t t = 0; t < threads; ++t) {
+        size_t end = begin + chunk + (t < remainder ? 1 : 0);
+        if (t == 0) {
+            // 第一个分块由调用线程执行
+            callerBegin = begin;
+            callerEnd = end;
+        } else {
+            try {
+                workers.emplace_back(runChunk, begin, end, static_cast<int>(t));
+            } catch (const std::system_error&) {
+                // 无法创建线程时退化为在调用线程内执行
+                runChunk(begin, end, static_cast<int>(t));
+            }
+        }
+        begin = end;
+    }
+
+    runChunk(callerBegin, callerEnd, 0);
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
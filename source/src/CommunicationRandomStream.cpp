@@ -0,0 +1,51 @@
+#include "CommunicationRandomStream.h"
+#include "MathConstants.h"
+#include <cmath>
+
+namespace {
+    // SplitMix64常数
+    constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+    constexpr uint64_t MIX_MULTIPLIER_1 = 0xBF58476D1CE4E5B9ULL;
+    constexpr uint64_t MIX_MULTIPLIER_2 = 0x94D049BB133111EBULL;
+
+    // 派生子流时与密钥异或的常数，使子流密钥与同一种子下各编号子流的密钥不重合
+    constexpr uint64_t SUBSTREAM_SALT = 0xD1B54A32D192ED03ULL;
+
+    // 53位尾数对应的单位 2^-53
+    constexpr double UNIFORM_UNIT = 1.0 / 9007199254740992.0;
+}
+
+/// @brief 构造随机数流
+/// @details 密钥由种子与子流编号两次混合得到，相邻种子或相邻编号的子流互不相关
+CommunicationRandomStream::CommunicationRandomStream(uint64_t seed, RandomStreamId streamId)
+    : key_(mix64(mix64(seed) + static_cast<uint64_t>(streamId) * GOLDEN_GAMMA)) {}
+
+uint64_t CommunicationRandomStream::mix64(uint64_t value) {
+    value = (value ^ (value >> 30)) * MIX_MULTIPLIER_1;
+    value = (value ^ (value >> 27)) * MIX_MULTIPLIER_2;
+    return value ^ (value >> 31);
+}
+
+uint64_t CommunicationRandomStream::bits(uint64_t counter) const {
+    return mix64(key_ + (counter + 1) * GOLDEN_GAMMA);
+}
+
+double CommunicationRandomStream::uniform(uint64_t counter) const {
+    return (static_cast<double>(bits(counter) >> 11) + 0.5) * UNIFORM_UNIT;
+}
+
+double CommunicationRandomStream::normal(uint64_t index) const {
+    double radius = std::sqrt(-2.0 * std::log(uniform(2 * index)));
+    return radius * std::cos(2.0 * MathConstants::PI * uniform(2 * index + 1));
+}
+
+CommunicationRandomStream CommunicationRandomStream::substream(uint64_t index) const {
+    return CommunicationRandomStream(mix64(mix64(key_ ^ SUBSTREAM_SALT) + (index + 1) * GOLDEN_GAMMA), KeyTag());
+}
+
+/// @brief 读取下一个标准正态分布随机数
+/// @details 按Box-Muller变换使用相邻两个位置，位置为偶数时与流的normal(位置 / 2)相同
+double CommunicationRandomSequence::normal() {
+    double radius = std::sqrt(-2.0 * std::log(uniform()));
+    return radius * std::cos(2.0 * MathConstants::PI * uniform());
+}
@@ -0,0 +1,209 @@
+#include "CommunicationRasterEngine.h"
+#include "CommunicationParallelExecutor.h"
+#include "CommunicationVectorMath.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr uint32_t RASTER_FILE_VERSION = 1;
+    const char RASTER_FILE_MAGIC[4] = {'C', 'M', 'R', 'S'};
+
+    static_assert(sizeof(CommunicationRasterFileHeader) == 64, "栅格文件头必须为64字节");
+
+    /**
+     * @brief 以读写方式映射的输出文件
+     *
+     * 构造时按指定大小创建（截断）文件并整体映射，析构时解除映射并关闭文件。
+     */
+    class MappedOutputFile {
+    public:
+        MappedOutputFile(const std::string& filename, size_t size) : data_(nullptr), size_(size) {
+#ifdef _WIN32
+            file_ = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                                CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE) return;
+            ULARGE_INTEGER fileSize;
+            fileSize.QuadPart = size;
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, fileSize.HighPart, fileSize.LowPart, nullptr);
+            if (!mapping_) return;
+            data_ = static_cast<unsigned char*>(MapViewOfFile(mapping_, FILE_MAP_WRITE, 0, 0, size));
+#else
+            descriptor_ = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (descriptor_ < 0) return;
+            if (ftruncate(descriptor_, static_cast<off_t>(size)) != 0) return;
+            void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor_, 0);
+            if (address != MAP_FAILED) {
+                data_ = static_cast<unsigned char*>(address);
+            }
+#endif
+        }
+
+        ~MappedOutputFile() {
+#ifdef _WIN32
+            if (data_) {
+                FlushViewOfFile(data_, 0);
+                UnmapViewOfFile(data_);
+            }
+            if (mapping_) CloseHandle(mapping_);
+            if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+            if (data_) munmap(data_, size_);
+            if (descriptor_ >= 0) close(descriptor_);
+#endif
+        }
+
+        MappedOutputFile(const MappedOutputFile&) = delete;
+        MappedOutputFile& operator=(const MappedOutputFile&) = delete;
+
+        unsigned char* data() const { return data_; }
+
+    private:
+        unsigned char* data_;
+        size_t size_;
+#ifdef _WIN32
+        HANDLE file_ = INVALID_HANDLE_VALUE;
+        HANDLE mapping_ = nullptr;
+#else
+        int descriptor_ = -1;
+#endif
+    };
+}
+
+// 构造函数
+CommunicationRasterEngine::CommunicationRasterEngine(const CommunicationLinkEvaluator& evaluator,
+                                                     double jammerX, double jammerY, int threadCount)
+    : coefficients_(evaluator.calculateLinkBudgetCoefficients(evaluator.getEnvironment()))
+    , unitJammerToSignalRatio_(evaluator.calculateUnitDistanceJammerToSignalRatio(evaluator.getEnvironment().frequency))
+    , jammerX_(jammerX)
+    , jammerY_(jammerY)
+    , threadCount_(threadCount) {
+}
+
+bool CommunicationRasterEngine::isSpecValid(const CommunicationRasterSpec& spec) {
+    return spec.xMax > spec.xMin && spec.yMax > spec.yMin &&
+           std::isfinite(spec.xMax - spec.xMin) && std::isfinite(spec.yMax - spec.yMin) &&
+           spec.width > 0 && spec.width <= MathConstants::MAX_RASTER_DIMENSION &&
+           spec.height > 0 && spec.height <= MathConstants::MAX_RASTER_DIMENSION;
+}
+
+/// @brief 分块计算栅格
+/// @details 栅格按RASTER_TILE_SIZE划分为分块，工作线程处理连续的分块区间，分块之间写入区域互不重叠。
+///          距离小于MIN_DISTANCE_LIMIT时按MIN_DISTANCE_LIMIT计算：
+///          信号强度 = signalAtUnitDistance - slope/2 * log10(ds²)
+///          干信比 = unitJ/S + FSPL系数/2 * (log10(ds²) - log10(dj²))
+void CommunicationRasterEngine::renderTiles(RasterQuantity quantity, const CommunicationRasterSpec& spec,
+                                            float* output) const {
+    const size_t width = static_cast<size_t>(spec.width);
+    const size_t height = static_cast<size_t>(spec.height);
+    const size_t tileSize = static_cast<size_t>(MathConstants::RASTER_TILE_SIZE);
+    const size_t tileColumns = (width + tileSize - 1) / tileSize;
+    const size_t tileRows = (height + tileSize - 1) / tileSize;
+    const size_t tileCount = tileColumns * tileRows;
+
+    const double cellWidth = (spec.xMax - spec.xMin) / static_cast<double>(spec.width);
+    const double cellHeight = (spec.yMax - spec.yMin) / static_cast<double>(spec.height);
+    const double minSquaredDistance = MathConstants::MIN_DISTANCE_LIMIT * MathConstants::MIN_DISTANCE_LIMIT;
+    const double halfSlope = 0.5 * coefficients_.distanceSlope;
+    const double halfFsplCoefficient = 0.5 * MathConstants::FSPL_DISTANCE_COEFFICIENT;
+    const bool jammerRatio = quantity == RasterQuantity::JAMMER_TO_SIGNAL_RATIO;
+
+    int threads = CommunicationParallelExecutor::resolveThreadCount(threadCount_, tileCount);
+    CommunicationParallelExecutor::parallelFor(tileCount, threads,
+        [&](size_t begin, size_t end, int) {
+            // 线程私有的行缓冲区
+            std::vector<double> signalLog(tileSize);
+            std::vector<double> jammerLog(tileSize);
+            std::vector<double> xs(tileSize);
+
+            for (size_t t = begin; t < end; ++t) {
+                size_t rowBegin = (t / tileColumns) * tileSize;
+                size_t colBegin = (t % tileColumns) * tileSize;
+                size_t rows = std::min(tileSize, height - rowBegin);
+                size_t cols = std::min(tileSize, width - colBegin);
+
+                for (size_t c = 0; c < cols; ++c) {
+                    xs[c] = spec.xMin + (static_cast<double>(colBegin + c) + 0.5) * cellWidth;
+                }
+
+                for (size_t r = 0; r < rows; ++r) {
+                    size_t row = rowBegin + r;
+                    double y = spec.yMin + (static_cast<double>(row) + 0.5) * cellHeight;
+                    float* target = output + row * width + colBegin;
+
+                    for (size_t c = 0; c < cols; ++c) {
+                        signalLog[c] = std::max(xs[c] * xs[c] + y * y, minSquaredDistance);
+                    }
+                    CommunicationVectorMath::log10Batch(signalLog.data(), signalLog.data(), cols);
+
+                    if (!jammerRatio) {
+                        for (size_t c = 0; c < cols; ++c) {
+                            target[c] = static_cast<float>(coefficients_.signalAtUnitDistance - halfSlope * signalLog[c]);
+                        }
+                        continue;
+                    }
+
+                    double dy = y - jammerY_;
+                    for (size_t c = 0; c < cols; ++c) {
+                        double dx = xs[c] - jammerX_;
+                        jammerLog[c] = std::max(dx * dx + dy * dy, minSquaredDistance);
+                    }
+                    CommunicationVectorMath::log10Batch(jammerLog.data(), jammerLog.data(), cols);
+                    for (size_t c = 0; c < cols; ++c) {
+                        target[c] = static_cast<float>(unitJammerToSignalRatio_ +
+                                                       halfFsplCoefficient * (signalLog[c] - jammerLog[c]));
+                    }
+                }
+            }
+        });
+}
+
+bool CommunicationRasterEngine::render(RasterQuantity quantity, const CommunicationRasterSpec& spec, float* output) const {
+    if (!output || !isSpecValid(spec)) return false;
+    renderTiles(quantity, spec, output);
+    return true;
+}
+
+/// @brief 计算栅格并经内存映射写入文件
+/// @details 先写文件头，再将映射区域中文件头之后的部分作为输出缓冲区交给分块计算
+bool CommunicationRasterEngine::renderToFile(RasterQuantity quantity, const CommunicationRasterSpec& spec,
+                                             const std::string& filename) const {
+    if (filename.empty() || !isSpecValid(spec)) return false;
+
+    size_t pixelCount = static_cast<size_t>(spec.width) * static_cast<size_t>(spec.height);
+    size_t fileSize = sizeof(CommunicationRasterFileHeader) + pixelCount * sizeof(float);
+
+    MappedOutputFile file(filename, fileSize);
+    if (!file.data()) return false;
+
+    CommunicationRasterFileHeader header = {};
+    std::memcpy(header.magic, RASTER_FILE_MAGIC, sizeof(header.magic));
+    header.version = RASTER_FILE_VERSION;
+    header.quantity = static_cast<uint32_t>(quantity);
+    header.width = static_cast<uint32_t>(spec.width);
+    header.height = static_cast<uint32_t>(spec.height);
+    header.xMin = spec.xMin;
+    header.xMax = spec.xMax;
+    header.yMin = spec.yMin;
+    header.yMax = spec.yMax;
+    std::memcpy(file.data(), &header, sizeof(header));
+
+    // 文件头为64字节，像元数据起始地址满足float对齐
+    float* pixels = reinterpret_cast<float*>(file.data() + sizeof(header));
+    renderTiles(quantity, spec, pixels);
+    return true;
+}
@@ -0,0 +1,274 @@
+#include "CommunicationRelayPlanner.h"
+#include "CommunicationNetworkAnalyzer.h"
+#include "CommunicationParallelExecutor.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace {
+    /**
+     * @brief 候选节点集合
+     *
+     * 前latticeCount个为网格格点，随后依次为源节点与目的节点。
+     */
+    struct RelayCandidates {
+        double originX;
+        double originY;
+        double spacing;
+        int columns;
+        int rows;
+        size_t latticeCount;
+        std::vector<double> xs;
+        std::vector<double> ys;
+        std::vector<double> receiverTerms;   // 作为接收端时的常量项 (dB)
+
+        size_t sourceIndex() const { return latticeCount; }
+        size_t destinationIndex() const { return latticeCount + 1; }
+    };
+
+    /**
+     * @brief 反向BFS中发现的候选边（格点 -> 下一跳）
+     */
+    struct DiscoveredEdge {
+        int node;
+        int next;
+    };
+}
+
+// 构造函数
+CommunicationRelayPlanner::CommunicationRelayPlanner(const CommunicationLinkEvaluator& evaluator,
+                                                     double jammerX, double jammerY, int threadCount)
+    : coefficients_(evaluator.calculatePositionalLinkCoefficients(evaluator.getEnvironment()))
+    , minimumSnr_(CommunicationNetworkAnalyzer::calculateMinimumConnectedSnr(evaluator.getEnvironment().bandwidth))
+    , jammerX_(jammerX)
+    , jammerY_(jammerY)
+    , threadCount_(threadCount) {
+}
+
+double CommunicationRelayPlanner::calculateLinkSnr(const std::pair<double, double>& transmitter,
+                                                   const std::pair<double, double>& receiver) const {
+    double distance = std::max(std::hypot(receiver.first - transmitter.first, receiver.second - transmitter.second),
+                               MathConstants::MIN_DISTANCE_LIMIT);
+    double snr = coefficients_.jammerFreeSnrAtUnitDistance - coefficients_.distanceSlope * std::log10(distance);
+    if (coefficients_.jammed) {
+        double jammerDistance = std::max(std::hypot(receiver.first - jammerX_, receiver.second - jammerY_),
+                                         MathConstants::MIN_DISTANCE_LIMIT);
+        snr -= coefficients_.unitJammerToSignalRatio +
+               MathConstants::FSPL_DISTANCE_COEFFICIENT * (std::log10(distance) - std::log10(jammerDistance));
+    }
+    return snr;
+}
+
+/// @brief 规划中继路径
+/// @details 1. 建立候选网格并缓存每个节点作为接收端的常量项：
+///             snr(u→b) = receiverTerm(b) - totalSlope * log10(|u - b|)；
+///          2. 门限τ下接收端b的可达半径 r_b = 10^((receiverTerm(b) - τ) / totalSlope)，
+///             从目的节点反向BFS，第h层前沿节点逐行扫描其可达圆内的格点，源节点落入任一前沿节点的
+///             可达圆即得到h跳路径；
+///          3. 以最小连接信噪比为门限搜索，不可达则无可行路径，否则得到满足连接条件的最少跳数H；
+///          4. 跳数上限收紧为H，在[最小连接信噪比, 瓶颈上界]内二分τ，最后以找到的τ重新搜索并记录下一跳，
+///             得到H跳路径中瓶颈信噪比最大者
+bool CommunicationRelayPlanner::plan(const std::pair<double, double>& source,
+                                     const std::pair<double, double>& destination,
+                                     int maxRelays, CommunicationRelayPlan& plan) const {
+    if (maxRelays < 0 || !std::isfinite(source.first) || !std::isfinite(source.second) ||
+        !std::isfinite(destination.first) || !std::isfinite(destination.second)) {
+        return false;
+    }
+
+    plan.feasible = false;
+    plan.relayIndices.clear();
+    plan.relayPositions.clear();
+    plan.bottleneckSnr = -std::numeric_limits<double>::infinity();
+    plan.totalDistance = 0.0;
+
+    // 候选网格
+    const double separation = std::hypot(destination.first - source.first, destination.second - source.second);
+    const double margin = std::max(separation * MathConstants::RELAY_LATTICE_MARGIN_RATIO, MathConstants::MIN_DISTANCE_LIMIT);
+    const double xMin = std::min(source.first, destination.first) - margin;
+    const double yMin = std::min(source.second, destination.second) - margin;
+    const double width = std::fabs(destination.first - source.first) + 2.0 * margin;
+    const double height = std::fabs(destination.second - source.second) + 2.0 * margin;
+    const double spacing = std::max(width, height) / (MathConstants::RELAY_LATTICE_RESOLUTION - 1);
+
+    RelayCandidates candidates;
+    candidates.originX = xMin;
+    candidates.originY = yMin;
+    candidates.spacing = spacing;
+    candidates.columns = std::min(static_cast<int>(std::ceil(width / spacing - 1e-9)) + 1,
+                                  MathConstants::RELAY_LATTICE_RESOLUTION);
+    candidates.rows = std::min(static_cast<int>(std::ceil(height / spacing - 1e-9)) + 1,
+                               MathConstants::RELAY_LATTICE_RESOLUTION);
+    candidates.latticeCount = static_cast<size_t>(candidates.columns) * candidates.rows;
+
+    size_t nodeCount = candidates.latticeCount + 2;
+    candidates.xs.resize(nodeCount);
+    candidates.ys.resize(nodeCount);
+    candidates.receiverTerms.resize(nodeCount);
+    for (int row = 0; row < candidates.rows; ++row) {
+        for (int col = 0; col < candidates.columns; ++col) {
+            size_t index = static_cast<size_t>(row) * candidates.columns + col;
+            candidates.xs[index] = xMin + col * spacing;
+            candidates.ys[index] = yMin + row * spacing;
+        }
+    }
+    candidates.xs[candidates.sourceIndex()] = source.first;
+    candidates.ys[candidates.sourceIndex()] = source.second;
+    candidates.xs[candidates.destinationIndex()] = destination.first;
+    candidates.ys[candidates.destinationIndex()] = destination.second;
+
+    plan.latticeOriginX = candidates.originX;
+    plan.latticeOriginY = candidates.originY;
+    plan.latticeSpacing = candidates.spacing;
+    plan.latticeColumns = candidates.columns;
+    plan.latticeRows = candidates.rows;
+
+    // 接收端常量项
+    const double totalSlope = coefficients_.distanceSlope +
+                              (coefficients_.jammed ? MathConstants::FSPL_DISTANCE_COEFFICIENT : 0.0);
+    int threads = CommunicationParallelExecutor::resolveThreadCount(
+        threadCount_, nodeCount, MathConstants::PARALLEL_MIN_ITEMS_PER_THREAD);
+    CommunicationParallelExecutor::parallelFor(nodeCount, threads, [&](size_t begin, size_t end, int) {
+        for (size_t i = begin; i < end; ++i) {
+            double term = coefficients_.jammerFreeSnrAtUnitDistance;
+            if (coefficients_.jammed) {
+                double jammerDistance = std::max(std::hypot(candidates.xs[i] - jammerX_, candidates.ys[i] - jammerY_),
+                                                 MathConstants::MIN_DISTANCE_LIMIT);
+                term += MathConstants::FSPL_DISTANCE_COEFFICIENT * std::log10(jammerDistance) -
+                        coefficients_.unitJammerToSignalRatio;
+            }
+            candidates.receiverTerms[i] = term;
+        }
+    });
+
+    int hopLimit = maxRelays + 1;
+    const double minSquaredDistance = MathConstants::MIN_DISTANCE_LIMIT * MathConstants::MIN_DISTANCE_LIMIT;
+
+    // 门限τ下的反向逐层BFS，返回源节点到目的节点的最少跳数，不可达返回-1
+    std::vector<uint8_t> visited(candidates.latticeCount);
+    std::vector<int> nextHop(nodeCount, -1);
+    std::vector<int> frontier;
+    std::vector<int> nextFrontier;
+    std::vector<std::vector<DiscoveredEdge>> discovered;
+
+    auto reachSquared = [&](size_t receiver, double threshold) {
+        return std::pow(MathConstants::LINEAR_TO_DB_MULTIPLIER,
+                        2.0 * (candidates.receiverTerms[receiver] - threshold) / totalSlope);
+    };
+    auto squaredDistance = [&](size_t a, size_t b) {
+        double dx = candidates.xs[a] - candidates.xs[b];
+        double dy = candidates.ys[a] - candidates.ys[b];
+        return std::max(dx * dx + dy * dy, minSquaredDistance);
+    };
+
+    auto search = [&](double threshold) {
+        std::fill(visited.begin(), visited.end(), 0);
+        frontier.assign(1, static_cast<int>(candidates.destinationIndex()));
+
+        for (int hops = 1; hops <= hopLimit; ++hops) {
+            // 提前终止：源节点可直达当前前沿
+            for (int receiver : frontier) {
+                if (squaredDistance(candidates.sourceIndex(), receiver) <= reachSquared(receiver, threshold)) {
+                    nextHop[candidates.sourceIndex()] = receiver;
+                    return hops;
+                }
+            }
+            if (hops == hopLimit || frontier.empty()) break;
+
+            // 并行扫描各前沿节点可达圆内尚未访问的格点
+            int scanThreads = CommunicationParallelExecutor::resolveThreadCount(threadCount_, frontier.size());
+            discovered.resize(static_cast<size_t>(scanThreads));
+            CommunicationParallelExecutor::parallelFor(frontier.size(), scanThreads,
+                [&](size_t begin, size_t end, int threadIndex) {
+                    std::vector<DiscoveredEdge>& found = discovered[threadIndex];
+                    found.clear();
+                    for (size_t f = begin; f < end; ++f) {
+                        size_t receiver = static_cast<size_t>(frontier[f]);
+                        double radiusSquared = reachSquared(receiver, threshold);
+                        if (radiusSquared < minSquaredDistance) continue;
+                        double radius = std::sqrt(radiusSquared);
+
+                        double bx = (candidates.xs[receiver] - candidates.originX) / spacing;
+                        double by = (candidates.ys[receiver] - candidates.originY) / spacing;
+                        double reach = radius / spacing;
+                        int rowBegin = std::max(0, static_cast<int>(std::ceil(by - reach)) - 1);
+                        int rowEnd = std::min(candidates.rows - 1, static_cast<int>(std::floor(by + reach)) + 1);
+                        for (int row = rowBegin; row <= rowEnd; ++row) {
+                            double dy = row - by;
+                            double chord = reach * reach - dy * dy;
+                            if (chord < 0.0) continue;
+                            double halfChord = std::sqrt(chord);
+                            int colBegin = std::max(0, static_cast<int>(std::ceil(bx - halfChord)) - 1);
+                            int colEnd = std::min(candidates.columns - 1, static_cast<int>(std::floor(bx + halfChord)) + 1);
+                            for (int col = colBegin; col <= colEnd; ++col) {
+                                size_t node = static_cast<size_t>(row) * candidates.columns + col;
+                                if (!visited[node] && squaredDistance(node, receiver) <= radiusSquared) {
+                                    found.push_back({static_cast<int>(node), static_cast<int>(receiver)});
+                                }
+                            }
+                        }
+                    }
+                });
+
+            // 按前沿顺序合并，保证结果与线程数无关
+            nextFrontier.clear();
+            for (int t = 0; t < scanThreads; ++t) {
+                for (const DiscoveredEdge& edge : discovered[t]) {
+                    if (visited[edge.node]) continue;
+                    visited[edge.node] = 1;
+                    nextHop[edge.node] = edge.next;
+                    nextFrontier.push_back(edge.node);
+                }
+            }
+            frontier.swap(nextFrontier);
+        }
+        return -1;
+    };
+
+    // 最少跳数优先：多用中继不会被更高的瓶颈信噪比换取，瓶颈信噪比只在同跳数的路径间比较
+    int minimumHops = std::isfinite(minimumSnr_) ? search(minimumSnr_) : -1;
+    if (minimumHops < 0) {
+        return true;
+    }
+    hopLimit = minimumHops;
+
+    // 二分瓶颈门限：任一可行路径至少有一跳不短于 源-目的距离 / 跳数
+    double low = minimumSnr_;
+    double high = *std::max_element(candidates.receiverTerms.begin(), candidates.receiverTerms.end()) -
+                  totalSlope * std::log10(std::max(separation / hopLimit, MathConstants::MIN_DISTANCE_LIMIT));
+    if (high > low) {
+        if (search(high) >= 0) {
+            low = high;
+        } else {
+            for (int iteration = 0; iteration < MathConstants::RELAY_SEARCH_ITERATIONS; ++iteration) {
+                double middle = 0.5 * (low + high);
+                if (search(middle) >= 0) {
+                    low = middle;
+                } else {
+                    high = middle;
+                }
+            }
+        }
+    }
+
+    search(low);
+    plan.feasible = true;
+    plan.bottleneckSnr = std::numeric_limits<double>::infinity();
+    size_t current = candidates.sourceIndex();
+    while (current != candidates.destinationIndex()) {
+        size_t next = static_cast<size_t>(nextHop[current]);
+        std::pair<double, double> from(candidates.xs[current], candidates.ys[current]);
+        std::pair<double, double> to(candidates.xs[next], candidates.ys[next]);
+        plan.bottleneckSnr = std::min(plan.bottleneckSnr, calculateLinkSnr(from, to));
+        plan.totalDistance += std::hypot(to.first - from.first, to.second - from.second);
+        if (next != candidates.destinationIndex()) {
+            plan.relayIndices.push_back(static_cast<int>(next));
+            plan.relayPositions.push_back(to);
+        }
+        current = next;
+    }
+    return true;
+}
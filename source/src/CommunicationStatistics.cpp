@@ -0,0 +1,288 @@
+#include "CommunicationStatistics.h"
+#include "CommunicationCheckpoint.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+CommunicationRunningStatistics::CommunicationRunningStatistics() {
+    reset();
+}
+
+void CommunicationRunningStatistics::reset() {
+    count_ = 0;
+    mean_ = 0.0;
+    m2_ = 0.0;
+    minimum_ = std::numeric_limits<double>::infinity();
+    maximum_ = -std::numeric_limits<double>::infinity();
+}
+
+void CommunicationRunningStatistics::add(double value) {
+    ++count_;
+    double delta = value - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (value - mean_);
+    minimum_ = std::min(minimum_, value);
+    maximum_ = std::max(maximum_, value);
+}
+
+/// @brief 合并另一个累加器
+/// @details mean = mean_a + delta * n_b / n，M2 = M2_a + M2_b + delta² * n_a * n_b / n
+void CommunicationRunningStatistics::merge(const CommunicationRunningStatistics& other) {
+    if (other.count_ == 0) return;
+    if (count_ == 0) {
+        *this = other;
+        return;
+    }
+
+    double countA = static_cast<double>(count_);
+    double countB = static_cast<double>(other.count_);
+    double total = countA + countB;
+    double delta = other.mean_ - mean_;
+
+    mean_ += delta * countB / total;
+    m2_ += other.m2_ + delta * delta * countA * countB / total;
+    count_ += other.count_;
+    minimum_ = std::min(minimum_, other.minimum_);
+    maximum_ = std::max(maximum_, other.maximum_);
+}
+
+double CommunicationRunningStatistics::getVariance() const {
+    if (count_ < 2) return 0.0;
+    return m2_ / static_cast<double>(count_ - 1);
+}
+
+double CommunicationRunningStatistics::getStandardDeviation() const {
+    return std::sqrt(getVariance());
+}
+
+std::pair<double, double> CommunicationRunningStatistics::getConfidenceInterval(double confidence) const {
+    if (count_ < 2) return {0.0, 0.0};
+    double margin = calculateCriticalValue(confidence) * getStandardDeviation() /
+                    std::sqrt(static_cast<double>(count_));
+    return {mean_ - margin, mean_ + margin};
+}
+
+bool CommunicationRunningStatistics::isValid() const {
+    if (count_ == 0) {
+        return mean_ == 0.0 && m2_ == 0.0 && minimum_ == std::numeric_limits<double>::infinity() &&
+               maximum_ == -std::numeric_limits<double>::infinity();
+    }
+    return std::isfinite(mean_) && std::isfinite(m2_) && std::isfinite(minimum_) && std::isfinite(maximum_) &&
+           m2_ >= 0.0 && minimum_ <= maximum_;
+}
+
+/// @brief 计算均值置信区间的临界值
+/// @details 档位含下边界，置信度恰为0.95时取1.96，与该置信度的名义含义一致
+double CommunicationRunningStatistics::calculateCriticalValue(double confidence) {
+    if (confidence >= 0.99) return MathConstants::CONFIDENCE_T_VALUE_99;
+    if (confidence >= 0.95) return MathConstants::CONFIDENCE_T_VALUE_95;
+    if (confidence >= 0.90) return MathConstants::CONFIDENCE_T_VALUE_90;
+    return MathConstants::CONFIDENCE_T_VALUE_80;
+}
+
+CommunicationQuantileSketch::CommunicationQuantileSketch(double compression)
+    : compression_(compression) {
+    if (!(compression > 0.0) || std::isinf(compression)) {
+        throw std::invalid_argument("分位数草图压缩参数必须为正数");
+    }
+    buffer_.reserve(static_cast<size_t>(std::ceil(compression_ * MathConstants::QUANTILE_SKETCH_BUFFER_FACTOR)));
+    reset();
+}
+
+void CommunicationQuantileSketch::reset() {
+    centroids_.clear();
+    buffer_.clear();
+    totalWeight_ = 0.0;
+    minimum_ = std::numeric_limits<double>::infinity();
+    maximum_ = -std::numeric_limits<double>::infinity();
+}
+
+void CommunicationQuantileSketch::add(double value) {
+    if (std::isnan(value)) return;
+    buffer_.push_back({value, 1.0});
+    totalWeight_ += 1.0;
+    minimum_ = std::min(minimum_, value);
+    maximum_ = std::max(maximum_, value);
+    if (static_cast<double>(buffer_.size()) >= compression_ * MathConstants::QUANTILE_SKETCH_BUFFER_FACTOR) {
+        compress();
+    }
+}
+
+void CommunicationQuantileSketch::merge(const CommunicationQuantileSketch& other) {
+    if (other.totalWeight_ <= 0.0) return;
+    buffer_.insert(buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+    buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+    totalWeight_ += other.totalWeight_;
+    minimum_ = std::min(minimum_, other.minimum_);
+    maximum_ = std::max(maximum_, other.maximum_);
+    compress();
+}
+
+void CommunicationQuantileSketch::compress() {
+    if (buffer_.empty()) return;
+    buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+    centroids_.swap(buffer_);
+    buffer_.clear();
+    compressCentroids(compression_, totalWeight_, centroids_);
+}
+
+/// @brief 排序并贪心合并质心
+/// @details 当前质心的左端累计比例为q0时，其右端累计比例不得超过k⁻¹(k(q0) + 1)，
+///          k(q) = δ/(2π)·asin(2q - 1)，k⁻¹(k) = (sin(2πk/δ) + 1) / 2；相同均值按权重排序保证结果确定
+void CommunicationQuantileSketch::compressCentroids(double compression, double totalWeight,
+                                                    std::vector<Centroid>& centroids) {
+    std::sort(centroids.begin(), centroids.end(), [](const Centroid& a, const Centroid& b) {
+        return a.mean < b.mean || (a.mean == b.mean && a.weight < b.weight);
+    });
+
+    const double scale = compression / (2.0 * MathConstants::PI);
+    auto weightLimit = [&](double weightSoFar) {
+        double k = scale * std::asin(std::min(1.0, 2.0 * weightSoFar / totalWeight - 1.0)) + 1.0;
+        if (k >= compression / 4.0) return totalWeight;
+        return totalWeight * (std::sin(k / scale) + 1.0) / 2.0;
+    };
+
+    size_t out = 0;
+    double weightSoFar = 0.0;
+    double limit = weightLimit(0.0);
+    for (size_t i = 1; i < centroids.size(); ++i) {
+        Centroid& current = centroids[out];
+        const Centroid& next = centroids[i];
+        if (weightSoFar + current.weight + next.weight <= limit) {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        } else {
+            weightSoFar += current.weight;
+            limit = weightLimit(weightSoFar);
+            centroids[++out] = next;
+        }
+    }
+    centroids.resize(centroids.empty() ? 0 : out + 1);
+}
+
+const std::vector<CommunicationQuantileSketch::Centroid>& CommunicationQuantileSketch::mergedCentroids(
+    std::vector<Centroid>& scratch) const {
+    if (buffer_.empty()) return centroids_;
+    scratch = centroids_;
+    scratch.insert(scratch.end(), buffer_.begin(), buffer_.end());
+    compressCentroids(compression_, totalWeight_, scratch);
+    return scratch;
+}
+
+double CommunicationQuantileSketch::getPercentile(double percentile) const {
+    double result = 0.0;
+    getPercentiles(&percentile, 1, &result);
+    return result;
+}
+
+/// @brief 一次遍历估计多个百分位数
+/// @details 质心视为位于其累计权重中点的样本，第p百分位对应累计权重 p/100 * (W - 1) + 0.5，
+///          在相邻质心中点之间线性插值，首末质心的外侧分别向最小值、最大值插值；
+///          全部质心权重为1时与CommunicationModelUtils::calculatePercentile一致
+void CommunicationQuantileSketch::getPercentiles(const double* percentiles, size_t count, double* results) const {
+    if (count == 0) return;
+    if (totalWeight_ <= 0.0) {
+        std::fill(results, results + count, 0.0);
+        return;
+    }
+
+    std::vector<Centroid> scratch;
+    const std::vector<Centroid>& centroids = mergedCentroids(scratch);
+
+    // NaN不满足严格弱序，不参与排序，其结果直接为NaN
+    std::vector<size_t> order;
+    order.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (std::isnan(percentiles[i])) {
+            results[i] = std::numeric_limits<double>::quiet_NaN();
+        } else {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return percentiles[a] < percentiles[b]; });
+
+    const Centroid& first = centroids.front();
+    const Centroid& last = centroids.back();
+    size_t cursor = 0;
+    double cursorCenter = first.weight / 2.0;   // 第cursor个质心中点处的累计权重
+
+    for (size_t k : order) {
+        double q = std::min(1.0, std::max(0.0, percentiles[k] / 100.0));
+        double index = q * (totalWeight_ - 1.0) + 0.5;
+
+        if (index <= first.weight / 2.0) {
+            double span = first.weight / 2.0 - 0.5;
+            results[k] = span > 0.0 ? minimum_ + (first.mean - minimum_) * (index - 0.5) / span : first.mean;
+            continue;
+        }
+        if (index >= totalWeight_ - last.weight / 2.0) {
+            double span = last.weight / 2.0 - 0.5;
+            results[k] = span > 0.0 ? maximum_ - (maximum_ - last.mean) * (totalWeight_ - 0.5 - index) / span
+                                    : last.mean;
+            continue;
+        }
+
+        while (cursor + 1 < centroids.size()) {
+            double step = (centroids[cursor].weight + centroids[cursor + 1].weight) / 2.0;
+            if (cursorCenter + step >= index) break;
+            cursorCenter += step;
+            ++cursor;
+        }
+        const Centroid& left = centroids[cursor];
+        const Centroid& right = centroids[std::min(cursor + 1, centroids.size() - 1)];
+        double step = (left.weight + right.weight) / 2.0;
+        double t = step > 0.0 ? (index - cursorCenter) / step : 0.0;
+        results[k] = left.mean + (right.mean - left.mean) * t;
+    }
+}
+
+void CommunicationQuantileSketch::saveState(CommunicationCheckpointWriter& writer) const {
+    writer.write(compression_);
+    writer.write(totalWeight_);
+    writer.write(minimum_);
+    writer.write(maximum_);
+    writer.writeArray(centroids_.data(), centroids_.size());
+    writer.writeArray(buffer_.data(), buffer_.size());
+}
+
+bool CommunicationQuantileSketch::loadState(CommunicationCheckpointReader& reader) {
+    double compression = 0.0;
+    double totalWeight = 0.0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    std::vector<Centroid> centroids;
+    std::vector<Centroid> buffer;
+    if (!reader.read(compression) || !reader.read(totalWeight) || !reader.read(minimum) || !reader.read(maximum) ||
+        !reader.readArray(centroids) || !reader.readArray(buffer)) {
+        return false;
+    }
+    if (!(compression > 0.0) || std::isinf(compression) || !(totalWeight >= 0.0) || std::isinf(totalWeight) ||
+        static_cast<double>(buffer.size()) >= compression * MathConstants::QUANTILE_SKETCH_BUFFER_FACTOR) {
+        return false;
+    }
+    if (totalWeight == 0.0) {
+        if (!centroids.empty() || !buffer.empty() || minimum != std::numeric_limits<double>::infinity() ||
+            maximum != -std::numeric_limits<double>::infinity()) {
+            return false;
+        }
+    } else if (!std::isfinite(minimum) || !std::isfinite(maximum) || minimum > maximum) {
+        return false;
+    }
+    auto centroidValid = [](const Centroid& centroid) {
+        return std::isfinite(centroid.mean) && centroid.weight > 0.0 && std::isfinite(centroid.weight);
+    };
+    if (!std::all_of(centroids.begin(), centroids.end(), centroidValid) ||
+        !std::all_of(buffer.begin(), buffer.end(), centroidValid)) {
+        return false;
+    }
+
+    compression_ = compression;
+    totalWeight_ = totalWeight;
+    minimum_ = minimum;
+    maximum_ = maximum;
+    centroids_ = std::move(centroids);
+    buffer_ = std::move(buffer);
+    buffer_.reserve(static_cast<size_t>(std::ceil(compression_ * MathConstants::QUANTILE_SKETCH_BUFFER_FACTOR)));
+    return true;
+}
@@ -0,0 +1,144 @@
+#include "CommunicationStatusMonitor.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+static_assert(sizeof(CommunicationStatusRecord) % sizeof(uint64_t) == 0,
+              "CommunicationStatusRecord必须由整数个64位字组成");
+static_assert(std::is_trivially_copyable<CommunicationStatusRecord>::value,
+              "CommunicationStatusRecord必须可按字节复制");
+
+CommunicationStatusMonitor::CommunicationStatusMonitor(size_t capacity)
+    : capacity_(1)
+    , claimed_(0)
+    , published_(0)
+    , epoch_(std::chrono::steady_clock::now())
+    , running_(false) {
+    if (capacity == 0) {
+        throw std::invalid_argument("监控历史容量必须大于0");
+    }
+    while (capacity_ < capacity) {
+        capacity_ <<= 1;
+    }
+    ring_.reset(new Slot[capacity_]);
+    for (size_t i = 0; i < capacity_; ++i) {
+        for (auto& word : ring_[i].words) {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+CommunicationStatusMonitor::~CommunicationStatusMonitor() {
+    stop();
+}
+
+void CommunicationStatusMonitor::publish(Sampler sampler) {
+    std::shared_ptr<const Sampler> source;
+    if (sampler) {
+        source = std::make_shared<const Sampler>(std::move(sampler));
+    }
+    std::atomic_store(&sampler_, std::move(source));
+}
+
+bool CommunicationStatusMonitor::start(int interval) {
+    if (interval <= 0 || running_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    running_.store(true, std::memory_order_release);
+    worker_ = std::thread(&CommunicationStatusMonitor::run, this, std::chrono::milliseconds(interval));
+    return true;
+}
+
+bool CommunicationStatusMonitor::stop() {
+    bool wasRunning;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wasRunning = running_.exchange(false, std::memory_order_acq_rel);
+    }
+    wakeCondition_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    return wasRunning;
+}
+
+/// @brief 后台采样循环
+/// @details 每个采样时刻调用当前采样函数重新求值链路指标；等待期间可被stop立即唤醒
+void CommunicationStatusMonitor::run(std::chrono::milliseconds interval) {
+    while (true) {
+        auto sampler = std::atomic_load(&sampler_);
+        if (sampler) {
+            CommunicationStatusRecord record;
+            record.timestamp = std::chrono::duration<double>(std::chrono::steady_clock::now() - epoch_).count();
+            record.metrics = (*sampler)();
+            append(record);
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        if (wakeCondition_.wait_for(lock, interval, [this]() { return !running_.load(std::memory_order_acquire); })) {
+            return;
+        }
+    }
+}
+
+/// @brief 写入一条记录
+/// @details 唯一写者：先公开正在写入的序号并发布release栅栏，再逐字写入槽位，最后发布写完的记录数
+void CommunicationStatusMonitor::append(const CommunicationStatusRecord& record) {
+    uint64_t words[RECORD_WORDS];
+    std::memcpy(words, &record, sizeof(record));
+
+    uint64_t sequence = published_.load(std::memory_order_relaxed);
+    claimed_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Slot& slot = ring_[sequence & (capacity_ - 1)];
+    for (size_t i = 0; i < RECORD_WORDS; ++i) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    published_.store(sequence + 1, std::memory_order_release);
+}
+
+void CommunicationStatusMonitor::readSlot(uint64_t sequence, CommunicationStatusRecord& record) const {
+    uint64_t words[RECORD_WORDS];
+    const Slot& slot = ring_[sequence & (capacity_ - 1)];
+    for (size_t i = 0; i < RECORD_WORDS; ++i) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::memcpy(&record, words, sizeof(record));
+}
+
+/// @brief 获取最近count条记录
+/// @details 复制完成后重新读取claimed_：序号为s的记录会被序号s + capacity的写入覆盖，
+///          因此序号小于claimed - capacity的记录可能已损坏，从结果中剔除
+size_t CommunicationStatusMonitor::getHistory(CommunicationStatusRecord* records, size_t count) const {
+    if (!records || count == 0) return 0;
+
+    uint64_t published = published_.load(std::memory_order_acquire);
+    uint64_t available = std::min<uint64_t>(published, capacity_);
+    size_t n = static_cast<size_t>(std::min<uint64_t>(count, available));
+    uint64_t first = published - n;
+    for (size_t k = 0; k < n; ++k) {
+        readSlot(first + k, records[k]);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t claimed = claimed_.load(std::memory_order_relaxed);
+    uint64_t validFirst = claimed > capacity_ ? claimed - capacity_ : 0;
+    if (first >= validFirst) {
+        return n;
+    }
+    uint64_t dropped = validFirst - first;
+    if (dropped >= n) {
+        return 0;
+    }
+    std::copy(records + dropped, records + n, records);
+    return n - static_cast<size_t>(dropped);
+}
+
+bool CommunicationStatusMonitor::getLatest(CommunicationStatusRecord& record) const {
+    return getHistory(&record, 1) == 1;
+}
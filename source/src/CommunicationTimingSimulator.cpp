@@ -0,0 +1,191 @@
+#include "CommunicationTimingSimulator.h"
+#include "CommunicationEventScheduler.h"
+#include "CommunicationJammerParameterConfig.h"
+#include "MathConstants.h"
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+namespace {
+    constexpr double MS_TO_SECONDS = 1e-3;
+
+    // 事件类型
+    constexpr uint32_t EVENT_ON = 0;
+    constexpr uint32_t EVENT_OFF = 1;
+
+    /**
+     * @brief 周期性事件源的运行状态
+     */
+    struct TimingSource {
+        CommunicationTimingSimulator::Window window;
+        uint64_t cycle;                  // 当前周期序号
+        bool packet;                     // 是否为数据包序列
+    };
+
+    bool isFiniteNonNegative(double value) {
+        return value >= 0.0 && std::isfinite(value);
+    }
+}
+
+CommunicationTimingSimulator::CommunicationTimingSimulator(double channelFrequency, double channelBandwidth)
+    : channelFrequency_(channelFrequency)
+    , channelBandwidth_(channelBandwidth) {
+}
+
+CommunicationTimingJammer CommunicationTimingSimulator::fromJammerModel(const CommunicationJammerModel& model,
+                                                                        double frequency, double bandwidth) {
+    CommunicationTimingJammer jammer;
+    jammer.type = model.getJammerType();
+    jammer.frequency = frequency;
+    jammer.bandwidth = bandwidth;
+    jammer.pulseWidth = model.getPulseWidth();
+    jammer.pulseRepetitionRate = model.getPulseRepetitionRate();
+    jammer.sweepRate = model.getSweepRate();
+    jammer.sweepRange = model.getSweepRange();
+    jammer.startOffset = 0.0;
+    return jammer;
+}
+
+bool CommunicationTimingSimulator::isJammerValid(const CommunicationTimingJammer& jammer) {
+    if (!std::isfinite(jammer.frequency) || !(jammer.bandwidth > 0.0) || !std::isfinite(jammer.bandwidth) ||
+        !isFiniteNonNegative(jammer.startOffset)) {
+        return false;
+    }
+    if (jammer.type == JammerType::PULSE) {
+        return CommunicationJammerParameterConfig::isPulseWidthValid(jammer.pulseWidth) &&
+               CommunicationJammerParameterConfig::isPulseRepetitionRateValid(jammer.pulseRepetitionRate);
+    }
+    if (jammer.type == JammerType::SWEEP_FREQUENCY) {
+        return CommunicationJammerParameterConfig::isSweepRateValid(jammer.sweepRate) &&
+               CommunicationJammerParameterConfig::isSweepRangeValid(jammer.sweepRange);
+    }
+    return true;
+}
+
+bool CommunicationTimingSimulator::isConfigValid(const CommunicationTimingConfig& config) {
+    if (!(config.duration > 0.0) || !std::isfinite(config.duration) ||
+        !(config.packetDuration > 0.0) || !std::isfinite(config.packetInterval) ||
+        !(config.packetInterval >= config.packetDuration) ||
+        !(config.corruptionThreshold >= 0.0 && config.corruptionThreshold < 1.0)) {
+        return false;
+    }
+    return std::all_of(config.jammers.begin(), config.jammers.end(), isJammerValid);
+}
+
+/// @brief 计算干扰源命中信道的周期性时间窗
+/// @details 瞬时干扰频带中心与信道中心相距小于(干扰带宽 + 信道带宽) / 2时两频带重叠。
+///          扫频干扰的瞬时中心为 f(t) = 扫频下限 + 扫频速率 * (t mod 周期)，周期 = 扫频范围 / 扫频速率，
+///          重叠条件对应f(t)落在一个频率区间内，换算为每个周期内的一段连续时间
+CommunicationTimingSimulator::Activity CommunicationTimingSimulator::calculateJammedWindow(
+    const CommunicationTimingJammer& jammer, Window& window) const {
+    const double halfSpan = (jammer.bandwidth + channelBandwidth_) / 2.0;
+    window.offset = jammer.startOffset * MS_TO_SECONDS;
+
+    if (jammer.type == JammerType::SWEEP_FREQUENCY) {
+        double lowest = jammer.frequency - jammer.sweepRange / 2.0;
+        double enter = std::max(lowest, channelFrequency_ - halfSpan);
+        double leave = std::min(lowest + jammer.sweepRange, channelFrequency_ + halfSpan);
+        if (!(leave > enter)) return Activity::NEVER;
+
+        window.period = jammer.sweepRange / jammer.sweepRate;
+        window.onTime = (enter - lowest) / jammer.sweepRate;
+        window.offTime = (leave - lowest) / jammer.sweepRate;
+        return (window.onTime <= 0.0 && window.offTime >= window.period) ? Activity::ALWAYS : Activity::PERIODIC;
+    }
+
+    if (!(std::abs(jammer.frequency - channelFrequency_) < halfSpan)) return Activity::NEVER;
+    if (jammer.type != JammerType::PULSE) return Activity::ALWAYS;
+
+    // 占空比由脉冲宽度与重复频率决定：dutyCycle = pulseWidth * pulseRepetitionRate
+    window.period = 1.0 / jammer.pulseRepetitionRate;
+    window.onTime = 0.0;
+    window.offTime = jammer.pulseWidth * MS_TO_SECONDS;
+    return window.offTime >= window.period ? Activity::ALWAYS : Activity::PERIODIC;
+}
+
+/// @brief 执行离散事件仿真
+/// @details 按时间顺序处理各事件源的开关事件：两个事件之间若有干扰源处于开启状态，
+///          则该时段计入受干扰时间；数据包开始时记下累计受干扰时间，结束时二者之差即包内受干扰时间。
+///          持续干扰的干扰源不产生事件，只计入初始开启数
+bool CommunicationTimingSimulator::run(const CommunicationTimingConfig& config,
+                                       CommunicationTimingResult& result) const {
+    if (!isConfigValid(config)) return false;
+
+    const double duration = config.duration;
+    const double packetDuration = config.packetDuration * MS_TO_SECONDS;
+
+    std::vector<TimingSource> sources;
+    sources.reserve(config.jammers.size() + 1);
+    sources.push_back({{0.0, config.packetInterval * MS_TO_SECONDS, 0.0, packetDuration}, 0, true});
+
+    int activeJammers = 0;
+    for (const auto& jammer : config.jammers) {
+        Window window;
+        Activity activity = calculateJammedWindow(jammer, window);
+        if (activity == Activity::ALWAYS) {
+            ++activeJammers;
+        } else if (activity == Activity::PERIODIC) {
+            sources.push_back({window, 0, false});
+        }
+    }
+
+    double expectedEvents = 0.0;
+    for (const auto& source : sources) {
+        expectedEvents += 2.0 * (duration - std::min(duration, source.window.offset)) / source.window.period;
+    }
+    if (!(expectedEvents <= MathConstants::MAX_TIMING_SIMULATION_EVENTS)) return false;
+
+    CommunicationEventScheduler scheduler;
+    scheduler.reserve(sources.size());
+    for (size_t s = 0; s < sources.size(); ++s) {
+        scheduler.schedule(sources[s].window.offset + sources[s].window.onTime, static_cast<uint32_t>(s), EVENT_ON);
+    }
+
+    uint64_t eventCount = 0;
+    uint64_t packetCount = 0;
+    uint64_t corruptedCount = 0;
+    double overlapSum = 0.0;
+    double jammedTime = 0.0;
+    double packetStartJammedTime = 0.0;
+    double lastTime = 0.0;
+
+    CommunicationEventScheduler::Event event;
+    while (!scheduler.empty() && scheduler.peek().time <= duration) {
+        scheduler.popNext(event);
+        ++eventCount;
+        if (activeJammers > 0) jammedTime += event.time - lastTime;
+        lastTime = event.time;
+
+        TimingSource& source = sources[event.source];
+        const Window& window = source.window;
+        if (event.kind == EVENT_ON) {
+            if (source.packet) {
+                packetStartJammedTime = jammedTime;
+            } else {
+                ++activeJammers;
+            }
+            scheduler.schedule(window.offset + static_cast<double>(source.cycle) * window.period + window.offTime,
+                               event.source, EVENT_OFF);
+        } else {
+            if (source.packet) {
+                double overlap = std::min(1.0, (jammedTime - packetStartJammedTime) / packetDuration);
+                ++packetCount;
+                overlapSum += overlap;
+                if (overlap > config.corruptionThreshold) ++corruptedCount;
+            } else {
+                --activeJammers;
+            }
+            ++source.cycle;
+            scheduler.schedule(window.offset + static_cast<double>(source.cycle) * window.period + window.onTime,
+                               event.source, EVENT_ON);
+        }
+    }
+    if (activeJammers > 0) jammedTime += duration - lastTime;
+
+    result.eventCount = eventCount;
+    result.packetCount = packetCount;
+    result.corruptedPacketCount = corruptedCount;
+    result.jammedTimeFraction = std::min(1.0, jammedTime / duration);
+    result.meanPacketOverlap = packetCount > 0 ? overlapSum / static_cast<double>(packetCount) : 0.0;
+    return true;
+}
@@ -0,0 +1,100 @@
+#include "CommunicationVectorMath.h"
+#include "MathConstants.h"
+#include <cstdint>
+#include <cstring>
+
+namespace {
+    constexpr uint64_t EXPONENT_MASK = 0x7ff0000000000000ULL;
+    constexpr uint64_t MANTISSA_MASK = 0x000fffffffffffffULL;
+    constexpr uint64_t EXPONENT_BIAS = 1023;
+    constexpr int MANTISSA_BITS = 52;
+
+    // √2的尾数位；尾数位大于该值时m > √2，加上偏移量后恰好进位到第52位
+    constexpr uint64_t SQRT_2_MANTISSA = 0x6a09e667f3bcdULL;
+    constexpr uint64_t FOLD_OFFSET = MANTISSA_MASK - SQRT_2_MANTISSA;
+
+    // 将整数指数拼入2^52的尾数再减去2^52，得到其浮点值，避免整数到浮点数的转换指令
+    constexpr uint64_t EXPONENT_MAGIC_BITS = 0x4330000000000000ULL;
+    constexpr double EXPONENT_MAGIC = 4503599627370496.0 + 1023.0;
+
+    // 1.5·2^52：加上该值后尾数最低位即为舍入到最近整数的结果，两者位模式之差就是该整数
+    constexpr double ROUNDING_MAGIC = 6755399441055744.0;
+    constexpr double LOG2_10 = 3.32192809488736234787;
+    // 2^n的指数位为n + 1023，n限制在[-1022, 1023]内，即n + 1022 ∈ [0, 2045]
+    constexpr uint64_t MAX_BIASED_EXPONENT = 2045;
+}
+
+/// @brief 批量计算常用对数
+/// @details x = m·2^e，m先归一化到[1, 2)，大于√2时再折半使s = (m-1)/(m+1)满足|s| < 0.172，
+///          ln(m) = 2·atanh(s) = 2s(1 + s²/3 + s⁴/5 + ... + s¹²/13)，截断误差约4e-13
+/// @param input 输入数组，元素须为正的规格化浮点数
+/// @param output 输出数组，可与input相同
+/// @param count 数组长度
+void CommunicationVectorMath::log10Batch(const double* input, double* output, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t bits;
+        std::memcpy(&bits, &input[i], sizeof(bits));
+
+        // 折半判断与指数修正均用整数加法和移位完成，循环体内没有比较和分支，可被自动向量化
+        uint64_t mantissaField = bits & MANTISSA_MASK;
+        uint64_t fold = (mantissaField + FOLD_OFFSET) >> MANTISSA_BITS;
+
+        uint64_t mantissaBits = mantissaField | ((EXPONENT_BIAS - fold) << MANTISSA_BITS);
+        double mantissa;
+        std::memcpy(&mantissa, &mantissaBits, sizeof(mantissa));
+
+        uint64_t exponentBits = (((bits & EXPONENT_MASK) >> MANTISSA_BITS) + fold) | EXPONENT_MAGIC_BITS;
+        double e;
+        std::memcpy(&e, &exponentBits, sizeof(e));
+        e -= EXPONENT_MAGIC;
+
+        double s = (mantissa - 1.0) / (mantissa + 1.0);
+        double s2 = s * s;
+        double series = 1.0 + s2 * (1.0 / 3.0 + s2 * (1.0 / 5.0 + s2 * (1.0 / 7.0 +
+                        s2 * (1.0 / 9.0 + s2 * (1.0 / 11.0 + s2 * (1.0 / 13.0))))));
+        double lnMantissa = 2.0 * s * series;
+
+        output[i] = (e * MathConstants::LN_2 + lnMantissa) * MathConstants::LOG10_E;
+    }
+}
+
+/// @brief 批量计算10的幂
+/// @details t = x·log2(10)，n = round(t)由加减1.5·2^52得到，两者位模式之差即为n；
+///          n在整数域饱和到规格化指数范围[-1022, 1023]后直接拼成2^n的指数位。
+///          2^(t-n) = e^y（y = (t-n)·ln2，|y| ≤ 0.347）展开到y¹³/13!，截断误差小于1e-17。
+///          饱和只用整数移位与按位运算，不引入浮点比较，循环体可被自动向量化
+/// @param input 输入数组，元素须为有限值且|x| < 1e15
+/// @param output 输出数组，可与input相同
+/// @param count 数组长度
+void CommunicationVectorMath::exp10Batch(const double* input, double* output, size_t count) {
+    uint64_t magicBits;
+    std::memcpy(&magicBits, &ROUNDING_MAGIC, sizeof(magicBits));
+
+    for (size_t i = 0; i < count; ++i) {
+        const double t = input[i] * LOG2_10;
+        double rounded = t + ROUNDING_MAGIC;
+        uint64_t roundedBits;
+        std::memcpy(&roundedBits, &rounded, sizeof(roundedBits));
+        rounded -= ROUNDING_MAGIC;
+
+        // biased = n + 1022，合法范围[0, MAX_BIASED_EXPONENT]；负数时清零，超出上界时取上界
+        uint64_t biased = roundedBits - magicBits + (EXPONENT_BIAS - 1);
+        const uint64_t negative = static_cast<uint64_t>(static_cast<int64_t>(biased) >> 63);
+        biased &= ~negative;
+        const uint64_t overflow =
+            static_cast<uint64_t>(static_cast<int64_t>(MAX_BIASED_EXPONENT - biased) >> 63);
+        biased = (biased & ~overflow) | (MAX_BIASED_EXPONENT & overflow);
+
+        const uint64_t scaleBits = (biased + 1) << MANTISSA_BITS;
+        double scale;
+        std::memcpy(&scale, &scaleBits, sizeof(scale));
+
+        const double y = (t - rounded) * MathConstants::LN_2;
+        const double series = 1.0 + y * (1.0 + y * (1.0 / 2.0 + y * (1.0 / 6.0 + y * (1.0 / 24.0 +
+                              y * (1.0 / 120.0 + y * (1.0 / 720.0 + y * (1.0 / 5040.0 + y * (1.0 / 40320.0 +
+                              y * (1.0 / 362880.0 + y * (1.0 / 3628800.0 + y * (1.0 / 39916800.0 +
+                              y * (1.0 / 479001600.0 + y * (1.0 / 6227020800.0)))))))))))));
+
+        output[i] = series * scale;
+    }
+}
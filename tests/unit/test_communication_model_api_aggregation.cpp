@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationJammerAggregator.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI多干扰机聚合测试类
+ */
+class CommunicationModelAPIAggregationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    static CommunicationJammerEmitter makeJammer(double x, double y, double frequency, double bandwidth, double power) {
+        CommunicationJammerEmitter jammer;
+        jammer.x = x;
+        jammer.y = y;
+        jammer.frequency = frequency;
+        jammer.bandwidth = bandwidth;
+        jammer.power = power;
+        return jammer;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试单个干扰源的接收功率与自由空间损耗一致，无干扰时信干噪比等于链路信噪比
+ */
+TEST_F(CommunicationModelAPIAggregationTest, SingleJammerMatchesFreeSpaceLoss) {
+    const std::vector<std::pair<double, double>> receivers = {{1.0, 0.0}};
+    std::vector<CommunicationAggregateInterference> results;
+    ASSERT_TRUE(api->calculateAggregateInterference({}, receivers, results));
+    ASSERT_EQ(results.size(), 1u);
+    CommunicationLinkStatus status = api->calculateLinkStatus();
+    EXPECT_NEAR(results[0].signalStrength, status.signalStrength, 1e-9);
+    EXPECT_NEAR(results[0].signalToInterferenceNoiseRatio, status.signalToNoiseRatio, 1e-9);
+    EXPECT_TRUE(std::isinf(results[0].interferencePower));
+    EXPECT_EQ(results[0].activeJammerCount, 0u);
+
+    // 干扰源距接收点4km，带宽完全落在接收带宽内
+    ASSERT_TRUE(api->calculateAggregateInterference({makeJammer(1.0, 4.0, 2400.0, 5.0, 40.0)}, receivers, results));
+    const double expected = 40.0 - (20.0 * std::log10(4.0) + 20.0 * std::log10(2400.0) + 32.45);
+    EXPECT_NEAR(results[0].interferencePower, expected, 1e-9);
+    EXPECT_NEAR(results[0].jammerToSignalRatio, expected - status.signalStrength, 1e-9);
+    EXPECT_LT(results[0].signalToInterferenceNoiseRatio, status.signalToNoiseRatio);
+    EXPECT_EQ(results[0].activeJammerCount, 1u);
+}
+
+/**
+ * @brief 测试干扰功率按线性域相加并按频带重叠比例计入
+ */
+TEST_F(CommunicationModelAPIAggregationTest, LinearSumAndBandOverlap) {
+    const std::vector<std::pair<double, double>> receivers = {{0.0, 0.0}, {2.0, 0.0}};
+    const CommunicationJammerEmitter jammer = makeJammer(3.0, 0.0, 2400.0, 10.0, 30.0);
+    std::vector<CommunicationAggregateInterference> single, twin, halfOverlap, outOfBand;
+    ASSERT_TRUE(api->calculateAggregateInterference({jammer}, receivers, single));
+    ASSERT_TRUE(api->calculateAggregateInterference({jammer, jammer}, receivers, twin));
+    for (size_t i = 0; i < receivers.size(); ++i) {
+        EXPECT_NEAR(twin[i].interferencePower - single[i].interferencePower, 10.0 * std::log10(2.0), 1e-9);
+        EXPECT_EQ(twin[i].activeJammerCount, 2u);
+    }
+    EXPECT_GT(single[1].interferencePower, single[0].interferencePower);
+
+    // 接收带宽为[2390, 2410]MHz，干扰带宽一半落在带外，另计中心频率不同带来的损耗差
+    ASSERT_TRUE(api->calculateAggregateInterference({makeJammer(3.0, 0.0, 2410.0, 10.0, 30.0)}, receivers,
+                                                    halfOverlap));
+    EXPECT_NEAR(single[0].interferencePower - halfOverlap[0].interferencePower,
+                10.0 * std::log10(2.0) + 20.0 * std::log10(2410.0 / 2400.0), 1e-9);
+
+    ASSERT_TRUE(api->calculateAggregateInterference({makeJammer(3.0, 0.0, 2500.0, 10.0, 50.0)}, receivers,
+                                                    outOfBand));
+    EXPECT_TRUE(std::isinf(outOfBand[0].interferencePower));
+    EXPECT_EQ(outOfBand[0].activeJammerCount, 0u);
+
+    CommunicationJammerEmitter invalid = jammer;
+    invalid.bandwidth = 0.0;
+    EXPECT_FALSE(api->calculateAggregateInterference({jammer, invalid}, receivers, single));
+}
+
+/**
+ * @brief 测试由干扰环境的多个干扰频率生成干扰源
+ */
+TEST_F(CommunicationModelAPIAggregationTest, JammingEnvironmentEmitters) {
+    EXPECT_TRUE(api->getJammerEmitters().empty());
+
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.isJammed = true;
+    jamming.jammerPower = 30.0;
+    jamming.jammerBandwidth = 10.0;
+    jamming.jammerDistance = 5.0;
+    jamming.jammerFrequencies = {2388.0, 2400.0, 2405.0, 2440.0};
+    api->setJammingEnvironment(jamming);
+
+    std::vector<CommunicationJammerEmitter> emitters = api->getJammerEmitters();
+    ASSERT_EQ(emitters.size(), 4u);
+    EXPECT_EQ(emitters[3].frequency, 2440.0);
+    EXPECT_EQ(emitters[0].x, 5.0);
+
+    std::vector<CommunicationAggregateInterference> results;
+    ASSERT_TRUE(api->calculateAggregateInterference({{1.0, 0.0}, {4.0, 0.0}}, results));
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].activeJammerCount, 3u);
+    EXPECT_GT(results[1].jammerToSignalRatio, results[0].jammerToSignalRatio);
+    EXPECT_LT(results[1].signalToInterferenceNoiseRatio, results[0].signalToInterferenceNoiseRatio);
+
+    jamming.jammerFrequencies.clear();
+    api->setJammingEnvironment(jamming);
+    emitters = api->getJammerEmitters();
+    ASSERT_EQ(emitters.size(), 1u);
+    EXPECT_EQ(emitters[0].frequency, jamming.jammerFrequency);
+}
+
+/**
+ * @brief 测试干扰源坐标取自干扰环境配置
+ */
+TEST_F(CommunicationModelAPIAggregationTest, JammingEnvironmentEmitterPositions) {
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.isJammed = true;
+    jamming.jammerPower = 30.0;
+    jamming.jammerBandwidth = 10.0;
+    jamming.jammerDistance = 5.0;
+    jamming.jammerFrequencies = {2400.0, 2400.0};
+    ASSERT_TRUE(api->setJammingEnvironment(jamming));
+    std::vector<std::pair<double, double>> receivers = {{1.0, 0.0}};
+    std::vector<CommunicationAggregateInterference> colocated;
+    ASSERT_TRUE(api->calculateAggregateInterference(receivers, colocated));
+
+    jamming.jammerPositions = {{1.0, 3.0}, {-2.0, -1.0}};
+    ASSERT_TRUE(api->setJammingEnvironment(jamming));
+    std::vector<CommunicationJammerEmitter> emitters = api->getJammerEmitters();
+    ASSERT_EQ(emitters.size(), 2u);
+    EXPECT_EQ(emitters[0].x, 1.0);
+    EXPECT_EQ(emitters[0].y, 3.0);
+    EXPECT_EQ(emitters[1].x, -2.0);
+    EXPECT_EQ(emitters[1].y, -1.0);
+
+    // 与显式传入相同干扰源的结果一致，且不同于全部位于(jammerDistance, 0)的情形
+    std::vector<CommunicationAggregateInterference> configured;
+    std::vector<CommunicationAggregateInterference> explicitJammers;
+    ASSERT_TRUE(api->calculateAggregateInterference(receivers, configured));
+    ASSERT_TRUE(api->calculateAggregateInterference({makeJammer(1.0, 3.0, 2400.0, 10.0, 30.0),
+                                                     makeJammer(-2.0, -1.0, 2400.0, 10.0, 30.0)},
+                                                    receivers, explicitJammers));
+    EXPECT_DOUBLE_EQ(configured[0].interferencePower, explicitJammers[0].interferencePower);
+    EXPECT_NE(configured[0].interferencePower, colocated[0].interferencePower);
+
+    // 坐标个数须与干扰源个数一致且为有限值
+    JammingEnvironment invalid = jamming;
+    invalid.jammerPositions.pop_back();
+    EXPECT_FALSE(api->setJammingEnvironment(invalid));
+    invalid = jamming;
+    invalid.jammerPositions[1].second = std::nan("");
+    EXPECT_FALSE(api->setJammingEnvironment(invalid));
+    EXPECT_EQ(api->getJammingEnvironment().jammerPositions, jamming.jammerPositions);
+}
+
+/**
+ * @brief 测试大规模聚合结果与线程数无关，且与逐个累加一致
+ */
+TEST_F(CommunicationModelAPIAggregationTest, LargeScaleDeterministic) {
+    std::vector<CommunicationJammerEmitter> jammers;
+    for (int j = 0; j < 1003; ++j) {
+        jammers.push_back(makeJammer(10.0 * std::cos(j * 0.37), 10.0 * std::sin(j * 0.37),
+                                     2380.0 + (j % 41), 1.0 + (j % 7), 20.0 + (j % 13)));
+    }
+    std::vector<std::pair<double, double>> receivers;
+    for (int i = 0; i < 500; ++i) {
+        receivers.emplace_back(0.02 * i - 5.0, 0.01 * i);
+    }
+
+    api->setThreadCount(1);
+    std::vector<CommunicationAggregateInterference> serial;
+    ASSERT_TRUE(api->calculateAggregateInterference(jammers, receivers, serial));
+    api->setThreadCount(4);
+    std::vector<CommunicationAggregateInterference> parallel;
+    ASSERT_TRUE(api->calculateAggregateInterference(jammers, receivers, parallel));
+    for (size_t i = 0; i < receivers.size(); ++i) {
+        EXPECT_EQ(serial[i].interferencePower, parallel[i].interferencePower) << i;
+        EXPECT_EQ(serial[i].activeJammerCount, parallel[i].activeJammerCount) << i;
+    }
+
+    // 与逐个干扰源求和的结果相符
+    CommunicationJammerAggregator aggregator(jammers.data(), jammers.size(), 1);
+    double total = 0.0;
+    for (const CommunicationJammerEmitter& jammer : jammers) {
+        CommunicationJammerAggregator one(&jammer, 1, 1);
+        total += one.calculateInterferencePower(receivers[7].first, receivers[7].second, 2390.0, 2410.0);
+    }
+    EXPECT_NEAR(aggregator.calculateInterferencePower(receivers[7].first, receivers[7].second, 2390.0, 2410.0),
+                total, total * 1e-12);
+    EXPECT_NEAR(10.0 * std::log10(total), serial[7].interferencePower, 1e-9);
+
+    EXPECT_THROW(CommunicationJammerAggregator(nullptr, 3, 1), std::invalid_argument);
+}
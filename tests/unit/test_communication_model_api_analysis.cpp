@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationModelCAPI.h"
+#include "MathConstants.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI参数扫描测试类
+ */
+class CommunicationModelAPIAnalysisTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>();
+
+        CommunicationEnvironment env;
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        env.temperature = 20.0;
+        env.humidity = 50.0;
+        env.atmosphericPressure = 1013.25;
+
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试线程数设置
+ */
+TEST_F(CommunicationModelAPIAnalysisTest, ThreadCount) {
+    EXPECT_GE(api->getThreadCount(), 1);
+
+    api->setThreadCount(3);
+    EXPECT_EQ(api->getThreadCount(), 3);
+
+    api->setThreadCount(0);
+    EXPECT_GE(api->getThreadCount(), 1);
+}
+
+/**
+ * @brief 测试扫描结果与逐点设置参数计算一致
+ */
+TEST_F(CommunicationModelAPIAnalysisTest, SweepMatchesSetterEvaluation) {
+    api->setThreadCount(4);
+    auto sweep = api->analyzeParameterSweep(SweepParameter::DISTANCE, 0.5, 50.0, 0.5);
+    ASSERT_EQ(sweep.values.size(), 100u);
+    ASSERT_EQ(sweep.statuses.size(), sweep.values.size());
+    EXPECT_EQ(sweep.parameter, SweepParameter::DISTANCE);
+    EXPECT_DOUBLE_EQ(sweep.values.front(), 0.5);
+    EXPECT_DOUBLE_EQ(sweep.values.back(), 50.0);
+
+    auto original = api->getEnvironment();
+    for (size_t i = 0; i < sweep.values.size(); i += 7) {
+        api->setDistance(sweep.values[i]);
+        auto expected = api->calculateLinkStatus();
+        EXPECT_NEAR(expected.signalToNoiseRatio, sweep.statuses[i].signalToNoiseRatio, 1e-9);
+        EXPECT_NEAR(expected.throughput, sweep.statuses[i].throughput, 1e-6);
+        EXPECT_EQ(expected.statusDescription, sweep.statuses[i].statusDescription);
+    }
+    api->setEnvironment(original);
+}
+
+/**
+ * @brief 测试不同线程数得到相同结果
+ */
+TEST_F(CommunicationModelAPIAnalysisTest, SweepIndependentOfThreadCount) {
+    api->setThreadCount(1);
+    auto serial = api->analyzeParameterSweep(SweepParameter::FREQUENCY, 100.0, 6000.0, 1.0);
+
+    api->setThreadCount(8);
+    auto parallel = api->analyzeParameterSweep(SweepParameter::FREQUENCY, 100.0, 6000.0, 1.0);
+
+    ASSERT_EQ(serial.values.size(), parallel.values.size());
+    for (size_t i = 0; i < serial.values.size(); ++i) {
+        EXPECT_DOUBLE_EQ(serial.values[i], parallel.values[i]);
+        EXPECT_DOUBLE_EQ(serial.statuses[i].signalToNoiseRatio, parallel.statuses[i].signalToNoiseRatio);
+        EXPECT_DOUBLE_EQ(serial.statuses[i].throughput, parallel.statuses[i].throughput);
+    }
+}
+
+/**
+ * @brief 测试频率、功率、距离范围分析接口
+ */
+TEST_F(CommunicationModelAPIAnalysisTest, RangeAnalysis) {
+    auto frequencies = api->analyzeFrequencyRange(1000.0, 3000.0, 500.0);
+    EXPECT_EQ(frequencies.size(), 5u);
+    EXPECT_TRUE(frequencies.count(3000.0));
+
+    auto powers = api->analyzePowerRange(0.0, 40.0, 10.0);
+    ASSERT_EQ(powers.size(), 5u);
+    EXPECT_GT(powers.rbegin()->second.signalStrength, powers.begin()->second.signalStrength);
+
+    auto distances = api->analyzeDistanceRange(1.0, 10.0, 1.0);
+    ASSERT_EQ(distances.size(), 10u);
+    EXPECT_LT(distances.rbegin()->second.signalToNoiseRatio, distances.begin()->second.signalToNoiseRatio);
+
+    // 扫描不修改当前环境
+    EXPECT_DOUBLE_EQ(api->getEnvironment().distance, 1.0);
+}
+
+/**
+ * @brief 测试无效扫描参数
+ */
+TEST_F(CommunicationModelAPIAnalysisTest, InvalidSweepParameters) {
+    EXPECT_TRUE(api->analyzeParameterSweep(SweepParameter::FREQUENCY, 100.0, 200.0, 0.0).values.empty());
+    EXPECT_TRUE(api->analyzeParameterSweep(SweepParameter::FREQUENCY, 200.0, 100.0, 1.0).values.empty());
+    EXPECT_TRUE(api->analyzeDistanceRange(1.0, 10.0, -1.0).empty());
+    EXPECT_EQ(api->analyzePowerRange(10.0, 10.0, 1.0).size(), 1u);
+}
+
+/**
+ * @brief 测试C API范围分析接口
+ */
+TEST_F(CommunicationModelAPIAnalysisTest, CApiRangeAnalysis) {
+    CommModelHandle handle = CommModel_Create();
+    ASSERT_NE(handle, nullptr);
+
+    DoubleArray distances = {nullptr, 0};
+    LinkStatusArray results = {nullptr, 0};
+    ASSERT_EQ(CommModel_AnalyzeDistanceRange(handle, 1.0, 5.0, 1.0, &distances, &results), COMM_SUCCESS);
+    ASSERT_EQ(distances.count, 5);
+    ASSERT_EQ(results.count, 5);
+    EXPECT_DOUBLE_EQ(distances.values[4], 5.0);
+    EXPECT_GT(results.statuses[0].signalToNoiseRatio, results.statuses[4].signalToNoiseRatio);
+
+    EXPECT_EQ(CommModel_AnalyzeFrequencyRange(handle, 100.0, 50.0, 1.0, &distances, &results),
+              COMM_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(CommModel_AnalyzePowerRange(handle, 0.0, 10.0, 1.0, nullptr, &results),
+              COMM_ERROR_NULL_POINTER);
+
+    CommModel_FreeDoubleArray(&distances);
+    CommModel_FreeLinkStatusArray(&results);
+    CommModel_Destroy(handle);
+}
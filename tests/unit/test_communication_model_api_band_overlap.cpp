@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationBandOverlapIndex.h"
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI频段重叠索引测试类
+ */
+class CommunicationModelAPIBandOverlapTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试扫描结果与逐对比较一致，仅边沿相接的频段不计为重叠
+ */
+TEST_F(CommunicationModelAPIBandOverlapTest, MatchesPairwiseComparison) {
+    std::vector<CommunicationFrequencyBand> jammers, channels;
+    for (int j = 0; j < 300; ++j) {
+        jammers.push_back({2300.0 + (j * 37) % 200, 1.0 + (j * 7) % 16});
+    }
+    // 0.5MHz间隔的信道栅格，与部分干扰频段边沿相接
+    for (int c = 0; c < 400; ++c) {
+        channels.push_back({2300.0 + 0.5 * c, 0.5});
+    }
+
+    std::vector<CommunicationBandOverlap> overlaps;
+    ASSERT_TRUE(api->calculateBandOverlaps(jammers, channels, overlaps));
+
+    std::vector<std::tuple<size_t, size_t, double>> expected;
+    for (size_t j = 0; j < jammers.size(); ++j) {
+        for (size_t c = 0; c < channels.size(); ++c) {
+            const double low = std::max(jammers[j].frequency - jammers[j].bandwidth / 2.0,
+                                        channels[c].frequency - channels[c].bandwidth / 2.0);
+            const double high = std::min(jammers[j].frequency + jammers[j].bandwidth / 2.0,
+                                         channels[c].frequency + channels[c].bandwidth / 2.0);
+            if (high > low) expected.emplace_back(j, c, (high - low) / channels[c].bandwidth);
+        }
+    }
+
+    ASSERT_EQ(overlaps.size(), expected.size());
+    for (size_t i = 1; i < overlaps.size(); ++i) {
+        EXPECT_LE(overlaps[i - 1].jammerIndex, overlaps[i].jammerIndex);
+    }
+    std::vector<std::tuple<size_t, size_t, double>> actual;
+    for (const CommunicationBandOverlap& overlap : overlaps) {
+        EXPECT_GT(overlap.overlapFraction, 0.0);
+        EXPECT_LE(overlap.overlapFraction, 1.0);
+        EXPECT_NEAR(overlap.overlapBandwidth, overlap.overlapFraction * channels[overlap.channelIndex].bandwidth, 1e-12);
+        actual.emplace_back(overlap.jammerIndex, overlap.channelIndex, overlap.overlapFraction);
+    }
+    std::sort(actual.begin(), actual.end());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(std::get<0>(actual[i]), std::get<0>(expected[i]));
+        EXPECT_EQ(std::get<1>(actual[i]), std::get<1>(expected[i]));
+        EXPECT_NEAR(std::get<2>(actual[i]), std::get<2>(expected[i]), 1e-12);
+    }
+}
+
+/**
+ * @brief 测试边沿相接、空输入与无效频段
+ */
+TEST_F(CommunicationModelAPIBandOverlapTest, EdgeCases) {
+    std::vector<CommunicationBandOverlap> overlaps;
+    ASSERT_TRUE(api->calculateBandOverlaps({{2400.0, 10.0}}, {{2410.0, 10.0}, {2400.0, 2.0}}, overlaps));
+    ASSERT_EQ(overlaps.size(), 1u);
+    EXPECT_EQ(overlaps[0].channelIndex, 1u);
+    EXPECT_DOUBLE_EQ(overlaps[0].overlapFraction, 1.0);
+
+    ASSERT_TRUE(api->calculateBandOverlaps({}, {{2400.0, 10.0}}, overlaps));
+    EXPECT_TRUE(overlaps.empty());
+    ASSERT_TRUE(api->calculateBandOverlaps({{2400.0, 10.0}}, {}, overlaps));
+    EXPECT_TRUE(overlaps.empty());
+
+    EXPECT_FALSE(api->calculateBandOverlaps({{2400.0, 0.0}}, {{2400.0, 10.0}}, overlaps));
+    EXPECT_FALSE(api->calculateBandOverlaps({{2400.0, 10.0}}, {{NAN, 10.0}}, overlaps));
+    EXPECT_THROW(CommunicationBandOverlapIndex({{2400.0, -1.0}}), std::invalid_argument);
+}
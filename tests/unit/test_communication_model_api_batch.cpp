@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "MathConstants.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI批量计算测试类
+ */
+class CommunicationModelAPIBatchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>();
+
+        baseEnv.frequency = 2400.0;
+        baseEnv.bandwidth = 20.0;
+        baseEnv.transmitPower = 30.0;
+        baseEnv.noisePower = -90.0;
+        baseEnv.distance = 1.0;
+        baseEnv.environmentType = EnvironmentType::OPEN_FIELD;
+        baseEnv.temperature = 20.0;
+        baseEnv.humidity = 50.0;
+        baseEnv.atmosphericPressure = 1013.25;
+
+        api->setEnvironment(baseEnv);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 构造覆盖多种频率、功率、距离和环境类型的样本
+     */
+    std::vector<CommunicationEnvironment> makeEnvironments() const {
+        std::vector<CommunicationEnvironment> envs;
+        const EnvironmentType types[] = {
+            EnvironmentType::OPEN_FIELD, EnvironmentType::URBAN_AREA, EnvironmentType::MOUNTAINOUS
+        };
+        for (int i = 0; i < 30; ++i) {
+            CommunicationEnvironment env = baseEnv;
+            env.frequency = 400.0 + 150.0 * i;
+            env.bandwidth = 5.0 + (i % 4) * 5.0;
+            env.transmitPower = 10.0 + (i % 5) * 5.0;
+            env.noisePower = -100.0 + (i % 3) * 5.0;
+            env.distance = 0.5 + 1.7 * i;
+            env.environmentType = types[i % 3];
+            envs.push_back(env);
+        }
+        return envs;
+    }
+
+    /**
+     * @brief 通过逐个setEnvironment计算参考结果
+     */
+    std::vector<CommunicationLinkStatus> computeReference(const std::vector<CommunicationEnvironment>& envs) {
+        CommunicationEnvironment original = api->getEnvironment();
+        std::vector<CommunicationLinkStatus> reference;
+        for (const auto& env : envs) {
+            api->setEnvironment(env);
+            reference.push_back(api->calculateLinkStatus());
+        }
+        api->setEnvironment(original);
+        return reference;
+    }
+
+    static void expectStatusNear(const CommunicationLinkStatus& expected, const CommunicationLinkStatus& actual) {
+        EXPECT_NEAR(expected.signalStrength, actual.signalStrength, 1e-9);
+        EXPECT_NEAR(expected.signalToNoiseRatio, actual.signalToNoiseRatio, 1e-9);
+        EXPECT_NEAR(expected.bitErrorRate, actual.bitErrorRate, 1e-12);
+        EXPECT_NEAR(expected.throughput, actual.throughput, 1e-6);
+        EXPECT_NEAR(expected.latency, actual.latency, 1e-9);
+        EXPECT_NEAR(expected.packetLossRate, actual.packetLossRate, 1e-9);
+        EXPECT_EQ(expected.quality, actual.quality);
+        EXPECT_EQ(expected.isConnected, actual.isConnected);
+        EXPECT_EQ(expected.statusDescription, actual.statusDescription);
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+    CommunicationEnvironment baseEnv;
+};
+
+/**
+ * @brief 测试批量计算结果与逐个计算一致
+ */
+TEST_F(CommunicationModelAPIBatchTest, BatchMatchesSequentialEvaluation) {
+    auto envs = makeEnvironments();
+    auto reference = computeReference(envs);
+
+    auto results = api->calculateLinkStatusBatch(envs);
+    ASSERT_EQ(results.size(), envs.size());
+    for (size_t i = 0; i < envs.size(); ++i) {
+        expectStatusNear(reference[i], results[i]);
+    }
+}
+
+/**
+ * @brief 测试干扰和抗干扰场景下批量计算结果与逐个计算一致
+ */
+TEST_F(CommunicationModelAPIBatchTest, BatchMatchesSequentialEvaluationUnderJamming) {
+    JammingEnvironment jammingEnv = api->getJammingEnvironment();
+    jammingEnv.isJammed = true;
+    jammingEnv.jammerType = JammerType::BARRAGE;
+    jammingEnv.jammerPower = 40.0;
+    jammingEnv.jammerFrequency = 2400.0;
+    jammingEnv.jammerBandwidth = 50.0;
+    jammingEnv.jammerDistance = 5.0;
+    api->setJammingEnvironment(jammingEnv);
+
+    auto envs = makeEnvironments();
+    for (auto scenario : {CommunicationScenario::JAMMED_COMMUNICATION,
+                          CommunicationScenario::ANTI_JAM_COMMUNICATION}) {
+        api->setScenario(scenario);
+        auto reference = computeReference(envs);
+        auto results = api->calculateLinkStatusBatch(envs);
+        ASSERT_EQ(results.size(), envs.size());
+        for (size_t i = 0; i < envs.size(); ++i) {
+            expectStatusNear(reference[i], results[i]);
+        }
+    }
+}
+
+/**
+ * @brief 测试抗干扰增益随带宽变化时批量计算结果与逐个计算一致
+ */
+TEST_F(CommunicationModelAPIBatchTest, BatchMatchesSequentialEvaluationWithBandwidthDependentGain) {
+    JammingEnvironment jammingEnv = api->getJammingEnvironment();
+    jammingEnv.isJammed = true;
+    jammingEnv.jammerPower = 40.0;
+    jammingEnv.jammerFrequency = 2400.0;
+    jammingEnv.jammerDistance = 5.0;
+    api->setJammingEnvironment(jammingEnv);
+    api->setScenario(CommunicationScenario::ANTI_JAM_COMMUNICATION);
+
+    // 波束成形增益随系统带宽变化
+    CommunicationAntiJamModel antiJam = *api->getAntiJamModel();
+    ASSERT_TRUE(antiJam.setAntiJamTechnique(AntiJamTechnique::BEAM_FORMING));
+    ASSERT_TRUE(antiJam.setChipRate(100));
+    ASSERT_TRUE(api->setAntiJamModel(antiJam));
+    EXPECT_NE(antiJam.calculateAntiJamGainForBandwidth(5.0), antiJam.calculateAntiJamGainForBandwidth(15.0));
+
+    // 超出模型范围的参数与设置失败一致，按模型当前取值计算
+    EXPECT_EQ(antiJam.calculateAntiJamGainForBandwidth(20000.0), antiJam.calculateAntiJamGain());
+    const CommunicationJammerModel& jammer = *api->getJammerModel();
+    EXPECT_EQ(jammer.calculateJammerToSignalRatioForTarget(-1.0), jammer.calculateJammerToSignalRatio());
+
+    auto envs = makeEnvironments();
+    auto reference = computeReference(envs);
+    auto results = api->calculateLinkStatusBatch(envs);
+    ASSERT_EQ(results.size(), envs.size());
+    for (size_t i = 0; i < envs.size(); ++i) {
+        expectStatusNear(reference[i], results[i]);
+    }
+}
+
+/**
+ * @brief 测试列式输入及空列沿用当前环境
+ */
+TEST_F(CommunicationModelAPIBatchTest, ColumnarBatch) {
+    auto envs = makeEnvironments();
+    std::vector<double> distances;
+    std::vector<double> frequencies;
+    for (const auto& env : envs) {
+        distances.push_back(env.distance);
+        frequencies.push_back(env.frequency);
+    }
+
+    CommunicationEnvironmentArrays arrays = {};
+    arrays.frequency = frequencies.data();
+    arrays.distance = distances.data();
+    arrays.count = envs.size();
+
+    std::vector<CommunicationLinkStatus> results(envs.size());
+    ASSERT_TRUE(api->calculateLinkStatusBatch(arrays, results.data()));
+
+    for (size_t i = 0; i < envs.size(); ++i) {
+        CommunicationEnvironment expectedEnv = baseEnv;
+        expectedEnv.frequency = frequencies[i];
+        expectedEnv.distance = distances[i];
+        auto reference = computeReference({expectedEnv});
+        expectStatusNear(reference[0], results[i]);
+    }
+}
+
+/**
+ * @brief 测试批量计算不修改API状态
+ */
+TEST_F(CommunicationModelAPIBatchTest, BatchDoesNotMutateState) {
+    auto before = api->calculateLinkStatus();
+    double jammerTargetFrequency = api->getJammerModel()->getTargetFrequency();
+
+    auto results = api->calculateLinkStatusBatch(makeEnvironments());
+    EXPECT_FALSE(results.empty());
+
+    auto env = api->getEnvironment();
+    EXPECT_DOUBLE_EQ(env.frequency, baseEnv.frequency);
+    EXPECT_DOUBLE_EQ(env.distance, baseEnv.distance);
+    EXPECT_DOUBLE_EQ(api->getJammerModel()->getTargetFrequency(), jammerTargetFrequency);
+    expectStatusNear(before, api->calculateLinkStatus());
+}
+
+/**
+ * @brief 测试无效参数
+ */
+TEST_F(CommunicationModelAPIBatchTest, InvalidArguments) {
+    CommunicationLinkStatus status;
+    EXPECT_FALSE(api->calculateLinkStatusBatch(nullptr, 1, &status));
+    EXPECT_FALSE(api->calculateLinkStatusBatch(&baseEnv, 1, nullptr));
+    EXPECT_TRUE(api->calculateLinkStatusBatch(nullptr, 0, nullptr));
+    EXPECT_TRUE(api->calculateLinkStatusBatch(std::vector<CommunicationEnvironment>()).empty());
+}
+
+/**
+ * @brief 测试数值指标批量计算与链路状态一致
+ */
+TEST_F(CommunicationModelAPIBatchTest, MetricsBatchMatchesStatus) {
+    auto envs = makeEnvironments();
+    auto reference = computeReference(envs);
+
+    std::vector<CommunicationLinkMetrics> metrics(envs.size());
+    ASSERT_TRUE(api->calculateLinkMetricsBatch(envs.data(), envs.size(), metrics.data()));
+
+    for (size_t i = 0; i < envs.size(); ++i) {
+        EXPECT_NEAR(reference[i].signalStrength, metrics[i].signalStrength, 1e-3);
+        EXPECT_NEAR(reference[i].signalToNoiseRatio, metrics[i].signalToNoiseRatio, 1e-3);
+        EXPECT_NEAR(reference[i].bitErrorRate, metrics[i].bitErrorRate, 1e-6 * reference[i].bitErrorRate + 1e-12);
+        EXPECT_NEAR(reference[i].throughput, metrics[i].throughput, 1e-5 * reference[i].throughput + 1e-6);
+        EXPECT_NEAR(reference[i].latency, metrics[i].latency, 1e-5);
+        EXPECT_NEAR(reference[i].packetLossRate, metrics[i].packetLossRate, 1e-6);
+        EXPECT_EQ(reference[i].quality, metrics[i].quality);
+        EXPECT_EQ(reference[i].isConnected, metrics[i].isConnected);
+    }
+
+    auto single = api->calculateLinkMetrics();
+    auto status = api->calculateLinkStatus();
+    EXPECT_NEAR(status.signalToNoiseRatio, single.signalToNoiseRatio, 1e-3);
+    EXPECT_EQ(status.quality, single.quality);
+}
+
+/**
+ * @brief 测试关闭状态描述后按需生成描述
+ */
+TEST_F(CommunicationModelAPIBatchTest, LazyStatusDescription) {
+    EXPECT_TRUE(api->isStatusDescriptionEnabled());
+    auto described = api->calculateLinkStatus();
+    ASSERT_FALSE(described.statusDescription.empty());
+
+    api->enableStatusDescription(false);
+    EXPECT_FALSE(api->isStatusDescriptionEnabled());
+
+    auto status = api->calculateLinkStatus();
+    EXPECT_TRUE(status.statusDescription.empty());
+    EXPECT_EQ(CommunicationModelAPI::describeLinkStatus(status), described.statusDescription);
+    EXPECT_FALSE(CommunicationModelAPI::describeLinkMetrics(api->calculateLinkMetrics()).empty());
+
+    auto results = api->calculateLinkStatusBatch(makeEnvironments());
+    ASSERT_FALSE(results.empty());
+    for (const auto& result : results) {
+        EXPECT_TRUE(result.statusDescription.empty());
+    }
+
+    api->enableStatusDescription(true);
+    EXPECT_EQ(api->calculateLinkStatus().statusDescription, described.statusDescription);
+}
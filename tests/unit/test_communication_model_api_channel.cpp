@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI时变信道仿真测试类
+ */
+class CommunicationModelAPIChannelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    std::vector<CommunicationChannelSample> collect(double duration, double timeStep) const {
+        std::vector<CommunicationChannelSample> samples;
+        EXPECT_TRUE(api->simulateTimeVaryingChannel(duration, timeStep,
+            [&](const CommunicationChannelSample* chunk, size_t count) {
+                samples.insert(samples.end(), chunk, chunk + count);
+                return true;
+            }));
+        return samples;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试阴影衰落的均值、标准差及其对信号强度与信噪比的影响
+ */
+TEST_F(CommunicationModelAPIChannelTest, ShadowingFollowsEnvironmentStdDev) {
+    auto samples = collect(99999.0, 1.0);
+    ASSERT_EQ(samples.size(), 100000u);
+
+    CommunicationLinkStatus base = api->calculateLinkStatus();
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const auto& sample = samples[i];
+        EXPECT_DOUBLE_EQ(sample.time, static_cast<double>(i));
+        sum += sample.shadowingLoss;
+        sumSquares += sample.shadowingLoss * sample.shadowingLoss;
+        if (i % 997 == 0) {
+            EXPECT_NEAR(sample.metrics.signalStrength, base.signalStrength - sample.shadowingLoss, 1e-3);
+            EXPECT_NEAR(sample.metrics.signalToNoiseRatio, base.signalToNoiseRatio - sample.shadowingLoss, 1e-3);
+        }
+    }
+    double mean = sum / samples.size();
+    double stdDev = std::sqrt(sumSquares / samples.size() - mean * mean);
+
+    // 城市环境阴影衰落标准差8dB，均值的标准误约0.025dB
+    EXPECT_NEAR(mean, 0.0, 0.1);
+    EXPECT_NEAR(stdDev, 8.0, 0.1);
+}
+
+/**
+ * @brief 测试结果与线程数无关且重复运行逐位一致
+ */
+TEST_F(CommunicationModelAPIChannelTest, ReproducibleAcrossThreadCounts) {
+    api->setThreadCount(1);
+    auto serial = collect(50000.0, 0.5);
+    api->setThreadCount(4);
+    auto parallel = collect(50000.0, 0.5);
+    auto repeated = collect(50000.0, 0.5);
+
+    ASSERT_EQ(serial.size(), 100001u);
+    ASSERT_EQ(parallel.size(), serial.size());
+    ASSERT_EQ(repeated.size(), serial.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        ASSERT_EQ(serial[i].shadowingLoss, parallel[i].shadowingLoss);
+        ASSERT_EQ(serial[i].metrics.signalToNoiseRatio, parallel[i].metrics.signalToNoiseRatio);
+        ASSERT_EQ(parallel[i].shadowingLoss, repeated[i].shadowingLoss);
+    }
+
+    // 较短的仿真是较长仿真的前缀
+    auto prefix = collect(1000.0, 0.5);
+    ASSERT_EQ(prefix.size(), 2001u);
+    for (size_t i = 0; i < prefix.size(); ++i) {
+        ASSERT_EQ(prefix[i].shadowingLoss, serial[i].shadowingLoss);
+    }
+}
+
+/**
+ * @brief 测试兼容接口与流式接口一致，以及回调提前停止
+ */
+TEST_F(CommunicationModelAPIChannelTest, LegacyVectorAndEarlyStop) {
+    auto samples = collect(10.0, 0.1);
+    auto statuses = api->simulateTimeVaryingChannel(10.0, 0.1);
+    ASSERT_EQ(samples.size(), 101u);
+    ASSERT_EQ(statuses.size(), samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) {
+        EXPECT_FLOAT_EQ(static_cast<float>(statuses[i].signalToNoiseRatio), samples[i].metrics.signalToNoiseRatio);
+        EXPECT_EQ(statuses[i].isConnected, samples[i].metrics.isConnected);
+        EXPECT_FALSE(statuses[i].statusDescription.empty());
+    }
+
+    size_t delivered = 0;
+    int calls = 0;
+    EXPECT_TRUE(api->simulateTimeVaryingChannel(1e6, 1.0,
+        [&](const CommunicationChannelSample*, size_t count) {
+            delivered += count;
+            ++calls;
+            return calls < 2;
+        }));
+    EXPECT_EQ(calls, 2);
+    EXPECT_LT(delivered, 1000001u);
+}
+
+/**
+ * @brief 测试无效参数
+ */
+TEST_F(CommunicationModelAPIChannelTest, InvalidArguments) {
+    auto accept = [](const CommunicationChannelSample*, size_t) { return true; };
+    EXPECT_FALSE(api->simulateTimeVaryingChannel(10.0, 0.0, accept));
+    EXPECT_FALSE(api->simulateTimeVaryingChannel(-1.0, 1.0, accept));
+    EXPECT_FALSE(api->simulateTimeVaryingChannel(std::nan(""), 1.0, accept));
+    EXPECT_FALSE(api->simulateTimeVaryingChannel(10.0, 1.0, CommunicationChannelSampleCallback()));
+    EXPECT_TRUE(api->simulateTimeVaryingChannel(10.0, -1.0).empty());
+    EXPECT_EQ(api->simulateTimeVaryingChannel(0.0, 1.0).size(), 1u);
+}
@@ -0,0 +1,365 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationCheckpoint.h"
+#include <memory>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI检查点测试类
+ */
+class CommunicationModelAPICheckpointTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    static CommunicationMonteCarloConfig makeConfig(uint64_t trials) {
+        CommunicationMonteCarloConfig config;
+        config.trialCount = trials;
+        config.shadowing = true;
+        config.rayleighFading = true;
+        config.jammerPowerStdDev = 0.0;
+        config.jammerDistanceStdDev = 0.0;
+        config.confidence = 0.95;
+        return config;
+    }
+
+    /**
+     * @brief 改写检查点中的字节并重算校验和，使篡改只能由取值校验发现
+     */
+    static std::vector<uint8_t> patch(std::vector<uint8_t> checkpoint, size_t offset, const void* value, size_t size) {
+        std::memcpy(checkpoint.data() + offset, value, size);
+        const size_t header = CommunicationCheckpointFormat::HEADER_SIZE;
+        const uint64_t checksum =
+            CommunicationCheckpointFormat::calculateChecksum(checkpoint.data() + header, checkpoint.size() - header);
+        std::memcpy(checkpoint.data() + 24, &checksum, sizeof(checksum));
+        return checkpoint;
+    }
+
+    /**
+     * @brief 按节头依次查找指定标签的节，返回节内数据的起始偏移，找不到时返回检查点长度
+     */
+    static size_t findSection(const std::vector<uint8_t>& checkpoint, uint32_t sectionTag) {
+        size_t offset = CommunicationCheckpointFormat::HEADER_SIZE;
+        while (offset < checkpoint.size()) {
+            uint32_t tag = 0;
+            uint64_t length = 0;
+            std::memcpy(&tag, checkpoint.data() + offset, sizeof(tag));
+            std::memcpy(&length, checkpoint.data() + offset + 8, sizeof(length));
+            if (tag == sectionTag) return offset + CommunicationCheckpointFormat::SECTION_HEADER_SIZE;
+            offset += CommunicationCheckpointFormat::SECTION_HEADER_SIZE + static_cast<size_t>(length);
+        }
+        return checkpoint.size();
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试检查点完整恢复环境参数与子模型状态
+ */
+TEST_F(CommunicationModelAPICheckpointTest, RoundTripRestoresModelState) {
+    ASSERT_TRUE(api->setScenario(CommunicationScenario::JAMMED_COMMUNICATION));
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.jammerPower = 45.0;
+    jamming.jammerFrequency = 2410.0;
+    jamming.jammerDistance = 3.0;
+    jamming.jammerFrequencies = {2395.0, 2405.0, 2415.0};
+    jamming.jammerPositions = {{3.0, 0.0}, {-1.5, 2.0}, {0.5, -4.0}};
+    ASSERT_TRUE(api->setJammingEnvironment(jamming));
+    api->setDistance(4.0);
+    CommunicationAntiJamModel antiJam = *api->getAntiJamModel();
+    ASSERT_TRUE(antiJam.setHoppingChannels(128));
+    ASSERT_TRUE(api->setAntiJamModel(antiJam));
+    CommunicationJammerModel jammer = *api->getJammerModel();
+    ASSERT_TRUE(jammer.setPulseWidth(0.25));
+    ASSERT_TRUE(api->setJammerModel(jammer));
+    CommunicationReceiveModel receive = *api->getReceiveModel();
+    ASSERT_TRUE(receive.setNoiseFigure(7.5));
+    ASSERT_TRUE(api->setReceiveModel(receive));
+    CommunicationDistanceModel distance = *api->getDistanceModel();
+    ASSERT_TRUE(distance.setLinkMargin(12.0));
+    ASSERT_TRUE(api->setDistanceModel(distance));
+    SignalTransmissionModel signal = *api->getSignalModel();
+    signal.setModulationType(ModulationType::QAM16);
+    ASSERT_TRUE(api->setSignalModel(signal));
+    api->setThreadCount(3);
+    api->enableStatusDescription(false);
+
+    std::vector<uint8_t> checkpoint;
+    ASSERT_TRUE(api->saveCheckpoint(checkpoint));
+    CommunicationLinkStatus expected = api->calculateLinkStatus();
+
+    CommunicationModelAPI restored;
+    restored.setThreadCount(5);
+    ASSERT_TRUE(restored.loadCheckpoint(checkpoint.data(), checkpoint.size()));
+    EXPECT_EQ(restored.getScenario(), CommunicationScenario::JAMMED_COMMUNICATION);
+    EXPECT_EQ(restored.getThreadCount(), 5);  // 线程数取决于主机，不随检查点恢复
+    EXPECT_FALSE(restored.isStatusDescriptionEnabled());
+    EXPECT_EQ(restored.getEnvironment().distance, 4.0);
+    EXPECT_EQ(restored.getEnvironment().environmentType, EnvironmentType::URBAN_AREA);
+    EXPECT_TRUE(restored.getJammingEnvironment().isJammed);
+    EXPECT_EQ(restored.getJammingEnvironment().jammerPower, 45.0);
+    EXPECT_EQ(restored.getJammingEnvironment().jammerFrequencies, jamming.jammerFrequencies);
+    EXPECT_EQ(restored.getJammingEnvironment().jammerPositions, jamming.jammerPositions);
+    EXPECT_EQ(restored.getAntiJamModel()->getHoppingChannels(), 128);
+    EXPECT_EQ(restored.getJammerModel()->getPulseWidth(), 0.25);
+    EXPECT_EQ(restored.getReceiveModel()->getNoiseFigure(), 7.5);
+    EXPECT_EQ(restored.getDistanceModel()->getLinkMargin(), 12.0);
+    EXPECT_EQ(restored.getSignalModel()->getModulationType(), ModulationType::QAM16);
+
+    CommunicationLinkStatus actual = restored.calculateLinkStatus();
+    EXPECT_EQ(actual.signalStrength, expected.signalStrength);
+    EXPECT_EQ(actual.signalToNoiseRatio, expected.signalToNoiseRatio);
+    EXPECT_EQ(actual.throughput, expected.throughput);
+
+    // 文件读写与内存读写一致
+    const std::string filename = "checkpoint_round_trip_test.bin";
+    ASSERT_TRUE(api->saveCheckpointToFile(filename));
+    CommunicationModelAPI fromFile;
+    ASSERT_TRUE(fromFile.loadCheckpointFromFile(filename));
+    EXPECT_EQ(fromFile.calculateLinkStatus().signalToNoiseRatio, expected.signalToNoiseRatio);
+    std::remove(filename.c_str());
+    EXPECT_FALSE(fromFile.loadCheckpointFromFile(filename));
+}
+
+/**
+ * @brief 测试分段执行并经检查点续跑的蒙特卡洛分析与一次执行逐位一致
+ */
+TEST_F(CommunicationModelAPICheckpointTest, MonteCarloResumeMatchesSingleRun) {
+    const CommunicationMonteCarloConfig config = makeConfig(50000);
+    CommunicationMonteCarloResult expected;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(config, expected));
+
+    CommunicationMonteCarloProgress progress;
+    progress.config = config;
+    progress.completedTrials = 0;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(progress, 10000));
+    EXPECT_EQ(progress.completedTrials, 12288u);
+    EXPECT_EQ(progress.result.trialCount, 12288u);
+    EXPECT_FALSE(progress.isComplete());
+
+    std::vector<uint8_t> checkpoint;
+    ASSERT_TRUE(api->saveCheckpoint(checkpoint, nullptr, &progress));
+
+    CommunicationModelAPI resumed;
+    resumed.setThreadCount(2);
+    CommunicationMonteCarloProgress restored;
+    ASSERT_TRUE(resumed.loadCheckpoint(checkpoint.data(), checkpoint.size(), nullptr, &restored));
+    EXPECT_EQ(restored.completedTrials, progress.completedTrials);
+    EXPECT_EQ(resumed.getThreadCount(), 2);
+    while (!restored.isComplete()) {
+        ASSERT_TRUE(resumed.analyzeAvailabilityMonteCarlo(restored, 4096));
+    }
+
+    const CommunicationMonteCarloResult& actual = restored.result;
+    EXPECT_EQ(actual.trialCount, expected.trialCount);
+    EXPECT_EQ(actual.snr.getMean(), expected.snr.getMean());
+    EXPECT_EQ(actual.snr.getVariance(), expected.snr.getVariance());
+    EXPECT_EQ(actual.throughput.getMean(), expected.throughput.getMean());
+    EXPECT_EQ(actual.getOutageProbability(), expected.getOutageProbability());
+    EXPECT_EQ(actual.snr.getMinimum(), expected.snr.getMinimum());
+    for (double percentile : {1.0, 5.0, 50.0, 95.0}) {
+        EXPECT_EQ(actual.snrDistribution.getPercentile(percentile),
+                  expected.snrDistribution.getPercentile(percentile)) << percentile;
+        EXPECT_EQ(actual.throughputDistribution.getPercentile(percentile),
+                  expected.throughputDistribution.getPercentile(percentile)) << percentile;
+    }
+
+    EXPECT_FALSE(resumed.analyzeAvailabilityMonteCarlo(restored, 0));
+    restored.completedTrials = 100;
+    EXPECT_FALSE(resumed.analyzeAvailabilityMonteCarlo(restored, 4096));
+}
+
+/**
+ * @brief 测试时变信道仿真中断后经检查点续跑，样本与一次仿真相同
+ */
+TEST_F(CommunicationModelAPICheckpointTest, ChannelSimulationResume) {
+    const double duration = 2.0;
+    const double timeStep = 1e-4;
+    std::vector<double> expected;
+    ASSERT_TRUE(api->simulateTimeVaryingChannel(duration, timeStep,
+        [&](const CommunicationChannelSample* samples, size_t count) {
+            for (size_t i = 0; i < count; ++i) expected.push_back(samples[i].shadowingLoss);
+            return true;
+        }));
+
+    CommunicationChannelProgress progress;
+    progress.duration = duration;
+    progress.timeStep = timeStep;
+    progress.completedSamples = 0;
+    std::vector<double> actual;
+    int chunks = 0;
+    ASSERT_TRUE(api->simulateTimeVaryingChannel(progress,
+        [&](const CommunicationChannelSample* samples, size_t count) {
+            for (size_t i = 0; i < count; ++i) actual.push_back(samples[i].shadowingLoss);
+            return ++chunks < 2;
+        }));
+    EXPECT_EQ(progress.completedSamples, actual.size());
+
+    std::vector<uint8_t> checkpoint;
+    ASSERT_TRUE(api->saveCheckpoint(checkpoint, &progress));
+    CommunicationModelAPI resumed;
+    CommunicationChannelProgress restored;
+    ASSERT_TRUE(resumed.loadCheckpoint(checkpoint.data(), checkpoint.size(), &restored));
+    ASSERT_TRUE(resumed.simulateTimeVaryingChannel(restored,
+        [&](const CommunicationChannelSample* samples, size_t count) {
+            EXPECT_DOUBLE_EQ(samples[0].time, static_cast<double>(actual.size()) * timeStep);
+            for (size_t i = 0; i < count; ++i) actual.push_back(samples[i].shadowingLoss);
+            return true;
+        }));
+    EXPECT_EQ(restored.completedSamples, expected.size());
+    EXPECT_EQ(actual, expected);
+}
+
+/**
+ * @brief 测试损坏、截断或缺少所需节的检查点被拒绝且API状态不变
+ */
+TEST_F(CommunicationModelAPICheckpointTest, RejectsInvalidCheckpoint) {
+    std::vector<uint8_t> checkpoint;
+    ASSERT_TRUE(api->saveCheckpoint(checkpoint));
+    CommunicationModelAPI target;
+    target.setDistance(7.0);
+    const double snr = target.calculateLinkStatus().signalToNoiseRatio;
+
+    std::vector<uint8_t> corrupted = checkpoint;
+    corrupted[corrupted.size() / 2] ^= 0x01;
+    EXPECT_FALSE(target.loadCheckpoint(corrupted.data(), corrupted.size()));
+    EXPECT_FALSE(target.loadCheckpoint(checkpoint.data(), checkpoint.size() - 8));
+    EXPECT_FALSE(target.loadCheckpoint(checkpoint.data(), 16));
+    EXPECT_FALSE(target.loadCheckpoint(nullptr, 0));
+
+    std::vector<uint8_t> newer = checkpoint;
+    newer[4] = static_cast<uint8_t>(CommunicationCheckpointFormat::VERSION + 1);
+    EXPECT_FALSE(target.loadCheckpoint(newer.data(), newer.size()));
+
+    CommunicationMonteCarloProgress progress;
+    EXPECT_FALSE(target.loadCheckpoint(checkpoint.data(), checkpoint.size(), nullptr, &progress));
+    EXPECT_EQ(target.getEnvironment().distance, 7.0);
+    EXPECT_EQ(target.calculateLinkStatus().signalToNoiseRatio, snr);
+
+    // 按标签定位节，布局长度不符时拒绝
+    CommunicationCheckpointReader reader(checkpoint.data(), checkpoint.size());
+    ASSERT_TRUE(reader.isValid());
+    EXPECT_EQ(reader.getVersion(), CommunicationCheckpointFormat::VERSION);
+    EXPECT_TRUE(reader.hasSection(CommunicationCheckpointFormat::SECTION_ANTI_JAM_MODEL));
+    EXPECT_FALSE(reader.hasSection(CommunicationCheckpointFormat::SECTION_CHANNEL_PROGRESS));
+    EXPECT_FALSE(reader.openSection(CommunicationCheckpointFormat::SECTION_ENVIRONMENT, 1));
+    ASSERT_TRUE(target.loadCheckpoint(checkpoint.data(), checkpoint.size()));
+    EXPECT_EQ(target.getEnvironment().distance, 1.0);
+}
+
+/**
+ * @brief 测试检查点逐字段写入：同一状态两次写出的字节相同，恢复后再写出也与原检查点相同
+ */
+TEST_F(CommunicationModelAPICheckpointTest, SaveIsDeterministic) {
+    ASSERT_TRUE(api->setScenario(CommunicationScenario::JAMMED_COMMUNICATION));
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.jammerFrequencies = {2395.0, 2405.0};
+    api->setJammingEnvironment(jamming);
+
+    CommunicationMonteCarloProgress progress;
+    progress.config = makeConfig(20000);
+    progress.completedTrials = 0;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(progress, 4096));
+
+    std::vector<uint8_t> first;
+    std::vector<uint8_t> second;
+    ASSERT_TRUE(api->saveCheckpoint(first, nullptr, &progress));
+    ASSERT_TRUE(api->saveCheckpoint(second, nullptr, &progress));
+    EXPECT_EQ(first, second);
+
+    CommunicationModelAPI restored;
+    CommunicationMonteCarloProgress restoredProgress;
+    ASSERT_TRUE(restored.loadCheckpoint(first.data(), first.size(), nullptr, &restoredProgress));
+    std::vector<uint8_t> resaved;
+    ASSERT_TRUE(restored.saveCheckpoint(resaved, nullptr, &restoredProgress));
+    EXPECT_EQ(resaved, first);
+}
+
+/**
+ * @brief 测试校验和正确但枚举、布尔值或模型参数越界的检查点被拒绝且API状态不变
+ */
+TEST_F(CommunicationModelAPICheckpointTest, RejectsOutOfRangeValues) {
+    std::vector<uint8_t> checkpoint;
+    ASSERT_TRUE(api->saveCheckpoint(checkpoint));
+    CommunicationModelAPI target;
+    target.setDistance(7.0);
+
+    // 场景与运行选项是第一节：枚举紧跟节头，随后是状态描述开关
+    const size_t settings = CommunicationCheckpointFormat::HEADER_SIZE + CommunicationCheckpointFormat::SECTION_HEADER_SIZE;
+    const int32_t scenario = 99;
+    const uint8_t flag = 2;
+    EXPECT_FALSE(target.loadCheckpoint(patch(checkpoint, settings, &scenario, sizeof(scenario)).data(), checkpoint.size()));
+    EXPECT_FALSE(target.loadCheckpoint(patch(checkpoint, settings + sizeof(int32_t), &flag, sizeof(flag)).data(),
+                                       checkpoint.size()));
+
+    // 把中心频率改成不属于所在频段的值，由信号模型的设置方法拒绝。信号模型节内先写频段枚举，再写中心频率
+    size_t offset = findSection(checkpoint, CommunicationCheckpointFormat::SECTION_SIGNAL_MODEL);
+    ASSERT_LT(offset, checkpoint.size());
+    offset += sizeof(int32_t);
+    const double outOfBand = -1.0;
+    EXPECT_FALSE(target.loadCheckpoint(patch(checkpoint, offset, &outOfBand, sizeof(outOfBand)).data(), checkpoint.size()));
+
+    EXPECT_EQ(target.getEnvironment().distance, 7.0);
+    EXPECT_TRUE(target.loadCheckpoint(checkpoint.data(), checkpoint.size()));
+}
+
+/**
+ * @brief 测试校验和正确但统计累加器或分位数草图状态不自洽的蒙特卡洛进度被拒绝
+ */
+TEST_F(CommunicationModelAPICheckpointTest, RejectsInconsistentMonteCarloStatistics) {
+    CommunicationMonteCarloProgress progress;
+    progress.config = makeConfig(20000);
+    progress.completedTrials = 0;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(progress, 4096));
+    std::vector<uint8_t> checkpoint;
+    ASSERT_TRUE(api->saveCheckpoint(checkpoint, nullptr, &progress));
+
+    // 节内依次为配置（试验数、两个开关、三个实数）、种子、已完成试验数、结果的试验数与置信度，
+    // 随后是四个累加器（样本数、均值、二阶矩、最小值、最大值）与两个分位数草图
+    size_t snr = findSection(checkpoint, CommunicationCheckpointFormat::SECTION_MONTE_CARLO_PROGRESS);
+    ASSERT_LT(snr, checkpoint.size());
+    snr += sizeof(uint64_t) + 2 * sizeof(uint8_t) + 3 * sizeof(double) + 3 * sizeof(uint64_t) + sizeof(double);
+    const size_t mean = snr + sizeof(uint64_t);
+    const size_t m2 = mean + sizeof(double);
+    const size_t minimum = m2 + sizeof(double);
+    const size_t sketch = snr + 4 * (sizeof(uint64_t) + 4 * sizeof(double));
+    const size_t sketchMinimum = sketch + 2 * sizeof(double);
+
+    CommunicationModelAPI target;
+    CommunicationMonteCarloProgress restored;
+    const double negative = -1.0;
+    const double nan = std::nan("");
+    const double huge = 1e300;
+    const uint64_t zero = 0;
+    EXPECT_FALSE(target.loadCheckpoint(patch(checkpoint, m2, &negative, sizeof(negative)).data(),
+                                       checkpoint.size(), nullptr, &restored));
+    EXPECT_FALSE(target.loadCheckpoint(patch(checkpoint, mean, &nan, sizeof(nan)).data(),
+                                       checkpoint.size(), nullptr, &restored));
+    EXPECT_FALSE(target.loadCheckpoint(patch(checkpoint, minimum, &huge, sizeof(huge)).data(),
+                                       checkpoint.size(), nullptr, &restored));
+    EXPECT_FALSE(target.loadCheckpoint(patch(checkpoint, snr, &zero, sizeof(zero)).data(),
+                                       checkpoint.size(), nullptr, &restored));
+    EXPECT_FALSE(target.loadCheckpoint(patch(checkpoint, sketchMinimum, &nan, sizeof(nan)).data(),
+                                       checkpoint.size(), nullptr, &restored));
+
+    ASSERT_TRUE(target.loadCheckpoint(checkpoint.data(), checkpoint.size(), nullptr, &restored));
+    EXPECT_EQ(restored.result.snr.getMean(), progress.result.snr.getMean());
+}
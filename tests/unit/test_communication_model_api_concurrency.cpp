@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+/**
+ * @brief CommunicationModelAPI并发查询测试类
+ */
+class CommunicationModelAPIConcurrencyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::JAMMED_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 5.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+
+        JammingEnvironment jammingEnv = api->getJammingEnvironment();
+        jammingEnv.jammerPower = 40.0;
+        jammingEnv.jammerFrequency = 2400.0;
+        jammingEnv.jammerDistance = 10.0;
+        api->setJammingEnvironment(jammingEnv);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试const查询不修改API状态
+ */
+TEST_F(CommunicationModelAPIConcurrencyTest, ConstQueriesHaveNoSideEffects) {
+    auto env = api->getEnvironment();
+    double jammerTargetDistance = api->getJammerModel()->getTargetDistance();
+    double jsr = api->calculateJammerToSignalRatio();
+    auto before = api->calculateLinkStatus();
+
+    double requiredPower = api->calculateRequiredPower(20.0);
+    EXPECT_GT(requiredPower, api->calculateRequiredPower(2.0));
+    EXPECT_FALSE(api->calculateJammerCoverage().empty());
+
+    EXPECT_DOUBLE_EQ(api->getEnvironment().distance, env.distance);
+    EXPECT_DOUBLE_EQ(api->getJammerModel()->getTargetDistance(), jammerTargetDistance);
+    EXPECT_DOUBLE_EQ(api->calculateJammerToSignalRatio(), jsr);
+    EXPECT_DOUBLE_EQ(api->calculateLinkStatus().signalToNoiseRatio, before.signalToNoiseRatio);
+    EXPECT_DOUBLE_EQ(api->calculateRequiredPower(20.0), requiredPower);
+}
+
+/**
+ * @brief 测试经set*Model()替换子模型后，各查询读到的是新的快照
+ */
+TEST_F(CommunicationModelAPIConcurrencyTest, SubModelReplacementRefreshesSnapshot) {
+    const double jsr = api->calculateJammerToSignalRatio();
+    const double range = api->calculatePerformance().effectiveRange;
+
+    CommunicationJammerModel jammer = *api->getJammerModel();
+    ASSERT_TRUE(jammer.setJammerPower(jammer.getJammerPower() - 10.0));
+    ASSERT_TRUE(api->setJammerModel(jammer));
+    EXPECT_NEAR(api->calculateJammerToSignalRatio(), jsr - 10.0, 1e-9);
+
+    CommunicationDistanceModel distance = *api->getDistanceModel();
+    ASSERT_TRUE(distance.setMaxLineOfSight(range / 2.0));
+    ASSERT_TRUE(api->setDistanceModel(distance));
+    EXPECT_LT(api->calculatePerformance().effectiveRange, range);
+    EXPECT_EQ(api->calculateCommunicationRange(), api->calculatePerformance().effectiveRange);
+
+    api->setRandomSeed(42);
+    EXPECT_EQ(api->getRandomSeed(), 42u);
+}
+
+/**
+ * @brief 测试多线程并发查询同一实例得到与串行一致的结果
+ */
+TEST_F(CommunicationModelAPIConcurrencyTest, ConcurrentQueriesMatchSerial) {
+    const auto expectedStatus = api->calculateLinkStatus();
+    const auto expectedPerformance = api->calculatePerformance();
+    const double expectedPower = api->calculateRequiredPower(15.0);
+    const auto expectedCoverage = api->calculateJammerCoverage();
+
+    const int threadCount = 8;
+    const int iterations = 200;
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < iterations; ++i) {
+                auto status = api->calculateLinkStatus();
+                auto performance = api->calculatePerformance();
+                if (status.signalToNoiseRatio != expectedStatus.signalToNoiseRatio ||
+                    status.statusDescription != expectedStatus.statusDescription ||
+                    performance.maxDataRate != expectedPerformance.maxDataRate ||
+                    api->calculateRequiredPower(15.0) != expectedPower) {
+                    ++mismatches;
+                }
+                if (i % 20 == 0 && api->calculateJammerCoverage() != expectedCoverage) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+/**
+ * @brief 测试修改参数期间并发读取的链路状态始终来自某一完整配置
+ */
+TEST_F(CommunicationModelAPIConcurrencyTest, SnapshotConsistentDuringUpdates) {
+    api->setDistance(1.0);
+    const double nearSnr = api->calculateLinkStatus().signalToNoiseRatio;
+    api->setDistance(50.0);
+    const double farSnr = api->calculateLinkStatus().signalToNoiseRatio;
+
+    std::atomic<bool> done(false);
+    std::atomic<int> inconsistent(0);
+    std::thread reader([&]() {
+        while (!done.load()) {
+            double snr = api->calculateLinkStatus().signalToNoiseRatio;
+            if (snr != nearSnr && snr != farSnr) {
+                ++inconsistent;
+            }
+        }
+    });
+
+    for (int i = 0; i < 500; ++i) {
+        api->setDistance(i % 2 == 0 ? 1.0 : 50.0);
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(inconsistent.load(), 0);
+}
+
+/**
+ * @brief 测试修改状态描述开关与线程数期间的并发读取
+ */
+TEST_F(CommunicationModelAPIConcurrencyTest, SettingsConsistentDuringUpdates) {
+    api->setThreadCount(1);
+
+    std::atomic<bool> done(false);
+    std::atomic<int> inconsistent(0);
+    std::thread reader([&]() {
+        while (!done.load()) {
+            const int threads = api->getThreadCount();
+            if (threads != 1 && threads != 2) {
+                ++inconsistent;
+            }
+            api->calculateLinkStatus();
+        }
+    });
+
+    for (int i = 0; i < 500; ++i) {
+        api->setThreadCount(i % 2 == 0 ? 1 : 2);
+        api->enableStatusDescription(i % 2 == 0);
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(api->getThreadCount(), 2);
+    EXPECT_FALSE(api->isStatusDescriptionEnabled());
+    EXPECT_TRUE(api->calculateLinkStatus().statusDescription.empty());
+}
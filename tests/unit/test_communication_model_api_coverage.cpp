@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI覆盖等值线测试类
+ */
+class CommunicationModelAPICoverageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 通过setDistance计算参考可用性
+     */
+    double referenceAvailability(double distance) {
+        CommunicationEnvironment original = api->getEnvironment();
+        api->setDistance(distance);
+        double availability = api->calculatePerformance().availability;
+        api->setEnvironment(original);
+        return availability;
+    }
+
+    /**
+     * @brief 通过1×1栅格计算平面上一点的参考信噪比（无抗干扰）
+     */
+    double referenceJammedSnr(double x, double y) const {
+        const double halfWidth = 1e-6;
+        CommunicationRasterSpec spec = {x - halfWidth, x + halfWidth, y - halfWidth, y + halfWidth, 1, 1};
+        CommunicationRaster signal;
+        CommunicationRaster interference;
+        EXPECT_TRUE(api->renderSignalStrengthRaster(spec, signal));
+        EXPECT_TRUE(api->renderInterferenceRaster(spec, interference));
+        return signal.values[0] - api->getEnvironment().noisePower - interference.values[0];
+    }
+
+    static bool isClosed(const std::vector<std::pair<double, double>>& polyline) {
+        return polyline.size() > 3 && polyline.front() == polyline.back();
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试无干扰时等值线为以发射机为中心的圆
+ */
+TEST_F(CommunicationModelAPICoverageTest, UnjammedContourMatchesAvailability) {
+    CommunicationCoverageContour contour;
+    ASSERT_TRUE(api->analyzeCoverageContour(0.9, 10, contour));
+    ASSERT_EQ(contour.polylines.size(), 1u);
+    const auto& polyline = contour.polylines[0];
+    EXPECT_TRUE(isClosed(polyline));
+
+    double radius = std::hypot(polyline[0].first, polyline[0].second);
+    EXPECT_LT(radius, contour.extent);
+    for (size_t k = 0; k < polyline.size(); k += 37) {
+        double distance = std::hypot(polyline[k].first, polyline[k].second);
+        EXPECT_NEAR(distance, radius, contour.cellSize);
+        EXPECT_NEAR(referenceAvailability(distance), 0.9, 1e-3);
+    }
+    EXPECT_GT(referenceAvailability(radius * 0.9), 0.9);
+    EXPECT_LT(referenceAvailability(radius * 1.1), 0.9);
+
+    auto legacy = api->getCoverageContour(0.9);
+    EXPECT_EQ(legacy, polyline);
+}
+
+/**
+ * @brief 测试覆盖区域内的干扰机形成未覆盖的孔洞
+ */
+TEST_F(CommunicationModelAPICoverageTest, JammerInsideCoverageCreatesHole) {
+    api->setScenario(CommunicationScenario::JAMMED_COMMUNICATION);
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.isJammed = true;
+    jamming.jammerPower = 10.0;
+    jamming.jammerFrequency = 2400.0;
+    jamming.jammerDistance = 1.0;
+    api->setJammingEnvironment(jamming);
+
+    CommunicationCoverageContour contour;
+    ASSERT_TRUE(api->analyzeCoverageContour(0.9, 11, contour));
+    ASSERT_EQ(contour.polylines.size(), 2u);
+
+    for (const auto& polyline : contour.polylines) {
+        EXPECT_TRUE(isClosed(polyline));
+        for (size_t k = 0; k < polyline.size(); k += 11) {
+            double snr = referenceJammedSnr(polyline[k].first, polyline[k].second);
+            EXPECT_NEAR(snr, contour.snrThreshold, 0.05);
+        }
+    }
+
+    // 较短的一条环绕干扰机
+    const auto& hole = contour.polylines[0].size() < contour.polylines[1].size() ?
+                       contour.polylines[0] : contour.polylines[1];
+    double sumX = 0.0;
+    double sumY = 0.0;
+    for (const auto& point : hole) {
+        sumX += point.first;
+        sumY += point.second;
+    }
+    EXPECT_NEAR(sumX / hole.size(), jamming.jammerDistance, 0.2);
+    EXPECT_NEAR(sumY / hole.size(), 0.0, 0.1);
+}
+
+/**
+ * @brief 测试采样点数随等值线长度而非区域面积增长
+ */
+TEST_F(CommunicationModelAPICoverageTest, SampleCountScalesWithPerimeter) {
+    CommunicationCoverageContour coarse;
+    CommunicationCoverageContour fine;
+    ASSERT_TRUE(api->analyzeCoverageContour(0.9, 10, coarse));
+    ASSERT_TRUE(api->analyzeCoverageContour(0.9, 12, fine));
+
+    // 层级加2，面积采样增加16倍，周长采样约增加4倍
+    double ratio = static_cast<double>(fine.sampleCount) / coarse.sampleCount;
+    EXPECT_LT(ratio, 6.0);
+    double fullGrid = std::pow(4096.0 + 1.0, 2.0);
+    EXPECT_LT(static_cast<double>(fine.sampleCount), fullGrid / 50.0);
+    EXPECT_GT(fine.polylines[0].size(), 3 * coarse.polylines[0].size());
+}
+
+/**
+ * @brief 测试无效参数
+ */
+TEST_F(CommunicationModelAPICoverageTest, InvalidArguments) {
+    CommunicationCoverageContour contour;
+    EXPECT_FALSE(api->analyzeCoverageContour(0.0, 10, contour));
+    EXPECT_FALSE(api->analyzeCoverageContour(1.0, 10, contour));
+    EXPECT_FALSE(api->analyzeCoverageContour(std::nan(""), 10, contour));
+    EXPECT_FALSE(api->analyzeCoverageContour(0.9, 3, contour));
+    EXPECT_FALSE(api->analyzeCoverageContour(0.9, 17, contour));
+    EXPECT_TRUE(api->getCoverageContour(1.5).empty());
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationHoppingSimulator.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI跳频碰撞仿真测试类
+ *
+ * 跳频频带为2400MHz ± 50MHz，共100个1MHz信道，跳频速率1000Hz，驻留时间1ms。
+ */
+class CommunicationModelAPIHoppingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::ANTI_JAM_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+
+        CommunicationAntiJamModel* antiJam = api->getAntiJamModel();
+        ASSERT_NE(antiJam, nullptr);
+        ASSERT_TRUE(antiJam->setHoppingChannels(100));
+        ASSERT_TRUE(antiJam->setChannelSpacing(1.0));
+        ASSERT_TRUE(antiJam->setHoppingRate(1000.0));
+        ASSERT_TRUE(antiJam->setDwellTime(1.0));
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    static CommunicationTimingJammer makeJammer(JammerType type, double frequency, double bandwidth) {
+        CommunicationTimingJammer jammer;
+        jammer.type = type;
+        jammer.frequency = frequency;
+        jammer.bandwidth = bandwidth;
+        jammer.pulseWidth = 0.5;
+        jammer.pulseRepetitionRate = 250.0;
+        jammer.sweepRate = 1000.0;
+        jammer.sweepRange = 100.0;
+        jammer.startOffset = 0.0;
+        return jammer;
+    }
+
+    static CommunicationHoppingConfig makeConfig(uint64_t hops, int nets) {
+        CommunicationHoppingConfig config;
+        config.hopCount = hops;
+        config.netCount = nets;
+        config.hopsPerPacket = 4;
+        config.toleratedHits = 1;
+        return config;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试固定频段干扰：命中率等于受干扰信道比例，丢包率服从二项分布
+ */
+TEST_F(CommunicationModelAPIHoppingTest, StaticBandHitRateAndPacketLoss) {
+    // 覆盖2375-2400MHz，即25-49号共25个信道
+    CommunicationHoppingConfig config = makeConfig(200000, 8);
+    config.jammers.push_back(makeJammer(JammerType::BARRAGE, 2387.5, 25.0));
+
+    CommunicationHoppingResult result;
+    ASSERT_TRUE(api->simulateFrequencyHopping(config, result));
+    EXPECT_EQ(result.hopCount, 1600000u);
+    EXPECT_EQ(result.packetCount, 400000u);
+    EXPECT_DOUBLE_EQ(result.jammedChannelFraction, 0.25);
+    EXPECT_NEAR(result.getHitRate(), 0.25, 0.002);
+    ASSERT_EQ(result.netHitRates.size(), 8u);
+    for (double rate : result.netHitRates) {
+        EXPECT_NEAR(rate, 0.25, 0.005);
+    }
+
+    // 4跳中至少2跳受干扰：1 - 0.75^4 - 4 * 0.25 * 0.75^3
+    double expectedLoss = 1.0 - std::pow(0.75, 4) - 4.0 * 0.25 * std::pow(0.75, 3);
+    EXPECT_NEAR(result.getPacketLossRate(), expectedLoss, 0.005);
+}
+
+/**
+ * @brief 测试分块位集计数与逐跳检查结果逐一一致，且与线程数无关
+ */
+TEST_F(CommunicationModelAPIHoppingTest, MatchesPerHopReference) {
+    CommunicationHoppingSimulator simulator(2400.0, 100, 1.0, 1000.0, 0.4, 42, 1);
+    CommunicationHoppingConfig config = makeConfig(70001, 3);
+    config.hopsPerPacket = 5;
+    config.toleratedHits = 2;
+    config.jammers.push_back(makeJammer(JammerType::SWEEP_FREQUENCY, 2400.0, 3.0));
+    config.jammers.push_back(makeJammer(JammerType::PULSE, 2430.0, 20.0));
+    config.jammers.back().startOffset = 0.3;
+
+    uint64_t hits = 0;
+    uint64_t lost = 0;
+    uint64_t jammedChannels = 0;
+    std::vector<uint64_t> words(simulator.getWordCount());
+    std::vector<int> packetHits(3, 0);
+    for (uint64_t hop = 0; hop < config.hopCount; ++hop) {
+        simulator.calculateJammedChannels(config.jammers, hop, words.data());
+        for (int channel = 0; channel < 100; ++channel) {
+            jammedChannels += (words[channel / 64] >> (channel % 64)) & 1ULL;
+        }
+        for (int net = 0; net < 3; ++net) {
+            int channel = simulator.selectChannel(net, hop);
+            ASSERT_GE(channel, 0);
+            ASSERT_LT(channel, 100);
+            bool hit = ((words[channel / 64] >> (channel % 64)) & 1ULL) != 0;
+            hits += hit ? 1 : 0;
+            packetHits[net] += hit ? 1 : 0;
+            if (hop % 5 == 4) {
+                lost += packetHits[net] > 2 ? 1 : 0;
+                packetHits[net] = 0;
+            }
+        }
+    }
+
+    CommunicationHoppingResult result;
+    ASSERT_TRUE(simulator.run(config, result));
+    EXPECT_EQ(result.hitCount, hits);
+    EXPECT_EQ(result.lostPacketCount, lost);
+    EXPECT_EQ(result.packetCount, 14000u * 3u);
+    EXPECT_DOUBLE_EQ(result.jammedChannelFraction, static_cast<double>(jammedChannels) / (70001.0 * 100.0));
+    EXPECT_GT(result.getHitRate(), 0.0);
+
+    CommunicationHoppingSimulator parallel(2400.0, 100, 1.0, 1000.0, 0.4, 42, 4);
+    CommunicationHoppingResult parallelResult;
+    ASSERT_TRUE(parallel.run(config, parallelResult));
+    EXPECT_EQ(parallelResult.hitCount, result.hitCount);
+    EXPECT_EQ(parallelResult.lostPacketCount, result.lostPacketCount);
+    EXPECT_EQ(parallelResult.netHitRates, result.netHitRates);
+}
+
+/**
+ * @brief 测试扫频干扰的受干扰信道位集与驻留期间扫过的频段一致
+ */
+TEST_F(CommunicationModelAPIHoppingTest, SweepOccupancyBitset) {
+    CommunicationHoppingSimulator simulator(2400.0, 100, 1.0, 1000.0, 1.0, 1, 1);
+    std::vector<CommunicationTimingJammer> jammers = {makeJammer(JammerType::SWEEP_FREQUENCY, 2400.0, 1.0)};
+    std::vector<uint64_t> words(simulator.getWordCount());
+
+    // 第10跳驻留期间中心频率从2360MHz扫到2361MHz，加上±0.5MHz瞬时带宽覆盖9-11号信道
+    simulator.calculateJammedChannels(jammers, 10, words.data());
+    for (int channel = 0; channel < 100; ++channel) {
+        bool jammed = ((words[channel / 64] >> (channel % 64)) & 1ULL) != 0;
+        EXPECT_EQ(jammed, channel >= 9 && channel <= 11) << "channel " << channel;
+    }
+
+    // 扫频起始延后0.5ms，第100跳驻留期间中心频率从2449.5MHz越过上限折回2350.5MHz，只覆盖首末信道
+    jammers[0].startOffset = 0.5;
+    simulator.calculateJammedChannels(jammers, 100, words.data());
+    for (int channel = 0; channel < 100; ++channel) {
+        bool jammed = ((words[channel / 64] >> (channel % 64)) & 1ULL) != 0;
+        EXPECT_EQ(jammed, channel == 0 || channel == 99) << "channel " << channel;
+    }
+
+    // 起始时刻之前不干扰
+    jammers[0].startOffset = 50.0;
+    simulator.calculateJammedChannels(jammers, 10, words.data());
+    EXPECT_EQ(words[0] | words[1], 0u);
+}
+
+/**
+ * @brief 测试未给出干扰源时取当前干扰环境，以及无效配置
+ */
+TEST_F(CommunicationModelAPIHoppingTest, DefaultJammerAndInvalidConfig) {
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.isJammed = false;
+    api->setJammingEnvironment(jamming);
+    CommunicationHoppingResult result;
+    ASSERT_TRUE(api->simulateFrequencyHopping(makeConfig(10000, 2), result));
+    EXPECT_EQ(result.hitCount, 0u);
+    EXPECT_EQ(result.lostPacketCount, 0u);
+
+    jamming.isJammed = true;
+    jamming.jammerType = JammerType::GAUSSIAN_NOISE;
+    jamming.jammerFrequency = 2400.0;
+    jamming.jammerBandwidth = 50.0;
+    api->setJammingEnvironment(jamming);
+    ASSERT_TRUE(api->simulateFrequencyHopping(makeConfig(10000, 2), result));
+    EXPECT_DOUBLE_EQ(result.jammedChannelFraction, 0.5);
+    EXPECT_NEAR(result.getHitRate(), 0.5, 0.02);
+
+    CommunicationHoppingConfig config = makeConfig(0, 1);
+    EXPECT_FALSE(api->simulateFrequencyHopping(config, result));
+    config = makeConfig(100, 0);
+    EXPECT_FALSE(api->simulateFrequencyHopping(config, result));
+    config = makeConfig(100, 1);
+    config.hopsPerPacket = 65;
+    EXPECT_FALSE(api->simulateFrequencyHopping(config, result));
+    config = makeConfig(100, 1);
+    config.toleratedHits = 4;
+    EXPECT_FALSE(api->simulateFrequencyHopping(config, result));
+
+    EXPECT_THROW(CommunicationHoppingSimulator(2400.0, 1, 1.0, 1000.0, 1.0, 1, 1), std::invalid_argument);
+    EXPECT_THROW(CommunicationHoppingSimulator(2400.0, 100, 1.0, 0.0, 1.0, 1, 1), std::invalid_argument);
+}
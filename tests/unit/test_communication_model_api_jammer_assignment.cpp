@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI干扰分配测试类
+ */
+class CommunicationModelAPIJammerAssignmentTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    std::vector<CommunicationAssignmentJammer> makeJammers(int count) const {
+        const JammerType types[] = {JammerType::GAUSSIAN_NOISE, JammerType::NARROWBAND,
+                                    JammerType::SWEEP_FREQUENCY, JammerType::PULSE,
+                                    JammerType::BARRAGE, JammerType::SPOT};
+        std::vector<CommunicationAssignmentJammer> jammers;
+        for (int i = 0; i < count; ++i) {
+            jammers.push_back({(i * 7) % 13 - 6.0, (i * 5) % 11 - 5.0, types[i % 6],
+                               10.0 + (i * 9) % 35, 2380.0 + (i * 11) % 40, 10.0 + (i * 3) % 30});
+        }
+        return jammers;
+    }
+
+    std::vector<CommunicationAssignmentTarget> makeTargets(int count) const {
+        std::vector<CommunicationAssignmentTarget> targets;
+        for (int i = 0; i < count; ++i) {
+            targets.push_back({(i * 3) % 17 - 8.0, (i * 13) % 19 - 9.0,
+                               2385.0 + (i * 7) % 30, 5.0 + (i * 5) % 20, -10.0 + (i * 17) % 40});
+        }
+        return targets;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试干扰有效性矩阵与逐个重设目标参数的干扰模型一致，且与线程数无关
+ */
+TEST_F(CommunicationModelAPIJammerAssignmentTest, MatrixMatchesModel) {
+    const auto jammers = makeJammers(12);
+    const auto targets = makeTargets(30);
+    const CommunicationAssignmentConfig config = {JammerAssignmentMode::ONE_TO_ONE, 0.0, 1};
+    CommunicationAssignmentResult result;
+    ASSERT_TRUE(api->assignJammers(jammers, targets, config, result));
+    ASSERT_EQ(result.jammerCount, jammers.size());
+    ASSERT_EQ(result.targetCount, targets.size());
+
+    for (size_t j = 0; j < jammers.size(); ++j) {
+        CommunicationJammerModel model = *api->getJammerModel();
+        model.setJammerType(jammers[j].type);
+        ASSERT_TRUE(model.setJammerPower(jammers[j].power));
+        ASSERT_TRUE(model.setJammerFrequency(jammers[j].frequency));
+        ASSERT_TRUE(model.setJammerBandwidth(jammers[j].bandwidth));
+        for (size_t t = 0; t < targets.size(); ++t) {
+            ASSERT_TRUE(model.setTargetFrequency(targets[t].frequency));
+            ASSERT_TRUE(model.setTargetBandwidth(targets[t].bandwidth));
+            ASSERT_TRUE(model.setTargetPower(targets[t].power));
+            // 干扰机与目标重合时按最小作用距离计算
+            const double distance = std::hypot(jammers[j].x - targets[t].x, jammers[j].y - targets[t].y);
+            ASSERT_TRUE(model.setTargetDistance(std::max(distance, 0.1)));
+            const double expected = model.calculateJammerEffectiveness();
+            EXPECT_NEAR(result.at(j, t), expected, std::fabs(expected) * 1e-12 + 1e-300) << j << " " << t;
+        }
+    }
+
+    api->setThreadCount(4);
+    CommunicationAssignmentResult parallel;
+    ASSERT_TRUE(api->assignJammers(jammers, targets, config, parallel));
+    EXPECT_EQ(parallel.effectiveness, result.effectiveness);
+    EXPECT_EQ(parallel.assignments, result.assignments);
+}
+
+/**
+ * @brief 测试一对一分配的总有效性与穷举最优解一致
+ */
+TEST_F(CommunicationModelAPIJammerAssignmentTest, OneToOneMatchesBruteForce) {
+    const CommunicationAssignmentConfig config = {JammerAssignmentMode::ONE_TO_ONE, 0.0, 1};
+    for (auto shape : {std::make_pair(4, 7), std::make_pair(7, 4), std::make_pair(6, 6)}) {
+        CommunicationAssignmentResult result;
+        ASSERT_TRUE(api->assignJammers(makeJammers(shape.first), makeTargets(shape.second), config, result));
+
+        // 对较少的一侧穷举另一侧的排列
+        const bool byJammer = result.jammerCount <= result.targetCount;
+        const size_t rows = byJammer ? result.jammerCount : result.targetCount;
+        std::vector<size_t> order(byJammer ? result.targetCount : result.jammerCount);
+        std::iota(order.begin(), order.end(), 0);
+        double best = 0.0;
+        do {
+            double total = 0.0;
+            for (size_t r = 0; r < rows; ++r) {
+                total += byJammer ? result.at(r, order[r]) : result.at(order[r], r);
+            }
+            best = std::max(best, total);
+        } while (std::next_permutation(order.begin(), order.end()));
+
+        EXPECT_NEAR(result.totalEffectiveness, best, 1e-12) << shape.first << "x" << shape.second;
+        std::vector<int> jammerUsed(result.jammerCount, 0), targetUsed(result.targetCount, 0);
+        for (const auto& assignment : result.assignments) {
+            EXPECT_EQ(++jammerUsed[assignment.first], 1);
+            EXPECT_EQ(++targetUsed[assignment.second], 1);
+        }
+    }
+}
+
+/**
+ * @brief 测试功率预算分配满足预算与单机目标数限制
+ */
+TEST_F(CommunicationModelAPIJammerAssignmentTest, PowerBudgetRespectsLimits) {
+    const auto jammers = makeJammers(24);
+    const auto targets = makeTargets(200);
+    CommunicationAssignmentResult unlimited;
+    ASSERT_TRUE(api->assignJammers(jammers, targets, {JammerAssignmentMode::POWER_BUDGET, 1e6, 1000}, unlimited));
+    size_t positivePairs = 0;
+    for (double value : unlimited.effectiveness) {
+        positivePairs += value > 0.0 ? 1 : 0;
+    }
+    EXPECT_LE(unlimited.assignments.size(), positivePairs);
+    EXPECT_GT(unlimited.assignments.size(), targets.size());
+
+    const double budget = 0.5;
+    CommunicationAssignmentResult limited;
+    ASSERT_TRUE(api->assignJammers(jammers, targets, {JammerAssignmentMode::POWER_BUDGET, budget, 3}, limited));
+    EXPECT_FALSE(limited.assignments.empty());
+    EXPECT_LE(limited.usedPower, budget * (1.0 + 1e-12));
+    EXPECT_LT(limited.totalEffectiveness, unlimited.totalEffectiveness);
+    std::vector<int> load(jammers.size(), 0);
+    double usedPower = 0.0;
+    for (const auto& assignment : limited.assignments) {
+        EXPECT_LE(++load[assignment.first], 3);
+        usedPower += std::pow(10.0, (jammers[assignment.first].power - 30.0) / 10.0);
+    }
+    EXPECT_NEAR(limited.usedPower, usedPower, 1e-12);
+    for (size_t t = 0; t < targets.size(); ++t) {
+        EXPECT_GE(limited.targetEffectiveness[t], 0.0);
+        EXPECT_LE(limited.targetEffectiveness[t], 1.0);
+    }
+
+    CommunicationAssignmentResult invalid;
+    EXPECT_FALSE(api->assignJammers(jammers, targets, {JammerAssignmentMode::POWER_BUDGET, -1.0, 3}, invalid));
+    EXPECT_FALSE(api->assignJammers(jammers, targets, {JammerAssignmentMode::POWER_BUDGET, 1.0, 0}, invalid));
+    auto badJammers = jammers;
+    badJammers[0].power = 500.0;
+    EXPECT_FALSE(api->assignJammers(badJammers, targets, {JammerAssignmentMode::ONE_TO_ONE, 0.0, 1}, invalid));
+}
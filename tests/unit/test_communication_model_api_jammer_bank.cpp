@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationJammerBank.h"
+#include "CommunicationVectorMath.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI干扰机组测试类
+ */
+class CommunicationModelAPIJammerBankTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 生成参数各不相同、覆盖全部干扰类型的干扰模型
+     */
+    std::vector<CommunicationJammerModel> makeJammers(int count) const {
+        const JammerType types[] = {JammerType::GAUSSIAN_NOISE, JammerType::NARROWBAND,
+                                    JammerType::SWEEP_FREQUENCY, JammerType::PULSE,
+                                    JammerType::BARRAGE, JammerType::SPOT};
+        std::vector<CommunicationJammerModel> jammers;
+        for (int i = 0; i < count; ++i) {
+            CommunicationJammerModel jammer = *api->getJammerModel();
+            jammer.setJammerType(types[i % 6]);
+            EXPECT_TRUE(jammer.setJammerPower(-10.0 + (i * 7) % 55));
+            EXPECT_TRUE(jammer.setJammerFrequency(jammer.getTargetFrequency() + ((i * 13) % 21 - 10) * 15.0));
+            EXPECT_TRUE(jammer.setJammerBandwidth(20.0 + (i * 31) % 500));
+            EXPECT_TRUE(jammer.setTargetDistance(0.5 + (i * 17) % 80));
+            EXPECT_TRUE(jammer.setTargetPower(-20.0 + (i * 11) % 40));
+            EXPECT_TRUE(jammer.setDutyCycle(0.05 + 0.01 * (i % 90)));
+            EXPECT_TRUE(jammer.setSweepRange(1.0 + (i % 50)));
+            jammers.push_back(jammer);
+        }
+        return jammers;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试批量10的幂与std::pow一致
+ */
+TEST_F(CommunicationModelAPIJammerBankTest, VectorExp10MatchesPow) {
+    std::vector<double> input;
+    for (int i = -3000; i <= 3000; ++i) {
+        input.push_back(i * 0.0517);
+    }
+    std::vector<double> output(input.size());
+    CommunicationVectorMath::exp10Batch(input.data(), output.data(), input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        const double expected = std::pow(10.0, input[i]);
+        EXPECT_NEAR(output[i], expected, expected * 1e-13) << input[i];
+    }
+
+    const double extremes[] = {-400.0, 400.0};
+    double saturated[2];
+    CommunicationVectorMath::exp10Batch(extremes, saturated, 2);
+    EXPECT_GT(saturated[0], 0.0);
+    EXPECT_LT(saturated[0], 1e-300);
+    EXPECT_TRUE(std::isfinite(saturated[1]));
+}
+
+/**
+ * @brief 测试分组计算的干扰有效性与逐个干扰模型的结果一致并保持加入顺序
+ */
+TEST_F(CommunicationModelAPIJammerBankTest, EffectivenessMatchesModel) {
+    const std::vector<CommunicationJammerModel> jammers = makeJammers(600);
+    CommunicationJammerBank bank(jammers);
+    ASSERT_EQ(bank.size(), jammers.size());
+    EXPECT_EQ(bank.getGroupSize(JammerType::PULSE), 100u);
+    EXPECT_EQ(bank.getGroupSize(JammerType::SPOT), 100u);
+
+    std::vector<double> effectiveness(bank.size()), effectivePower(bank.size());
+    bank.calculateEffectiveness(effectiveness.data(), effectivePower.data());
+    for (size_t i = 0; i < jammers.size(); ++i) {
+        const CommunicationJammerModel& jammer = jammers[i];
+        const double expected = jammer.calculateJammerEffectiveness();
+        EXPECT_NEAR(effectiveness[i], expected, std::fabs(expected) * 1e-12 + 1e-300) << i;
+        const double expectedPower = jammer.getJammerPower() -
+            CommunicationDistanceModel::calculateFreeSpacePathLoss(jammer.getTargetDistance(),
+                                                                   jammer.getJammerFrequency() / 1000.0);
+        EXPECT_NEAR(effectivePower[i], expectedPower, 1e-9) << i;
+    }
+
+    bank.clear();
+    EXPECT_EQ(bank.size(), 0u);
+    EXPECT_EQ(bank.getGroupSize(JammerType::PULSE), 0u);
+}
+
+/**
+ * @brief 测试协同效果与按定义逐个累加的结果一致
+ */
+TEST_F(CommunicationModelAPIJammerBankTest, CombinedEffectMatchesDefinition) {
+    const CommunicationJammerModel& model = *api->getJammerModel();
+    EXPECT_EQ(model.calculateCombinedJammerEffect({}), 0.0);
+
+    for (int count : {1, 5, 300}) {
+        const std::vector<CommunicationJammerModel> jammers = makeJammers(count);
+        double total = 0.0;
+        for (const CommunicationJammerModel& jammer : jammers) {
+            const double power = jammer.getJammerPower() -
+                CommunicationDistanceModel::calculateFreeSpacePathLoss(jammer.getTargetDistance(),
+                                                                       jammer.getJammerFrequency() / 1000.0);
+            total += std::pow(10.0, power / 10.0) * jammer.calculateJammerEffectiveness();
+        }
+        const double ratio = 10.0 * std::log10(total) - model.getTargetPower();
+        const double expected = std::min(1.0, 1.0 - 1.0 / (1.0 + std::pow(10.0, ratio / 10.0)));
+        EXPECT_NEAR(model.calculateCombinedJammerEffect(jammers), expected, 1e-12) << count;
+
+        CommunicationJammerBank bank(jammers);
+        EXPECT_NEAR(bank.calculateWeightedJammerPower(), total, total * 1e-12) << count;
+    }
+}
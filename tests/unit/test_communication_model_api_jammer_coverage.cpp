@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI干扰覆盖剖面测试类
+ */
+class CommunicationModelAPIJammerCoverageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 设置指定类型的干扰环境
+     */
+    void setJamming(JammerType type, double jammerPower) {
+        JammingEnvironment jammingEnv;
+        jammingEnv.isJammed = true;
+        jammingEnv.jammerType = type;
+        jammingEnv.jammerPower = jammerPower;
+        jammingEnv.jammerFrequency = 2400.0;
+        jammingEnv.jammerBandwidth = 20.0;
+        jammingEnv.jammerDistance = 5.0;
+        api->setJammingEnvironment(jammingEnv);
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试干扰有效性的距离变化规律与干扰模型逐点计算一致
+ */
+TEST_F(CommunicationModelAPIJammerCoverageTest, DistanceLawMatchesModel) {
+    const JammerType types[] = {JammerType::GAUSSIAN_NOISE, JammerType::NARROWBAND,
+                                JammerType::SWEEP_FREQUENCY, JammerType::PULSE,
+                                JammerType::BARRAGE, JammerType::SPOT};
+    for (JammerType type : types) {
+        for (double power : {-40.0, 0.0, 40.0}) {
+            CommunicationJammerModel jammer = *api->getJammerModel();
+            jammer.setJammerType(type);
+            ASSERT_TRUE(jammer.setJammerPower(power));
+            const JammerDistanceLaw law = jammer.calculateEffectivenessDistanceLaw();
+            for (double distance : {0.1, 0.7, 3.0, 25.0, 400.0}) {
+                ASSERT_TRUE(jammer.setTargetDistance(distance));
+                const double expected = jammer.calculateJammerEffectiveness();
+                EXPECT_NEAR(law.evaluate(distance), expected, std::fabs(expected) * 1e-12 + 1e-300)
+                    << static_cast<int>(type) << " " << power << " " << distance;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 测试脉冲干扰的覆盖半径与饱和边界为解析解，剖面满足插值容差
+ */
+TEST_F(CommunicationModelAPIJammerCoverageTest, PulseProfileCrossovers) {
+    setJamming(JammerType::PULSE, 40.0);
+    const JammerDistanceLaw law = api->getJammerModel()->calculateEffectivenessDistanceLaw();
+    ASSERT_GT(law.exponent, 0.0);
+
+    const double tolerance = 1e-3;
+    const std::vector<double> levels = {law.ceiling * 2.0, law.evaluate(0.5), law.evaluate(30.0), 0.0};
+    CommunicationJammerCoverageProfile profile;
+    ASSERT_TRUE(api->calculateJammerCoverageProfile(0.1, 100.0, levels, profile, tolerance));
+
+    ASSERT_EQ(profile.coverageRadii.size(), levels.size());
+    EXPECT_EQ(profile.coverageRadii[0], 0.0);
+    EXPECT_NEAR(profile.coverageRadii[1], 0.5, 1e-9);
+    EXPECT_NEAR(profile.coverageRadii[2], 30.0, 1e-9);
+    EXPECT_EQ(profile.coverageRadii[3], 100.0);
+    EXPECT_NEAR(law.evaluate(profile.saturationDistance), law.ceiling, law.ceiling * 1e-12);
+
+    // 采样点严格递增、覆盖整个区间，且中点插值误差不超过容差
+    ASSERT_EQ(profile.distances.size(), profile.effectiveness.size());
+    EXPECT_EQ(profile.distances.front(), 0.1);
+    EXPECT_EQ(profile.distances.back(), 100.0);
+    EXPECT_LT(profile.distances.size(), 200u);
+    for (size_t i = 1; i < profile.distances.size(); ++i) {
+        ASSERT_LT(profile.distances[i - 1], profile.distances[i]);
+        EXPECT_LE(profile.effectiveness[i], profile.effectiveness[i - 1]);
+        const double middle = (profile.distances[i - 1] + profile.distances[i]) / 2.0;
+        const double interpolated = (profile.effectiveness[i - 1] + profile.effectiveness[i]) / 2.0;
+        EXPECT_LE(std::fabs(law.evaluate(middle) - interpolated), tolerance) << middle;
+    }
+}
+
+/**
+ * @brief 测试与距离无关的干扰类型只需两端采样，且不修改干扰模型
+ */
+TEST_F(CommunicationModelAPIJammerCoverageTest, FlatProfileAndModelUnchanged) {
+    setJamming(JammerType::BARRAGE, 30.0);
+    const double distanceBefore = api->getJammerModel()->getTargetDistance();
+    const double effectiveness = api->calculateJammerEffectiveness();
+
+    CommunicationJammerCoverageProfile profile;
+    ASSERT_TRUE(api->calculateJammerCoverageProfile(0.1, 100.0, {effectiveness / 2.0, effectiveness * 2.0}, profile));
+    EXPECT_EQ(profile.distances, (std::vector<double>{0.1, 100.0}));
+    EXPECT_NEAR(profile.effectiveness[0], effectiveness, 1e-12);
+    EXPECT_EQ(profile.coverageRadii, (std::vector<double>{100.0, 0.0}));
+    EXPECT_EQ(profile.saturationDistance, 0.0);
+    EXPECT_EQ(api->getJammerModel()->getTargetDistance(), distanceBefore);
+
+    const std::vector<double> coverage = api->calculateJammerCoverage();
+    ASSERT_EQ(coverage.size(), 200u);
+    EXPECT_NEAR(coverage.back(), effectiveness, 1e-12);
+
+    EXPECT_FALSE(api->calculateJammerCoverageProfile(5.0, 1.0, {}, profile));
+    EXPECT_FALSE(api->calculateJammerCoverageProfile(0.1, 100.0, {}, profile, 0.0));
+    JammingEnvironment jammingEnv = api->getJammingEnvironment();
+    jammingEnv.isJammed = false;
+    api->setJammingEnvironment(jammingEnv);
+    EXPECT_FALSE(api->calculateJammerCoverageProfile(0.1, 100.0, {}, profile));
+}
@@ -12,7 +12,7 @@ protected:
         api = std::make_unique<CommunicationModelAPI>();
         
         // 设置基础环境
-        CommunicationEnvironment env;
+        CommunicationEnvironment env = api->getEnvironment();
         env.frequency = 2400.0;
         env.bandwidth = 20.0;
         env.transmitPower = 30.0;
@@ -181,9 +181,9 @@ TEST_F(CommunicationModelAPIJammingTest, JammingImpactOnPerformance) {
     auto normalStatus = api->calculateLinkStatus();
     
     // 有干扰情况
-    JammingEnvironment jammingEnv;
+    JammingEnvironment jammingEnv = api->getJammingEnvironment();
     jammingEnv.isJammed = true;
-    jammingEnv.jammerPower = 20.0;
+    jammingEnv.jammerPower = 40.0;
     jammingEnv.jammerDistance = 2.0;
     api->setJammingEnvironment(jammingEnv);
     api->setScenario(CommunicationScenario::JAMMED_COMMUNICATION);
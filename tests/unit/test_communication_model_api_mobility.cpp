@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI移动场景仿真测试类
+ */
+class CommunicationModelAPIMobilityTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    void enableJammer() {
+        api->setScenario(CommunicationScenario::JAMMED_COMMUNICATION);
+        JammingEnvironment jamming = api->getJammingEnvironment();
+        jamming.isJammed = true;
+        jamming.jammerPower = 10.0;
+        jamming.jammerFrequency = 2400.0;
+        jamming.jammerDistance = 1.0;
+        api->setJammingEnvironment(jamming);
+    }
+
+    /**
+     * @brief 绕发射机的螺旋航迹，每个航迹点重复repeat次
+     */
+    static std::vector<std::pair<double, double>> spiral(size_t count, size_t repeat = 1) {
+        std::vector<std::pair<double, double>> trajectory;
+        trajectory.reserve(count * repeat);
+        for (size_t i = 0; i < count; ++i) {
+            double angle = 0.001 * static_cast<double>(i);
+            double radius = 0.05 + 3.0 * static_cast<double>(i) / count;
+            for (size_t r = 0; r < repeat; ++r) {
+                trajectory.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+            }
+        }
+        return trajectory;
+    }
+
+    std::vector<CommunicationMobilitySample> collect(const std::vector<std::pair<double, double>>& trajectory,
+                                                     double timeStep) const {
+        std::vector<CommunicationMobilitySample> samples;
+        EXPECT_TRUE(api->simulateMobilityScenario(trajectory.data(), trajectory.size(), timeStep,
+            [&](const CommunicationMobilitySample* chunk, size_t count) {
+                samples.insert(samples.end(), chunk, chunk + count);
+                return true;
+            }));
+        return samples;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试无干扰时与setDistance计算的链路状态一致
+ */
+TEST_F(CommunicationModelAPIMobilityTest, UnjammedMatchesSetDistance) {
+    std::vector<std::pair<double, double>> trajectory = {{0.5, 0.0}, {0.0, 2.0}, {-3.0, 4.0}, {10.0, -10.0}};
+    auto statuses = api->simulateMobilityScenario(trajectory, 1.0);
+    ASSERT_EQ(statuses.size(), trajectory.size());
+
+    CommunicationEnvironment original = api->getEnvironment();
+    for (size_t i = 0; i < trajectory.size(); ++i) {
+        api->setDistance(std::hypot(trajectory[i].first, trajectory[i].second));
+        CommunicationLinkStatus expected = api->calculateLinkStatus();
+        EXPECT_NEAR(statuses[i].signalStrength, expected.signalStrength, 1e-9);
+        EXPECT_NEAR(statuses[i].signalToNoiseRatio, expected.signalToNoiseRatio, 1e-9);
+        EXPECT_NEAR(statuses[i].throughput, expected.throughput, 1e-6);
+        EXPECT_EQ(statuses[i].isConnected, expected.isConnected);
+        EXPECT_FALSE(statuses[i].statusDescription.empty());
+    }
+    api->setEnvironment(original);
+}
+
+/**
+ * @brief 测试干扰场景下与栅格计算的干信比一致
+ */
+TEST_F(CommunicationModelAPIMobilityTest, JammedMatchesRaster) {
+    enableJammer();
+    std::vector<std::pair<double, double>> trajectory = {{0.3, 0.4}, {1.5, -0.2}, {2.0, 1.0}};
+    auto statuses = api->simulateMobilityScenario(trajectory, 1.0);
+    ASSERT_EQ(statuses.size(), trajectory.size());
+
+    for (size_t i = 0; i < trajectory.size(); ++i) {
+        const double halfWidth = 1e-7;
+        double x = trajectory[i].first;
+        double y = trajectory[i].second;
+        CommunicationRasterSpec spec = {x - halfWidth, x + halfWidth, y - halfWidth, y + halfWidth, 1, 1};
+        CommunicationRaster signal;
+        CommunicationRaster interference;
+        ASSERT_TRUE(api->renderSignalStrengthRaster(spec, signal));
+        ASSERT_TRUE(api->renderInterferenceRaster(spec, interference));
+        double expectedSnr = signal.values[0] - api->getEnvironment().noisePower - interference.values[0];
+        EXPECT_NEAR(statuses[i].signalStrength, signal.values[0], 1e-4);
+        EXPECT_NEAR(statuses[i].signalToNoiseRatio, expectedSnr, 1e-4);
+    }
+}
+
+/**
+ * @brief 测试流式接口与兼容接口一致、与线程数无关，且重复航迹点复用结果
+ */
+TEST_F(CommunicationModelAPIMobilityTest, StreamingMatchesVectorAcrossThreads) {
+    enableJammer();
+    auto trajectory = spiral(6000, 3);
+
+    api->setThreadCount(1);
+    auto serial = collect(trajectory, 0.1);
+    auto statuses = api->simulateMobilityScenario(trajectory, 0.1);
+    api->setThreadCount(4);
+    auto parallel = collect(trajectory, 0.1);
+
+    ASSERT_EQ(serial.size(), trajectory.size());
+    ASSERT_EQ(statuses.size(), trajectory.size());
+    ASSERT_EQ(parallel.size(), trajectory.size());
+    for (size_t i = 0; i < trajectory.size(); ++i) {
+        ASSERT_DOUBLE_EQ(serial[i].time, 0.1 * static_cast<double>(i));
+        ASSERT_EQ(serial[i].metrics.signalToNoiseRatio, parallel[i].metrics.signalToNoiseRatio);
+        ASSERT_EQ(serial[i].metrics.signalToNoiseRatio, static_cast<float>(statuses[i].signalToNoiseRatio));
+        ASSERT_NEAR(serial[i].distance, std::hypot(trajectory[i].first, trajectory[i].second), 1e-12);
+        if (i % 3 != 0) {
+            ASSERT_EQ(serial[i].metrics.signalStrength, serial[i - 1].metrics.signalStrength);
+        }
+    }
+}
+
+/**
+ * @brief 测试回调提前停止与无效参数
+ */
+TEST_F(CommunicationModelAPIMobilityTest, EarlyStopAndInvalidArguments) {
+    auto trajectory = spiral(100000);
+    size_t delivered = 0;
+    EXPECT_TRUE(api->simulateMobilityScenario(trajectory.data(), trajectory.size(), 1.0,
+        [&](const CommunicationMobilitySample*, size_t count) {
+            delivered += count;
+            return false;
+        }));
+    EXPECT_GT(delivered, 0u);
+    EXPECT_LT(delivered, trajectory.size());
+
+    auto accept = [](const CommunicationMobilitySample*, size_t) { return true; };
+    EXPECT_FALSE(api->simulateMobilityScenario(trajectory.data(), trajectory.size(), 0.0, accept));
+    EXPECT_FALSE(api->simulateMobilityScenario(nullptr, 3, 1.0, accept));
+    EXPECT_TRUE(api->simulateMobilityScenario(nullptr, 0, 1.0, accept));
+
+    trajectory[500].second = std::nan("");
+    EXPECT_FALSE(api->simulateMobilityScenario(trajectory.data(), trajectory.size(), 1.0, accept));
+    EXPECT_TRUE(api->simulateMobilityScenario(trajectory, 1.0).empty());
+    EXPECT_TRUE(api->simulateMobilityScenario({{1.0, 0.0}}, -1.0).empty());
+}
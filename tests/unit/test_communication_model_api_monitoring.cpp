@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationStatusMonitor.h"
+#include <memory>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+/**
+ * @brief CommunicationModelAPI实时监控测试类
+ */
+class CommunicationModelAPIMonitoringTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+        api->setDistance(1.0);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 等待监控历史达到指定条数
+     */
+    bool waitForHistory(size_t count) const {
+        for (int attempt = 0; attempt < 2000; ++attempt) {
+            if (api->getStatusHistory(static_cast<int>(count)).size() >= count) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+
+    static bool sameMetrics(const CommunicationLinkMetrics& a, const CommunicationLinkMetrics& b) {
+        return a.signalStrength == b.signalStrength && a.signalToNoiseRatio == b.signalToNoiseRatio &&
+               a.bitErrorRate == b.bitErrorRate && a.throughput == b.throughput && a.latency == b.latency &&
+               a.packetLossRate == b.packetLossRate && a.quality == b.quality && a.isConnected == b.isConnected;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试启动、停止与状态查询
+ */
+TEST_F(CommunicationModelAPIMonitoringTest, StartStopLifecycle) {
+    EXPECT_FALSE(api->isMonitoring());
+    EXPECT_FALSE(api->stopRealTimeMonitoring());
+    EXPECT_TRUE(api->getStatusHistory().empty());
+    EXPECT_FALSE(api->startRealTimeMonitoring(0));
+
+    ASSERT_TRUE(api->startRealTimeMonitoring(2));
+    EXPECT_TRUE(api->isMonitoring());
+    EXPECT_FALSE(api->startRealTimeMonitoring(2));
+    ASSERT_TRUE(waitForHistory(5));
+
+    CommunicationLinkStatus expected = api->calculateLinkStatus();
+    CommunicationLinkStatus current = api->getCurrentStatus();
+    EXPECT_FLOAT_EQ(static_cast<float>(current.signalToNoiseRatio), static_cast<float>(expected.signalToNoiseRatio));
+    EXPECT_EQ(current.isConnected, expected.isConnected);
+    EXPECT_FALSE(current.statusDescription.empty());
+
+    EXPECT_TRUE(api->stopRealTimeMonitoring());
+    EXPECT_FALSE(api->isMonitoring());
+
+    // 停止后历史记录保留
+    auto history = api->getStatusHistory(3);
+    ASSERT_EQ(history.size(), 3u);
+    for (const auto& status : history) {
+        EXPECT_FLOAT_EQ(static_cast<float>(status.signalStrength), static_cast<float>(expected.signalStrength));
+    }
+}
+
+/**
+ * @brief 测试参数修改在后续采样中生效，历史记录按时间排列
+ */
+TEST_F(CommunicationModelAPIMonitoringTest, HistoryTracksParameterChanges) {
+    CommunicationLinkMetrics nearMetrics = api->calculateLinkMetrics();
+    ASSERT_TRUE(api->startRealTimeMonitoring(1));
+    ASSERT_TRUE(waitForHistory(3));
+
+    api->setDistance(20.0);
+    CommunicationLinkMetrics farMetrics = api->calculateLinkMetrics();
+    uint64_t before = 0;
+    {
+        std::vector<CommunicationStatusRecord> records(1024);
+        before = api->getStatusHistory(records.data(), records.size());
+    }
+    ASSERT_TRUE(waitForHistory(before + 3));
+    api->stopRealTimeMonitoring();
+
+    std::vector<CommunicationStatusRecord> records(1024);
+    size_t count = api->getStatusHistory(records.data(), records.size());
+    ASSERT_GE(count, before + 3);
+    EXPECT_TRUE(sameMetrics(records[0].metrics, nearMetrics));
+    EXPECT_TRUE(sameMetrics(records[count - 1].metrics, farMetrics));
+
+    bool switched = false;
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) {
+            EXPECT_GT(records[i].timestamp, records[i - 1].timestamp);
+        }
+        if (sameMetrics(records[i].metrics, farMetrics)) {
+            switched = true;
+        } else {
+            EXPECT_FALSE(switched);
+            EXPECT_TRUE(sameMetrics(records[i].metrics, nearMetrics));
+        }
+    }
+    EXPECT_EQ(api->getCurrentStatus().signalToNoiseRatio, api->calculateLinkStatus().signalToNoiseRatio);
+}
+
+/**
+ * @brief 测试环形缓冲区回绕时并发读取不会得到损坏的记录
+ */
+TEST_F(CommunicationModelAPIMonitoringTest, ConcurrentReadersSeeConsistentRecords) {
+    CommunicationStatusMonitor monitor(6);
+    EXPECT_EQ(monitor.getCapacity(), 8u);
+    EXPECT_THROW(CommunicationStatusMonitor(0), std::invalid_argument);
+
+    CommunicationLinkMetrics a = api->calculateLinkMetrics();
+    api->setDistance(30.0);
+    CommunicationLinkMetrics b = api->calculateLinkMetrics();
+
+    monitor.publish([a]() { return a; });
+    ASSERT_TRUE(monitor.start(1));
+
+    std::atomic<bool> done(false);
+    std::atomic<size_t> invalid(0);
+    std::atomic<size_t> reads(0);
+    std::thread reader([&]() {
+        CommunicationStatusRecord records[8];
+        while (!done.load()) {
+            size_t count = monitor.getHistory(records, 8);
+            for (size_t i = 0; i < count; ++i) {
+                if (!sameMetrics(records[i].metrics, a) && !sameMetrics(records[i].metrics, b)) ++invalid;
+                if (i > 0 && !(records[i].timestamp > records[i - 1].timestamp)) ++invalid;
+            }
+            ++reads;
+        }
+    });
+
+    for (int round = 0; round < 40; ++round) {
+        const CommunicationLinkMetrics next = round % 2 ? a : b;
+        monitor.publish([next]() { return next; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    done.store(true);
+    reader.join();
+    EXPECT_TRUE(monitor.stop());
+
+    EXPECT_EQ(invalid.load(), 0u);
+    EXPECT_GT(reads.load(), 0u);
+    EXPECT_GT(monitor.getRecordCount(), 8u);
+
+    CommunicationStatusRecord latest;
+    ASSERT_TRUE(monitor.getLatest(latest));
+    EXPECT_EQ(monitor.getHistory(nullptr, 4), 0u);
+}
+
+/**
+ * @brief 测试监控线程在每个采样时刻重新调用采样函数
+ */
+TEST_F(CommunicationModelAPIMonitoringTest, SamplerEvaluatedEachTick) {
+    CommunicationStatusMonitor monitor(64);
+    std::atomic<int> calls(0);
+    const CommunicationLinkMetrics base = api->calculateLinkMetrics();
+    monitor.publish([&calls, base]() {
+        CommunicationLinkMetrics metrics = base;
+        metrics.signalStrength = static_cast<double>(++calls);
+        return metrics;
+    });
+    ASSERT_TRUE(monitor.start(1));
+    while (monitor.getRecordCount() < 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(monitor.stop());
+
+    CommunicationStatusRecord records[5];
+    ASSERT_EQ(monitor.getHistory(records, 5), 5u);
+    for (size_t i = 1; i < 5; ++i) {
+        EXPECT_DOUBLE_EQ(records[i].metrics.signalStrength, records[i - 1].metrics.signalStrength + 1.0);
+    }
+    EXPECT_EQ(static_cast<uint64_t>(calls.load()), monitor.getRecordCount());
+
+    monitor.publish(nullptr);
+    const uint64_t recorded = monitor.getRecordCount();
+    ASSERT_TRUE(monitor.start(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_TRUE(monitor.stop());
+    EXPECT_EQ(monitor.getRecordCount(), recorded);
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationModelUtils.h"
+#include "CommunicationNetworkAnalyzer.h"
+#include "CommunicationRandomStream.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief CommunicationModelAPI蒙特卡洛可用性分析测试类
+ */
+class CommunicationModelAPIMonteCarloTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 5.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    static CommunicationMonteCarloConfig makeConfig(uint64_t trials) {
+        CommunicationMonteCarloConfig config;
+        config.trialCount = trials;
+        config.shadowing = true;
+        config.rayleighFading = false;
+        config.jammerPowerStdDev = 0.0;
+        config.jammerDistanceStdDev = 0.0;
+        config.confidence = 0.95;
+        return config;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试累加器与两遍算法及分组合并的一致性
+ */
+TEST_F(CommunicationModelAPIMonteCarloTest, RunningStatisticsMatchTwoPass) {
+    CommunicationRandomStream stream(7, RandomStreamId::CHANNEL_SHADOWING);
+    std::vector<double> values;
+    CommunicationRunningStatistics all;
+    CommunicationRunningStatistics left;
+    CommunicationRunningStatistics right;
+    for (uint64_t i = 0; i < 10000; ++i) {
+        double value = 1e6 + 3.0 * stream.normal(i);
+        values.push_back(value);
+        all.add(value);
+        (i < 3000 ? left : right).add(value);
+    }
+    left.merge(right);
+
+    double mean = CommunicationModelUtils::calculateMean(values);
+    double stdDev = CommunicationModelUtils::calculateStandardDeviation(values);
+    EXPECT_NEAR(all.getMean(), mean, 1e-9);
+    EXPECT_NEAR(all.getStandardDeviation(), stdDev, 1e-9);
+    EXPECT_NEAR(left.getMean(), mean, 1e-9);
+    EXPECT_NEAR(left.getStandardDeviation(), stdDev, 1e-9);
+    EXPECT_EQ(left.getCount(), 10000u);
+    EXPECT_EQ(left.getMinimum(), all.getMinimum());
+    EXPECT_EQ(left.getMaximum(), all.getMaximum());
+
+    // 档位含下边界：置信度恰为0.95时取1.96
+    auto interval = all.getConfidenceInterval(0.95);
+    EXPECT_NEAR(interval.second - all.getMean(), 1.96 * stdDev / 100.0, 1e-9);
+    EXPECT_NEAR(all.getMean() - interval.first, 1.96 * stdDev / 100.0, 1e-9);
+    EXPECT_DOUBLE_EQ(CommunicationRunningStatistics::calculateCriticalValue(0.99), 2.58);
+    EXPECT_DOUBLE_EQ(CommunicationRunningStatistics::calculateCriticalValue(0.90), 1.64);
+    EXPECT_DOUBLE_EQ(CommunicationRunningStatistics::calculateCriticalValue(0.85), 1.28);
+}
+
+/**
+ * @brief 测试无随机扰动时退化为确定性结果
+ */
+TEST_F(CommunicationModelAPIMonteCarloTest, DeterministicWithoutRandomness) {
+    CommunicationMonteCarloConfig config = makeConfig(1000);
+    config.shadowing = false;
+    CommunicationMonteCarloResult result;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(config, result));
+
+    CommunicationLinkStatus status = api->calculateLinkStatus();
+    EXPECT_EQ(result.trialCount, 1000u);
+    EXPECT_NEAR(result.snr.getMean(), status.signalToNoiseRatio, 1e-9);
+    EXPECT_NEAR(result.snr.getStandardDeviation(), 0.0, 1e-9);
+    EXPECT_NEAR(result.availability.getMean(), api->calculatePerformance().availability, 1e-12);
+    EXPECT_DOUBLE_EQ(result.getOutageProbability(), status.isConnected ? 0.0 : 1.0);
+}
+
+/**
+ * @brief 测试阴影衰落下的信噪比分布与中断概率的解析值一致
+ */
+TEST_F(CommunicationModelAPIMonteCarloTest, ShadowingOutageMatchesAnalytic) {
+    api->setDistance(1.0);
+    CommunicationMonteCarloResult result;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(makeConfig(200000), result));
+
+    double baseSnr = api->calculateLinkStatus().signalToNoiseRatio;
+    EXPECT_NEAR(result.snr.getMean(), baseSnr, 0.1);
+    EXPECT_NEAR(result.snr.getStandardDeviation(), 8.0, 0.1);
+
+    // 信噪比低于最小连接信噪比即中断：P = Φ((门限 - 基准信噪比) / σ)
+    double threshold = CommunicationNetworkAnalyzer::calculateMinimumConnectedSnr(20.0);
+    double expected = 0.5 * std::erfc(-(threshold - baseSnr) / (8.0 * std::sqrt(2.0)));
+    ASSERT_GT(expected, 0.01);
+    ASSERT_LT(expected, 0.99);
+    auto interval = result.outage.getConfidenceInterval(0.99);
+    EXPECT_NEAR(result.getOutageProbability(), expected, 0.01);
+    EXPECT_LT(interval.first, expected);
+    EXPECT_GT(interval.second, expected);
+}
+
+/**
+ * @brief 测试瑞利衰落与干扰扰动降低平均信噪比，结果与线程数无关
+ */
+TEST_F(CommunicationModelAPIMonteCarloTest, FadingAndJammerPerturbationAcrossThreads) {
+    api->setScenario(CommunicationScenario::JAMMED_COMMUNICATION);
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.isJammed = true;
+    jamming.jammerPower = 0.0;
+    jamming.jammerFrequency = 2400.0;
+    jamming.jammerDistance = 20.0;
+    api->setJammingEnvironment(jamming);
+
+    CommunicationMonteCarloConfig config = makeConfig(50000);
+    config.shadowing = false;
+    config.rayleighFading = true;
+    CommunicationMonteCarloResult fading;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(config, fading));
+
+    // 瑞利衰落的平均dB损耗为欧拉常数 * 10 / ln10 ≈ 2.507dB
+    double baseSnr = api->calculateLinkStatus().signalToNoiseRatio;
+    EXPECT_NEAR(baseSnr - fading.snr.getMean(), 2.507, 0.1);
+
+    config.jammerPowerStdDev = 3.0;
+    config.jammerDistanceStdDev = 2.0;
+    api->setThreadCount(1);
+    CommunicationMonteCarloResult serial;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(config, serial));
+    api->setThreadCount(4);
+    CommunicationMonteCarloResult parallel;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(config, parallel));
+
+    EXPECT_GT(serial.snr.getStandardDeviation(), fading.snr.getStandardDeviation());
+    EXPECT_EQ(serial.snr.getMean(), parallel.snr.getMean());
+    EXPECT_EQ(serial.snr.getVariance(), parallel.snr.getVariance());
+    EXPECT_EQ(serial.availability.getMean(), parallel.availability.getMean());
+    EXPECT_EQ(serial.outage.getMean(), parallel.outage.getMean());
+}
+
+/**
+ * @brief 测试以UINT64_MAX为上限续跑时一次运行到结束，结果与一次执行一致
+ */
+TEST_F(CommunicationModelAPIMonteCarloTest, ResumeWithUnboundedTrialLimit) {
+    const CommunicationMonteCarloConfig config = makeConfig(20000);
+    CommunicationMonteCarloResult expected;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(config, expected));
+
+    CommunicationMonteCarloProgress progress;
+    progress.config = config;
+    progress.completedTrials = 0;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(progress, 4096));
+    ASSERT_FALSE(progress.isComplete());
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(progress, std::numeric_limits<uint64_t>::max()));
+    EXPECT_TRUE(progress.isComplete());
+    EXPECT_EQ(progress.result.trialCount, expected.trialCount);
+    EXPECT_EQ(progress.result.snr.getMean(), expected.snr.getMean());
+    EXPECT_EQ(progress.result.getOutageProbability(), expected.getOutageProbability());
+}
+
+/**
+ * @brief 测试无效配置
+ */
+TEST_F(CommunicationModelAPIMonteCarloTest, InvalidConfig) {
+    CommunicationMonteCarloResult result;
+    CommunicationMonteCarloConfig config = makeConfig(1);
+    EXPECT_FALSE(api->analyzeAvailabilityMonteCarlo(config, result));
+    config = makeConfig(100);
+    config.confidence = 1.0;
+    EXPECT_FALSE(api->analyzeAvailabilityMonteCarlo(config, result));
+    config = makeConfig(100);
+    config.jammerPowerStdDev = -1.0;
+    EXPECT_FALSE(api->analyzeAvailabilityMonteCarlo(config, result));
+    config = makeConfig(100);
+    config.jammerDistanceStdDev = std::nan("");
+    EXPECT_FALSE(api->analyzeAvailabilityMonteCarlo(config, result));
+}
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationVectorMath.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <functional>
+
+/**
+ * @brief CommunicationModelAPI网络拓扑分析测试类
+ */
+class CommunicationModelAPINetworkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::JAMMED_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 在[0, extent]²内生成随机节点
+     */
+    static std::vector<std::pair<double, double>> makeNodes(size_t count, double extent, unsigned int seed) {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<double> coordinate(0.0, extent);
+        std::vector<std::pair<double, double>> nodes(count);
+        for (auto& node : nodes) {
+            node.first = coordinate(generator);
+            node.second = coordinate(generator);
+        }
+        return nodes;
+    }
+
+    /**
+     * @brief 通过setDistance计算参考信噪比
+     */
+    double referenceSnr(double distance) {
+        CommunicationEnvironment original = api->getEnvironment();
+        api->setDistance(distance);
+        double snr = api->calculateLinkStatus().signalToNoiseRatio;
+        api->setEnvironment(original);
+        return snr;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试向量化log10精度
+ */
+TEST_F(CommunicationModelAPINetworkTest, VectorizedLog10MatchesStd) {
+    std::vector<double> inputs = {1.0, 2.0, 10.0, 0.5, 1e-300, 1e300, 0.70710678, 1.41421356,
+                                  1.41421357, 3.0e-7, 123456.789};
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> exponent(-30.0, 30.0);
+    for (int i = 0; i < 1000; ++i) {
+        inputs.push_back(std::pow(10.0, exponent(generator)));
+    }
+
+    std::vector<double> outputs(inputs.size());
+    CommunicationVectorMath::log10Batch(inputs.data(), outputs.data(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_NEAR(outputs[i], std::log10(inputs[i]), 1e-12) << "x = " << inputs[i];
+    }
+}
+
+/**
+ * @brief 测试链路矩阵与逐链路计算一致
+ */
+TEST_F(CommunicationModelAPINetworkTest, LinkMatrixMatchesLinkStatus) {
+    // 节点数跨越多个分块，覆盖对角分块、非对角分块和尾部不完整分块
+    auto nodes = makeNodes(150, 30.0, 42);
+    CommunicationLinkMatrix matrix;
+    ASSERT_TRUE(api->calculateLinkMatrix(nodes, matrix));
+    ASSERT_EQ(matrix.nodeCount, nodes.size());
+    ASSERT_EQ(matrix.values.size(), nodes.size() * nodes.size());
+
+    for (size_t i = 0; i < nodes.size(); i += 13) {
+        for (size_t j = 0; j < nodes.size(); j += 7) {
+            if (i == j) continue;
+            double distance = std::hypot(nodes[i].first - nodes[j].first, nodes[i].second - nodes[j].second);
+            EXPECT_NEAR(matrix.at(i, j), referenceSnr(distance), 1e-3);
+        }
+    }
+}
+
+/**
+ * @brief 测试链路矩阵对称性、对角线与重合节点
+ */
+TEST_F(CommunicationModelAPINetworkTest, LinkMatrixSymmetry) {
+    auto nodes = makeNodes(100, 10.0, 3);
+    nodes[70] = nodes[5];
+
+    CommunicationLinkMatrix matrix;
+    ASSERT_TRUE(api->calculateLinkMatrix(nodes, matrix));
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        EXPECT_EQ(matrix.at(i, i), 0.0f);
+        for (size_t j = i + 1; j < nodes.size(); ++j) {
+            ASSERT_EQ(matrix.at(i, j), matrix.at(j, i));
+        }
+    }
+    EXPECT_TRUE(std::isfinite(matrix.at(5, 70)));
+    EXPECT_GT(matrix.at(5, 70), matrix.at(5, 6));
+}
+
+/**
+ * @brief 测试线程数不影响链路矩阵，且兼容嵌套数组接口
+ */
+TEST_F(CommunicationModelAPINetworkTest, LinkMatrixIndependentOfThreadCount) {
+    auto nodes = makeNodes(300, 50.0, 11);
+
+    api->setThreadCount(1);
+    CommunicationLinkMatrix serial;
+    ASSERT_TRUE(api->calculateLinkMatrix(nodes, serial));
+
+    api->setThreadCount(4);
+    CommunicationLinkMatrix parallel;
+    ASSERT_TRUE(api->calculateLinkMatrix(nodes, parallel));
+    EXPECT_EQ(serial.values, parallel.values);
+
+    auto nested = api->calculateLinkMatrix(nodes);
+    ASSERT_EQ(nested.size(), nodes.size());
+    for (size_t i = 0; i < nodes.size(); i += 17) {
+        ASSERT_EQ(nested[i].size(), nodes.size());
+        for (size_t j = 0; j < nodes.size(); j += 19) {
+            EXPECT_EQ(nested[i][j], static_cast<double>(serial.at(i, j)));
+        }
+    }
+
+    CommunicationLinkMatrix empty;
+    ASSERT_TRUE(api->calculateLinkMatrix({}, empty));
+    EXPECT_EQ(empty.nodeCount, 0u);
+    EXPECT_TRUE(empty.values.empty());
+}
+
+/**
+ * @brief 测试单跳最大连接距离与链路连接状态一致
+ */
+TEST_F(CommunicationModelAPINetworkTest, ConnectivityLinkRange) {
+    CommunicationNetworkConnectivity result;
+    ASSERT_TRUE(api->analyzeNetworkConnectivity({{0.0, 0.0}}, result));
+    double range = result.linkRange;
+    ASSERT_GT(range, 0.0);
+
+    CommunicationEnvironment original = api->getEnvironment();
+    ASSERT_TRUE(api->setDistance(range * 0.999));
+    EXPECT_TRUE(api->calculateLinkStatus().isConnected);
+    ASSERT_TRUE(api->setDistance(range * 1.001));
+    EXPECT_FALSE(api->calculateLinkStatus().isConnected);
+    api->setEnvironment(original);
+}
+
+/**
+ * @brief 测试网格连通性分析与逐对检查结果一致
+ */
+TEST_F(CommunicationModelAPINetworkTest, ConnectivityMatchesBruteForce) {
+    CommunicationNetworkConnectivity probe;
+    ASSERT_TRUE(api->analyzeNetworkConnectivity({{0.0, 0.0}}, probe));
+    const double range = probe.linkRange;
+
+    for (double extentFactor : {2.0, 6.0, 15.0}) {
+        auto nodes = makeNodes(400, range * extentFactor, 5);
+        // 加入重合节点和间距略小于R的节点对
+        nodes[10] = nodes[3];
+        nodes[11] = std::make_pair(nodes[4].first + range * (1.0 - 1e-9), nodes[4].second);
+
+        CommunicationNetworkConnectivity result;
+        ASSERT_TRUE(api->analyzeNetworkConnectivity(nodes, result));
+        ASSERT_EQ(result.componentLabels.size(), nodes.size());
+
+        // 逐对检查并以首次出现顺序编号
+        std::vector<int> parent(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) parent[i] = static_cast<int>(i);
+        std::function<int(int)> find = [&](int x) { return parent[x] == x ? x : parent[x] = find(parent[x]); };
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            for (size_t j = i + 1; j < nodes.size(); ++j) {
+                double dx = nodes[i].first - nodes[j].first;
+                double dy = nodes[i].second - nodes[j].second;
+                if (dx * dx + dy * dy <= range * range) {
+                    parent[find(static_cast<int>(i))] = find(static_cast<int>(j));
+                }
+            }
+        }
+        std::vector<int> rootLabel(nodes.size(), -1);
+        std::vector<int> expected(nodes.size());
+        std::vector<size_t> sizes;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            int root = find(static_cast<int>(i));
+            if (rootLabel[root] < 0) {
+                rootLabel[root] = static_cast<int>(sizes.size());
+                sizes.push_back(0);
+            }
+            expected[i] = rootLabel[root];
+            ++sizes[expected[i]];
+        }
+
+        EXPECT_EQ(result.componentLabels, expected) << "extent factor " << extentFactor;
+        EXPECT_EQ(result.componentCount, sizes.size());
+        EXPECT_EQ(result.componentLabels[10], result.componentLabels[3]);
+        EXPECT_EQ(result.componentLabels[11], result.componentLabels[4]);
+
+        double reachable = 0.0;
+        for (size_t size : sizes) reachable += static_cast<double>(size) * (size - 1);
+        EXPECT_NEAR(result.connectivity, reachable / (400.0 * 399.0), 1e-12);
+        EXPECT_DOUBLE_EQ(api->calculateNetworkConnectivity(nodes), result.connectivity);
+    }
+}
+
+/**
+ * @brief 测试连通性分析边界情况
+ */
+TEST_F(CommunicationModelAPINetworkTest, ConnectivityEdgeCases) {
+    CommunicationNetworkConnectivity result;
+    ASSERT_TRUE(api->analyzeNetworkConnectivity({}, result));
+    EXPECT_EQ(result.componentCount, 0u);
+    EXPECT_DOUBLE_EQ(result.connectivity, 0.0);
+
+    ASSERT_TRUE(api->analyzeNetworkConnectivity({{1.0, 1.0}}, result));
+    EXPECT_EQ(result.componentCount, 1u);
+    EXPECT_DOUBLE_EQ(result.connectivity, 1.0);
+
+    // 全部节点在R以内
+    double range = result.linkRange;
+    ASSERT_TRUE(api->analyzeNetworkConnectivity(makeNodes(50, range * 0.5, 9), result));
+    EXPECT_EQ(result.componentCount, 1u);
+    EXPECT_EQ(result.largestComponentSize, 50u);
+    EXPECT_DOUBLE_EQ(result.connectivity, 1.0);
+
+    // 两个相距很远的簇
+    std::vector<std::pair<double, double>> nodes = {{0.0, 0.0}, {0.0, 0.0}, {range * 100.0, 0.0}};
+    ASSERT_TRUE(api->analyzeNetworkConnectivity(nodes, result));
+    EXPECT_EQ(result.componentCount, 2u);
+    EXPECT_EQ(result.largestComponentSize, 2u);
+    EXPECT_NEAR(result.connectivity, 2.0 / 6.0, 1e-12);
+}
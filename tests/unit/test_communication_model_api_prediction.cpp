@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationLinkPredictor.h"
+#include "CommunicationRandomStream.h"
+#include <memory>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cmath>
+
+/**
+ * @brief CommunicationModelAPI链路预测测试类
+ */
+class CommunicationModelAPIPredictionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 等待监控历史达到指定条数
+     */
+    bool waitForHistory(size_t count) const {
+        for (int attempt = 0; attempt < 2000; ++attempt) {
+            if (api->getStatusHistory(static_cast<int>(count)).size() >= count) return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试线性变化的指标可被准确外推
+ */
+TEST_F(CommunicationModelAPIPredictionTest, LinearTrendExtrapolation) {
+    CommunicationLinkPredictor predictor;
+    for (int i = 0; i < 200; ++i) {
+        double t = 0.1 * i;
+        ASSERT_TRUE(predictor.update(0, t, -60.0 - 0.5 * t, 30.0 - 0.8 * t));
+    }
+
+    double signalStrength = 0.0;
+    double snr = 0.0;
+    ASSERT_TRUE(predictor.predict(0, 2.0, signalStrength, snr));
+    // 最后一个样本在19.9s，外推至21.9s
+    EXPECT_NEAR(signalStrength, -60.0 - 0.5 * 21.9, 0.05);
+    EXPECT_NEAR(snr, 30.0 - 0.8 * 21.9, 0.05);
+    EXPECT_GT(predictor.getPredictionStandardDeviation(0, 2.0), predictor.getPredictionStandardDeviation(0, 0.0));
+}
+
+/**
+ * @brief 测试平稳指标上的量测噪声被平滑
+ */
+TEST_F(CommunicationModelAPIPredictionTest, SmoothsMeasurementNoise) {
+    CommunicationLinkPredictor predictor;
+    CommunicationRandomStream random(7, RandomStreamId::CHANNEL_SHADOWING);
+    double rawSquaredError = 0.0;
+    double filteredSquaredError = 0.0;
+    int counted = 0;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        double noise = random.normal(i);
+        ASSERT_TRUE(predictor.update(0, 0.1 * static_cast<double>(i), -70.0 + noise, 20.0 + noise));
+        if (i < 100) continue;
+        double signalStrength = 0.0;
+        double snr = 0.0;
+        ASSERT_TRUE(predictor.predict(0, 0.0, signalStrength, snr));
+        rawSquaredError += noise * noise;
+        filteredSquaredError += (snr - 20.0) * (snr - 20.0);
+        ++counted;
+    }
+    ASSERT_GT(counted, 0);
+    EXPECT_LT(filteredSquaredError, 0.25 * rawSquaredError);
+}
+
+/**
+ * @brief 测试批量更新与逐条更新一致，以及无效输入
+ */
+TEST_F(CommunicationModelAPIPredictionTest, BatchMatchesPerLinkAndRejectsInvalidInput) {
+    const size_t links = 37;
+    CommunicationLinkPredictor batch(links);
+    CommunicationLinkPredictor single(links);
+    std::vector<double> timestamps(links), signals(links), snrs(links);
+    for (int step = 0; step < 20; ++step) {
+        for (size_t link = 0; link < links; ++link) {
+            timestamps[link] = 0.05 * step + 0.001 * static_cast<double>(link);
+            signals[link] = -50.0 - static_cast<double>(link) - 0.3 * step;
+            snrs[link] = 10.0 + std::sin(0.2 * step + static_cast<double>(link));
+            ASSERT_TRUE(single.update(link, timestamps[link], signals[link], snrs[link]));
+        }
+        EXPECT_EQ(batch.updateBatch(timestamps.data(), signals.data(), snrs.data(), links), links);
+    }
+
+    std::vector<double> predictedSignals(links), predictedSnrs(links);
+    ASSERT_TRUE(batch.predictBatch(0.5, predictedSignals.data(), predictedSnrs.data()));
+    for (size_t link = 0; link < links; ++link) {
+        double signalStrength = 0.0;
+        double snr = 0.0;
+        ASSERT_TRUE(single.predict(link, 0.5, signalStrength, snr));
+        EXPECT_EQ(predictedSignals[link], signalStrength);
+        EXPECT_EQ(predictedSnrs[link], snr);
+    }
+
+    double signalStrength = 0.0;
+    double snr = 0.0;
+    EXPECT_FALSE(single.update(0, 0.0, -50.0, 10.0));
+    EXPECT_FALSE(single.update(links, 10.0, -50.0, 10.0));
+    EXPECT_FALSE(single.update(0, 10.0, NAN, 10.0));
+    EXPECT_FALSE(single.predict(0, -1.0, signalStrength, snr));
+    single.reset(0);
+    EXPECT_FALSE(single.hasEstimate(0));
+    EXPECT_FALSE(single.predict(0, 1.0, signalStrength, snr));
+    ASSERT_TRUE(single.predictBatch(1.0, predictedSignals.data(), predictedSnrs.data()));
+    EXPECT_TRUE(std::isnan(predictedSignals[0]));
+    EXPECT_FALSE(std::isnan(predictedSignals[1]));
+
+    EXPECT_THROW(CommunicationLinkPredictor(0), std::invalid_argument);
+    EXPECT_THROW(CommunicationLinkPredictor(1, 0.0, 1.0), std::invalid_argument);
+    EXPECT_THROW(CommunicationLinkPredictor(1, 0.1, NAN), std::invalid_argument);
+}
+
+/**
+ * @brief 测试API由监控历史预测，无历史时返回当前状态
+ */
+TEST_F(CommunicationModelAPIPredictionTest, PredictsFromMonitoringHistory) {
+    CommunicationLinkStatus current = api->calculateLinkStatus();
+    CommunicationLinkStatus predicted = api->predictFutureStatus(10.0);
+    EXPECT_DOUBLE_EQ(predicted.signalToNoiseRatio, current.signalToNoiseRatio);
+
+    ASSERT_TRUE(api->startRealTimeMonitoring(1));
+    ASSERT_TRUE(waitForHistory(5));
+    predicted = api->predictFutureStatus(10.0);
+    // 监控记录以单精度保存指标
+    EXPECT_NEAR(predicted.signalStrength, current.signalStrength, 1e-4);
+    EXPECT_NEAR(predicted.signalToNoiseRatio, current.signalToNoiseRatio, 1e-4);
+    EXPECT_NEAR(predicted.throughput, current.throughput, 1e-4 * current.throughput);
+    EXPECT_EQ(predicted.isConnected, current.isConnected);
+    EXPECT_FALSE(predicted.statusDescription.empty());
+
+    // 链路变差后预测值向新状态移动
+    api->setDistance(20.0);
+    CommunicationLinkStatus far = api->calculateLinkStatus();
+    std::vector<CommunicationStatusRecord> records(1024);
+    size_t before = api->getStatusHistory(records.data(), records.size());
+    ASSERT_TRUE(waitForHistory(before + 20));
+    api->stopRealTimeMonitoring();
+    predicted = api->predictFutureStatus(0.0);
+    EXPECT_LT(predicted.signalToNoiseRatio, current.signalToNoiseRatio);
+    EXPECT_LT(std::abs(predicted.signalToNoiseRatio - far.signalToNoiseRatio),
+              std::abs(current.signalToNoiseRatio - far.signalToNoiseRatio));
+
+    EXPECT_DOUBLE_EQ(api->predictFutureStatus(-1.0).signalToNoiseRatio, far.signalToNoiseRatio);
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationModelUtils.h"
+#include "CommunicationRandomStream.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief 分位数估计测试类
+ */
+class CommunicationModelAPIQuantileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 按排序定义计算参考百分位数
+     */
+    static double sortedPercentile(std::vector<double> values, double percentile) {
+        std::sort(values.begin(), values.end());
+        double index = percentile / 100.0 * (values.size() - 1);
+        size_t lower = static_cast<size_t>(std::floor(index));
+        size_t upper = std::min(lower + 1, values.size() - 1);
+        double weight = index - lower;
+        return values[lower] * (1.0 - weight) + values[upper] * weight;
+    }
+
+    static std::vector<double> normalSamples(size_t count, uint64_t seed) {
+        CommunicationRandomStream stream(seed, RandomStreamId::CHANNEL_SHADOWING);
+        std::vector<double> values(count);
+        for (size_t i = 0; i < count; ++i) values[i] = stream.normal(i);
+        return values;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试精确路径与排序定义一致，多百分位查询与单次查询一致
+ */
+TEST_F(CommunicationModelAPIQuantileTest, ExactPercentilesMatchSortDefinition) {
+    std::vector<double> values = normalSamples(1001, 3);
+    values.push_back(values[10]);   // 含重复值
+    std::vector<double> percentiles = {99.0, 0.0, 50.0, 12.5, 100.0, 50.0, 0.1, 75.3};
+
+    std::vector<double> batch = CommunicationModelUtils::calculatePercentiles(values, percentiles);
+    ASSERT_EQ(batch.size(), percentiles.size());
+    for (size_t i = 0; i < percentiles.size(); ++i) {
+        double reference = sortedPercentile(values, percentiles[i]);
+        EXPECT_DOUBLE_EQ(CommunicationModelUtils::calculatePercentile(values, percentiles[i]), reference);
+        EXPECT_DOUBLE_EQ(batch[i], reference);
+    }
+
+    EXPECT_DOUBLE_EQ(CommunicationModelUtils::calculatePercentile({5.0}, 30.0), 5.0);
+    EXPECT_DOUBLE_EQ(CommunicationModelUtils::calculatePercentile({1.0, 3.0}, 25.0), 1.5);
+    EXPECT_DOUBLE_EQ(CommunicationModelUtils::calculatePercentile({}, 50.0), 0.0);
+    EXPECT_TRUE(CommunicationModelUtils::calculatePercentiles(values, {}).empty());
+}
+
+/**
+ * @brief 测试非有限百分位数：NaN对应的结果为NaN且不影响其余结果，无穷大截断到端点
+ */
+TEST_F(CommunicationModelAPIQuantileTest, NonFinitePercentiles) {
+    std::vector<double> values = normalSamples(501, 5);
+    CommunicationQuantileSketch sketch;
+    for (double value : values) sketch.add(value);
+
+    const double nan = std::nan("");
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> percentiles = {75.0, nan, 10.0, inf, nan, -inf, 50.0};
+
+    std::vector<double> exact = CommunicationModelUtils::calculatePercentiles(values, percentiles);
+    std::vector<double> estimated(percentiles.size());
+    sketch.getPercentiles(percentiles.data(), percentiles.size(), estimated.data());
+    ASSERT_EQ(exact.size(), percentiles.size());
+    for (size_t i = 0; i < percentiles.size(); ++i) {
+        if (std::isnan(percentiles[i])) {
+            EXPECT_TRUE(std::isnan(exact[i]));
+            EXPECT_TRUE(std::isnan(estimated[i]));
+            continue;
+        }
+        double clamped = std::min(100.0, std::max(0.0, percentiles[i]));
+        EXPECT_DOUBLE_EQ(exact[i], sortedPercentile(values, clamped)) << "percentile " << percentiles[i];
+        EXPECT_EQ(estimated[i], sketch.getPercentile(clamped)) << "percentile " << percentiles[i];
+    }
+    EXPECT_TRUE(std::isnan(CommunicationModelUtils::calculatePercentile(values, nan)));
+    EXPECT_TRUE(std::isnan(sketch.getPercentile(nan)));
+}
+
+/**
+ * @brief 测试少量样本时草图与精确值一致，大量样本时误差很小且尾部更精确
+ */
+TEST_F(CommunicationModelAPIQuantileTest, SketchApproximatesExactPercentiles) {
+    CommunicationQuantileSketch small;
+    std::vector<double> few = {4.0, -1.0, 2.5, 7.0, 0.5, 3.0};
+    for (double value : few) small.add(value);
+    for (double p : {0.0, 10.0, 33.0, 50.0, 90.0, 100.0}) {
+        EXPECT_NEAR(small.getPercentile(p), sortedPercentile(few, p), 1e-12);
+    }
+
+    std::vector<double> values = normalSamples(200000, 11);
+    CommunicationQuantileSketch sketch;
+    for (double value : values) sketch.add(value);
+    sketch.compress();
+
+    EXPECT_EQ(sketch.getCount(), values.size());
+    EXPECT_LE(sketch.getCentroidCount(), 2 * static_cast<size_t>(MathConstants::QUANTILE_SKETCH_DEFAULT_COMPRESSION));
+    EXPECT_EQ(sketch.getPercentile(0.0), *std::min_element(values.begin(), values.end()));
+    EXPECT_EQ(sketch.getPercentile(100.0), *std::max_element(values.begin(), values.end()));
+
+    std::vector<double> percentiles = {0.1, 1.0, 5.0, 25.0, 50.0, 75.0, 95.0, 99.0, 99.9};
+    std::vector<double> exact = CommunicationModelUtils::calculatePercentiles(values, percentiles);
+    std::vector<double> estimated(percentiles.size());
+    sketch.getPercentiles(percentiles.data(), percentiles.size(), estimated.data());
+    for (size_t i = 0; i < percentiles.size(); ++i) {
+        // 千分之一尾部仅约200个样本且落在首末质心内，放宽容差
+        double tolerance = (percentiles[i] < 1.0 || percentiles[i] > 99.0) ? 0.06 : 0.02;
+        EXPECT_NEAR(estimated[i], exact[i], tolerance) << "percentile " << percentiles[i];
+        EXPECT_EQ(estimated[i], sketch.getPercentile(percentiles[i]));
+    }
+}
+
+/**
+ * @brief 测试分组累加后合并与整体累加结果接近，且不受缓冲区状态影响
+ */
+TEST_F(CommunicationModelAPIQuantileTest, MergedSketchesMatchSingleSketch) {
+    std::vector<double> values = normalSamples(50000, 5);
+    CommunicationQuantileSketch whole;
+    CommunicationQuantileSketch parts[4];
+    for (size_t i = 0; i < values.size(); ++i) {
+        whole.add(values[i]);
+        parts[i % 4].add(values[i]);
+    }
+    for (int i = 1; i < 4; ++i) parts[0].merge(parts[i]);
+
+    EXPECT_EQ(parts[0].getCount(), whole.getCount());
+    EXPECT_EQ(parts[0].getMinimum(), whole.getMinimum());
+    EXPECT_EQ(parts[0].getMaximum(), whole.getMaximum());
+    for (double p : {1.0, 10.0, 50.0, 90.0, 99.0}) {
+        EXPECT_NEAR(parts[0].getPercentile(p), whole.getPercentile(p), 0.03);
+    }
+
+    // 查询不修改草图，压缩前后结果一致
+    double before = whole.getPercentile(37.0);
+    whole.compress();
+    EXPECT_NEAR(whole.getPercentile(37.0), before, 0.03);
+
+    CommunicationQuantileSketch empty;
+    EXPECT_EQ(empty.getPercentile(50.0), 0.0);
+    empty.add(std::nan(""));
+    EXPECT_EQ(empty.getCount(), 0u);
+    EXPECT_THROW(CommunicationQuantileSketch(0.0), std::invalid_argument);
+    EXPECT_THROW(CommunicationQuantileSketch(-5.0), std::invalid_argument);
+}
+
+/**
+ * @brief 测试蒙特卡洛结果的信噪比分布：中位数接近基准信噪比，且与线程数无关
+ */
+TEST_F(CommunicationModelAPIQuantileTest, MonteCarloDistribution) {
+    CommunicationMonteCarloConfig config;
+    config.trialCount = 100000;
+    config.shadowing = true;
+    config.rayleighFading = false;
+    config.jammerPowerStdDev = 0.0;
+    config.jammerDistanceStdDev = 0.0;
+    config.confidence = 0.95;
+
+    api->setThreadCount(1);
+    CommunicationMonteCarloResult serial;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(config, serial));
+    api->setThreadCount(4);
+    CommunicationMonteCarloResult parallel;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(config, parallel));
+
+    // 阴影衰落标准差8dB：中位数为基准信噪比，第5百分位低1.645σ
+    double baseSnr = api->calculateLinkStatus().signalToNoiseRatio;
+    EXPECT_EQ(serial.snrDistribution.getCount(), config.trialCount);
+    EXPECT_NEAR(serial.snrDistribution.getPercentile(50.0), baseSnr, 0.15);
+    EXPECT_NEAR(serial.snrDistribution.getPercentile(5.0), baseSnr - 1.645 * 8.0, 0.3);
+    EXPECT_EQ(serial.snrDistribution.getMinimum(), serial.snr.getMinimum());
+    EXPECT_LE(serial.throughputDistribution.getPercentile(10.0), serial.throughputDistribution.getPercentile(90.0));
+
+    for (double p : {1.0, 50.0, 99.0}) {
+        EXPECT_EQ(serial.snrDistribution.getPercentile(p), parallel.snrDistribution.getPercentile(p));
+        EXPECT_EQ(serial.throughputDistribution.getPercentile(p), parallel.throughputDistribution.getPercentile(p));
+    }
+}
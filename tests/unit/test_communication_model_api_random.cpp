@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationRandomStream.h"
+#include <memory>
+#include <vector>
+#include <random>
+#include <set>
+
+/**
+ * @brief CommunicationModelAPI随机数种子与子流测试类
+ */
+class CommunicationModelAPIRandomTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    CommunicationMonteCarloResult runMonteCarlo() const {
+        CommunicationMonteCarloConfig config;
+        config.trialCount = 20000;
+        config.shadowing = true;
+        config.rayleighFading = true;
+        config.jammerPowerStdDev = 0.0;
+        config.jammerDistanceStdDev = 0.0;
+        config.confidence = 0.95;
+        CommunicationMonteCarloResult result;
+        EXPECT_TRUE(api->analyzeAvailabilityMonteCarlo(config, result));
+        return result;
+    }
+
+    std::vector<double> runChannel() const {
+        std::vector<double> losses;
+        EXPECT_TRUE(api->simulateTimeVaryingChannel(1.0, 1e-4,
+            [&](const CommunicationChannelSample* samples, size_t count) {
+                for (size_t i = 0; i < count; ++i) losses.push_back(samples[i].shadowingLoss);
+                return true;
+            }));
+        return losses;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试主种子决定仿真结果，且结果与线程数无关
+ */
+TEST_F(CommunicationModelAPIRandomTest, MasterSeedControlsSimulations) {
+    EXPECT_EQ(api->getRandomSeed(), CommunicationRandomStream::DEFAULT_SEED);
+    api->setRandomSeed(12345);
+    EXPECT_EQ(api->getRandomSeed(), 12345u);
+
+    api->setThreadCount(1);
+    CommunicationMonteCarloResult serial = runMonteCarlo();
+    std::vector<double> serialChannel = runChannel();
+    api->setThreadCount(4);
+    CommunicationMonteCarloResult parallel = runMonteCarlo();
+    std::vector<double> parallelChannel = runChannel();
+    EXPECT_EQ(serial.snr.getMean(), parallel.snr.getMean());
+    EXPECT_EQ(serial.throughput.getVariance(), parallel.throughput.getVariance());
+    EXPECT_EQ(serialChannel, parallelChannel);
+
+    api->setRandomSeed(54321);
+    CommunicationMonteCarloResult reseeded = runMonteCarlo();
+    EXPECT_NE(reseeded.snr.getMean(), serial.snr.getMean());
+    EXPECT_NE(runChannel(), serialChannel);
+
+    api->setRandomSeed(12345);
+    EXPECT_EQ(runMonteCarlo().snr.getMean(), serial.snr.getMean());
+
+    // 分段分析以开始时的主种子续跑
+    CommunicationMonteCarloProgress progress;
+    progress.config.trialCount = 20000;
+    progress.config.shadowing = true;
+    progress.config.rayleighFading = true;
+    progress.config.jammerPowerStdDev = 0.0;
+    progress.config.jammerDistanceStdDev = 0.0;
+    progress.config.confidence = 0.95;
+    progress.completedTrials = 0;
+    ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(progress, 4096));
+    EXPECT_EQ(progress.seed, 12345u);
+    api->setRandomSeed(1);
+    while (!progress.isComplete()) {
+        ASSERT_TRUE(api->analyzeAvailabilityMonteCarlo(progress, 4096));
+    }
+    EXPECT_EQ(progress.result.snr.getMean(), serial.snr.getMean());
+}
+
+/**
+ * @brief 测试跳频图案随主种子变化且与线程数无关
+ */
+TEST_F(CommunicationModelAPIRandomTest, HoppingPatternFollowsSeed) {
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.isJammed = true;
+    jamming.jammerType = JammerType::BARRAGE;
+    jamming.jammerFrequency = 2400.0;
+    jamming.jammerBandwidth = 5.0;
+    api->setJammingEnvironment(jamming);
+
+    CommunicationHoppingConfig config;
+    config.hopCount = 100000;
+    config.netCount = 3;
+    config.hopsPerPacket = 4;
+    config.toleratedHits = 1;
+
+    api->setRandomSeed(7);
+    api->setThreadCount(1);
+    CommunicationHoppingResult serial;
+    ASSERT_TRUE(api->simulateFrequencyHopping(config, serial));
+    api->setThreadCount(3);
+    CommunicationHoppingResult parallel;
+    ASSERT_TRUE(api->simulateFrequencyHopping(config, parallel));
+    EXPECT_EQ(serial.hitCount, parallel.hitCount);
+    EXPECT_EQ(serial.netHitRates, parallel.netHitRates);
+
+    api->setRandomSeed(8);
+    CommunicationHoppingResult reseeded;
+    ASSERT_TRUE(api->simulateFrequencyHopping(config, reseeded));
+    EXPECT_NE(reseeded.hitCount, serial.hitCount);
+}
+
+/**
+ * @brief 测试派生子流互不相同、可复现，顺序游标可跳转并可用于标准库分布
+ */
+TEST_F(CommunicationModelAPIRandomTest, SubstreamsAndSkipAhead) {
+    api->setRandomSeed(99);
+    std::set<uint64_t> firstOutputs;
+    for (uint64_t index = 0; index < 1000; ++index) {
+        firstOutputs.insert(api->createRandomStream(index).bits(0));
+    }
+    EXPECT_EQ(firstOutputs.size(), 1000u);
+    EXPECT_EQ(api->createRandomStream(5).getKey(), api->createRandomStream(5).getKey());
+    EXPECT_NE(api->createRandomStream(5).getKey(),
+              CommunicationRandomStream(99, RandomStreamId::USER_DEFINED).getKey());
+
+    api->setRandomSeed(100);
+    EXPECT_NE(api->createRandomStream(5).bits(0), CommunicationModelAPI().createRandomStream(5).bits(0));
+
+    CommunicationRandomStream stream = api->createRandomStream(3);
+    CommunicationRandomSequence sequential(stream);
+    for (int i = 0; i < 1000; ++i) sequential();
+    CommunicationRandomSequence skipped(stream);
+    skipped.skip(1000);
+    EXPECT_EQ(sequential.getPosition(), skipped.getPosition());
+    EXPECT_EQ(sequential(), skipped());
+    EXPECT_EQ(skipped(), stream.bits(1001));
+
+    // 位置为偶数时与流的normal一致
+    CommunicationRandomSequence normals(stream, 10);
+    EXPECT_EQ(normals.normal(), stream.normal(5));
+    EXPECT_EQ(normals.getPosition(), 12u);
+
+    // 作为UniformRandomBitGenerator使用
+    CommunicationRandomSequence generator(stream);
+    std::uniform_int_distribution<int> die(1, 6);
+    std::vector<int> counts(7, 0);
+    for (int i = 0; i < 60000; ++i) ++counts[die(generator)];
+    for (int face = 1; face <= 6; ++face) {
+        EXPECT_NEAR(counts[face], 10000, 500) << face;
+    }
+}
+
+/**
+ * @brief 测试检查点保存并恢复主种子
+ */
+TEST_F(CommunicationModelAPIRandomTest, CheckpointCarriesSeed) {
+    api->setRandomSeed(0xABCDEF);
+    std::vector<uint8_t> checkpoint;
+    ASSERT_TRUE(api->saveCheckpoint(checkpoint));
+    CommunicationModelAPI restored;
+    ASSERT_TRUE(restored.loadCheckpoint(checkpoint.data(), checkpoint.size()));
+    EXPECT_EQ(restored.getRandomSeed(), 0xABCDEFu);
+    EXPECT_EQ(restored.createRandomStream(2).getKey(), api->createRandomStream(2).getKey());
+}
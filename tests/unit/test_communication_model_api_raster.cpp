@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationJammerModel.h"
+#include "CommunicationRasterEngine.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+/**
+ * @brief CommunicationModelAPI栅格可视化测试类
+ */
+class CommunicationModelAPIRasterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::JAMMED_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+
+        JammingEnvironment jamming = api->getJammingEnvironment();
+        jamming.isJammed = true;
+        jamming.jammerPower = 40.0;
+        jamming.jammerFrequency = 2400.0;
+        jamming.jammerDistance = 8.0;
+        api->setJammingEnvironment(jamming);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    /**
+     * @brief 像元中心坐标
+     */
+    static std::pair<double, double> cellCenter(const CommunicationRasterSpec& spec, int row, int col) {
+        double x = spec.xMin + (col + 0.5) * (spec.xMax - spec.xMin) / spec.width;
+        double y = spec.yMin + (row + 0.5) * (spec.yMax - spec.yMin) / spec.height;
+        return {x, y};
+    }
+
+    /**
+     * @brief 通过setDistance计算参考信号强度
+     */
+    double referenceSignalStrength(double distance) {
+        CommunicationEnvironment original = api->getEnvironment();
+        api->setDistance(distance);
+        double strength = api->calculateLinkStatus().signalStrength;
+        api->setEnvironment(original);
+        return strength;
+    }
+
+    /**
+     * @brief 按API的参数映射直接调用干扰模型计算参考干信比
+     */
+    double referenceJammerToSignalRatio(double signalDistance, double jammerDistance) const {
+        const CommunicationEnvironment& env = api->getEnvironment();
+        const JammingEnvironment& jamming = api->getJammingEnvironment();
+        CommunicationJammerModel jammer;
+        jammer.setJammerType(jamming.jammerType);
+        jammer.setJammerPower(jamming.jammerPower);
+        jammer.setJammerFrequency(jamming.jammerFrequency);
+        jammer.setJammerBandwidth(jamming.jammerBandwidth);
+        jammer.setTargetFrequency(env.frequency);
+        jammer.setTargetDistance(jammerDistance);
+        return jammer.calculateJammerToSignalRatio(signalDistance, env.frequency);
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试信号强度栅格与逐点计算一致
+ */
+TEST_F(CommunicationModelAPIRasterTest, SignalStrengthMatchesLinkStatus) {
+    // 尺寸跨越多个分块且含不完整分块
+    CommunicationRasterSpec spec = {-20.0, 30.0, -15.0, 25.0, 150, 70};
+    CommunicationRaster raster;
+    ASSERT_TRUE(api->renderSignalStrengthRaster(spec, raster));
+    ASSERT_EQ(raster.values.size(), 150u * 70u);
+
+    for (int row = 0; row < spec.height; row += 9) {
+        for (int col = 0; col < spec.width; col += 11) {
+            auto center = cellCenter(spec, row, col);
+            double distance = std::hypot(center.first, center.second);
+            EXPECT_NEAR(raster.at(row, col), referenceSignalStrength(distance), 1e-3)
+                << "row " << row << " col " << col;
+        }
+    }
+}
+
+/**
+ * @brief 测试干信比栅格与干扰模型计算一致
+ */
+TEST_F(CommunicationModelAPIRasterTest, InterferenceMatchesJammerModel) {
+    CommunicationRasterSpec spec = {-10.0, 20.0, -10.0, 10.0, 97, 65};
+    CommunicationRaster raster;
+    ASSERT_TRUE(api->renderInterferenceRaster(spec, raster));
+
+    const double jammerX = api->getJammingEnvironment().jammerDistance;
+    for (int row = 0; row < spec.height; row += 8) {
+        for (int col = 0; col < spec.width; col += 6) {
+            auto center = cellCenter(spec, row, col);
+            double signalDistance = std::hypot(center.first, center.second);
+            double jammerDistance = std::hypot(center.first - jammerX, center.second);
+            EXPECT_NEAR(raster.at(row, col), referenceJammerToSignalRatio(signalDistance, jammerDistance), 1e-3)
+                << "row " << row << " col " << col;
+        }
+    }
+
+    // 无干扰时不生成干信比栅格
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.isJammed = false;
+    api->setJammingEnvironment(jamming);
+    EXPECT_FALSE(api->renderInterferenceRaster(spec, raster));
+    EXPECT_TRUE(api->getInterferenceMap(-1.0, 1.0, -1.0, 1.0, 10).empty());
+}
+
+/**
+ * @brief 测试线程数不影响栅格结果
+ */
+TEST_F(CommunicationModelAPIRasterTest, RasterIndependentOfThreadCount) {
+    CommunicationRasterSpec spec = {-50.0, 50.0, -50.0, 50.0, 300, 200};
+
+    api->setThreadCount(1);
+    CommunicationRaster serial;
+    ASSERT_TRUE(api->renderInterferenceRaster(spec, serial));
+
+    api->setThreadCount(4);
+    CommunicationRaster parallel;
+    ASSERT_TRUE(api->renderInterferenceRaster(spec, parallel));
+    EXPECT_EQ(serial.values, parallel.values);
+}
+
+/**
+ * @brief 测试栅格文件写出
+ */
+TEST_F(CommunicationModelAPIRasterTest, RasterFileRoundTrip) {
+    CommunicationRasterSpec spec = {-5.0, 15.0, -8.0, 8.0, 130, 90};
+    CommunicationRaster raster;
+    ASSERT_TRUE(api->renderSignalStrengthRaster(spec, raster));
+
+    const std::string filename = "test_signal_raster.bin";
+    ASSERT_TRUE(api->renderSignalStrengthRasterToFile(spec, filename));
+
+    std::ifstream file(filename, std::ios::binary);
+    ASSERT_TRUE(file.is_open());
+    CommunicationRasterFileHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    ASSERT_TRUE(file.good());
+    EXPECT_EQ(std::string(header.magic, 4), "CMRS");
+    EXPECT_EQ(header.version, 1u);
+    EXPECT_EQ(header.quantity, static_cast<uint32_t>(RasterQuantity::SIGNAL_STRENGTH));
+    EXPECT_EQ(header.width, 130u);
+    EXPECT_EQ(header.height, 90u);
+    EXPECT_DOUBLE_EQ(header.xMin, spec.xMin);
+    EXPECT_DOUBLE_EQ(header.yMax, spec.yMax);
+
+    std::vector<float> values(raster.values.size());
+    file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(float));
+    ASSERT_TRUE(file.good());
+    EXPECT_EQ(values, raster.values);
+    file.close();
+    std::remove(filename.c_str());
+
+    EXPECT_FALSE(api->renderSignalStrengthRasterToFile(spec, ""));
+}
+
+/**
+ * @brief 测试无效栅格规格与兼容接口
+ */
+TEST_F(CommunicationModelAPIRasterTest, InvalidSpecAndLegacyMaps) {
+    CommunicationRaster raster;
+    EXPECT_FALSE(api->renderSignalStrengthRaster({1.0, 1.0, 0.0, 1.0, 10, 10}, raster));
+    EXPECT_FALSE(api->renderSignalStrengthRaster({0.0, 1.0, 2.0, 1.0, 10, 10}, raster));
+    EXPECT_FALSE(api->renderSignalStrengthRaster({0.0, 1.0, 0.0, 1.0, 0, 10}, raster));
+    EXPECT_FALSE(api->renderSignalStrengthRaster({0.0, 1.0, 0.0, 1.0, 10, -1}, raster));
+    EXPECT_TRUE(api->getSignalStrengthMap(0.0, 1.0, 0.0, 1.0, 0).empty());
+
+    auto signalMap = api->getSignalStrengthMap(-10.0, 10.0, -10.0, 10.0, 40);
+    ASSERT_EQ(signalMap.size(), 1600u);
+    // 第0行第0列像元中心为(-9.75, -9.75)
+    EXPECT_NEAR(signalMap[0].first, std::hypot(9.75, 9.75), 1e-12);
+    EXPECT_NEAR(signalMap[0].second, referenceSignalStrength(signalMap[0].first), 1e-3);
+
+    auto interferenceMap = api->getInterferenceMap(-10.0, 10.0, -10.0, 10.0, 40);
+    ASSERT_EQ(interferenceMap.size(), 1600u);
+    // 原点附近像元的信号最强，干信比低于远离发射机的像元
+    EXPECT_LT(interferenceMap[20 * 40 + 20].second, interferenceMap[0].second);
+}
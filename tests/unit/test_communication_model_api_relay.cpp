@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationJammerModel.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief CommunicationModelAPI中继规划测试类
+ */
+class CommunicationModelAPIRelayTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    void enableJammer() {
+        api->setScenario(CommunicationScenario::JAMMED_COMMUNICATION);
+        JammingEnvironment jamming = api->getJammingEnvironment();
+        jamming.isJammed = true;
+        jamming.jammerPower = 10.0;
+        jamming.jammerFrequency = 2400.0;
+        jamming.jammerDistance = 1.0;
+        api->setJammingEnvironment(jamming);
+    }
+
+    double linkRange() const {
+        CommunicationNetworkConnectivity probe;
+        EXPECT_TRUE(api->analyzeNetworkConnectivity({{0.0, 0.0}}, probe));
+        return probe.linkRange;
+    }
+
+    /**
+     * @brief 参考单跳信噪比：信号强度取自setDistance，干信比直接由干扰模型计算
+     * @return 接收端到干扰机的距离超出干扰模型的有效范围时返回NaN
+     */
+    double referenceLinkSnr(const std::pair<double, double>& from, const std::pair<double, double>& to) {
+        double distance = std::max(std::hypot(to.first - from.first, to.second - from.second), 0.001);
+        CommunicationEnvironment original = api->getEnvironment();
+        api->setDistance(distance);
+        double signal = api->calculateLinkStatus().signalStrength;
+        api->setEnvironment(original);
+
+        double snr = signal - original.noisePower;
+        const JammingEnvironment& jamming = api->getJammingEnvironment();
+        if (jamming.isJammed) {
+            CommunicationJammerModel jammer;
+            jammer.setJammerType(jamming.jammerType);
+            jammer.setJammerPower(jamming.jammerPower);
+            jammer.setJammerFrequency(jamming.jammerFrequency);
+            jammer.setJammerBandwidth(jamming.jammerBandwidth);
+            jammer.setTargetFrequency(original.frequency);
+            if (!jammer.setTargetDistance(std::hypot(to.first - jamming.jammerDistance, to.second))) {
+                return std::nan("");
+            }
+            snr -= jammer.calculateJammerToSignalRatio(distance, original.frequency);
+        }
+        return snr;
+    }
+
+    static std::pair<double, double> latticePosition(const CommunicationRelayPlan& plan, int index) {
+        int row = index / plan.latticeColumns;
+        int col = index % plan.latticeColumns;
+        return {plan.latticeOriginX + col * plan.latticeSpacing, plan.latticeOriginY + row * plan.latticeSpacing};
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试直达链路与中继对瓶颈信噪比的改善
+ */
+TEST_F(CommunicationModelAPIRelayTest, DirectLinkAndRelayImprovement) {
+    double range = linkRange();
+    std::pair<double, double> source(0.0, 0.0);
+    std::pair<double, double> destination(range * 0.5, 0.0);
+
+    CommunicationRelayPlan direct;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 0, direct));
+    ASSERT_TRUE(direct.feasible);
+    EXPECT_TRUE(direct.relayIndices.empty());
+    EXPECT_NEAR(direct.bottleneckSnr, referenceLinkSnr(source, destination), 1e-6);
+    EXPECT_NEAR(direct.totalDistance, range * 0.5, 1e-12);
+
+    // 直达链路已满足连接条件，允许中继时也不使用中继
+    CommunicationRelayPlan relayed;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 3, relayed));
+    ASSERT_TRUE(relayed.feasible);
+    EXPECT_TRUE(relayed.relayIndices.empty());
+    EXPECT_DOUBLE_EQ(relayed.bottleneckSnr, direct.bottleneckSnr);
+}
+
+/**
+ * @brief 测试短链路不使用中继（含干扰）
+ */
+TEST_F(CommunicationModelAPIRelayTest, ShortLinkUsesNoRelays) {
+    enableJammer();
+    std::pair<double, double> source(0.0, 0.0);
+    std::pair<double, double> destination(0.05, 0.0);
+
+    CommunicationRelayPlan plan;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 3, plan));
+    ASSERT_TRUE(plan.feasible);
+    EXPECT_TRUE(plan.relayIndices.empty());
+    EXPECT_TRUE(plan.relayPositions.empty());
+    EXPECT_NEAR(plan.totalDistance, 0.05, 1e-12);
+    EXPECT_TRUE(api->findOptimalRelayPositions(source, destination, 3).empty());
+}
+
+/**
+ * @brief 测试跳数取满足连接条件的最小值
+ */
+TEST_F(CommunicationModelAPIRelayTest, UsesFewestHops) {
+    double range = linkRange();
+    std::pair<double, double> source(0.0, 0.0);
+    std::pair<double, double> destination(range * 1.5, 0.0);
+
+    // 直达不可达，一个中继即可满足连接条件，放宽中继上限不增加中继数量
+    CommunicationRelayPlan single;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 1, single));
+    ASSERT_TRUE(single.feasible);
+    ASSERT_EQ(single.relayIndices.size(), 1u);
+
+    CommunicationRelayPlan relaxed;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 4, relaxed));
+    ASSERT_TRUE(relaxed.feasible);
+    EXPECT_EQ(relaxed.relayIndices, single.relayIndices);
+    EXPECT_DOUBLE_EQ(relaxed.bottleneckSnr, single.bottleneckSnr);
+}
+
+/**
+ * @brief 测试多跳中继路径每一跳均满足连接条件
+ */
+TEST_F(CommunicationModelAPIRelayTest, RelayHopsAreConnected) {
+    double range = linkRange();
+    std::pair<double, double> source(0.0, 0.0);
+    std::pair<double, double> destination(range * 3.2, range * 0.7);
+
+    CommunicationRelayPlan plan;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 1, plan));
+    EXPECT_FALSE(plan.feasible);
+    EXPECT_TRUE(api->findOptimalRelayPositions(source, destination, 1).empty());
+
+    ASSERT_TRUE(api->planRelayPath(source, destination, 5, plan));
+    ASSERT_TRUE(plan.feasible);
+    ASSERT_GE(plan.relayIndices.size(), 3u);
+    ASSERT_LE(plan.relayIndices.size(), 5u);
+    EXPECT_EQ(api->findOptimalRelayPositions(source, destination, 5), plan.relayIndices);
+
+    std::vector<std::pair<double, double>> path = {source};
+    for (size_t k = 0; k < plan.relayIndices.size(); ++k) {
+        auto position = latticePosition(plan, plan.relayIndices[k]);
+        EXPECT_NEAR(position.first, plan.relayPositions[k].first, 1e-9);
+        EXPECT_NEAR(position.second, plan.relayPositions[k].second, 1e-9);
+        path.push_back(position);
+    }
+    path.push_back(destination);
+
+    double bottleneck = 1e300;
+    for (size_t k = 0; k + 1 < path.size(); ++k) {
+        double hop = std::hypot(path[k + 1].first - path[k].first, path[k + 1].second - path[k].second);
+        EXPECT_LE(hop, range);
+        CommunicationEnvironment original = api->getEnvironment();
+        api->setDistance(hop);
+        EXPECT_TRUE(api->calculateLinkStatus().isConnected);
+        api->setEnvironment(original);
+        bottleneck = std::min(bottleneck, referenceLinkSnr(path[k], path[k + 1]));
+    }
+    EXPECT_NEAR(plan.bottleneckSnr, bottleneck, 1e-6);
+}
+
+/**
+ * @brief 测试单中继时与逐格点穷举的最优瓶颈一致（含干扰）
+ */
+TEST_F(CommunicationModelAPIRelayTest, SingleRelayMatchesExhaustiveSearch) {
+    enableJammer();
+    std::pair<double, double> source(-1.0, 0.3);
+    std::pair<double, double> destination(4.0, 0.3);
+
+    CommunicationRelayPlan plan;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 1, plan));
+    ASSERT_TRUE(plan.feasible);
+
+    // 紧邻干扰机的格点超出干扰模型的距离范围，其信噪比远低于最优值，穷举时跳过
+    double best = referenceLinkSnr(source, destination);
+    for (int index = 0; index < plan.latticeColumns * plan.latticeRows; ++index) {
+        auto relay = latticePosition(plan, index);
+        double bottleneck = std::min(referenceLinkSnr(source, relay), referenceLinkSnr(relay, destination));
+        if (!std::isnan(bottleneck)) best = std::max(best, bottleneck);
+    }
+    EXPECT_NEAR(plan.bottleneckSnr, best, 1e-6);
+}
+
+/**
+ * @brief 测试线程数不影响规划结果
+ */
+TEST_F(CommunicationModelAPIRelayTest, PlanIndependentOfThreadCount) {
+    enableJammer();
+    std::pair<double, double> source(-1.0, 0.3);
+    std::pair<double, double> destination(10.0, -0.5);
+
+    api->setThreadCount(1);
+    CommunicationRelayPlan serial;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 4, serial));
+
+    api->setThreadCount(4);
+    CommunicationRelayPlan parallel;
+    ASSERT_TRUE(api->planRelayPath(source, destination, 4, parallel));
+
+    ASSERT_TRUE(serial.feasible);
+    EXPECT_EQ(serial.relayIndices, parallel.relayIndices);
+    EXPECT_DOUBLE_EQ(serial.bottleneckSnr, parallel.bottleneckSnr);
+}
+
+/**
+ * @brief 测试无效参数与重合节点
+ */
+TEST_F(CommunicationModelAPIRelayTest, InvalidArguments) {
+    CommunicationRelayPlan plan;
+    EXPECT_FALSE(api->planRelayPath({0.0, 0.0}, {1.0, 0.0}, -1, plan));
+    EXPECT_FALSE(api->planRelayPath({std::nan(""), 0.0}, {1.0, 0.0}, 2, plan));
+
+    ASSERT_TRUE(api->planRelayPath({2.0, 3.0}, {2.0, 3.0}, 2, plan));
+    EXPECT_TRUE(plan.feasible);
+    EXPECT_TRUE(plan.relayIndices.empty());
+    EXPECT_DOUBLE_EQ(plan.totalDistance, 0.0);
+}
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include "CommunicationModelAPI.h"
+#include "CommunicationEventScheduler.h"
+#include "CommunicationTimingSimulator.h"
+#include "CommunicationRandomStream.h"
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief CommunicationModelAPI干扰时序仿真测试类
+ */
+class CommunicationModelAPITimingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        api = std::make_unique<CommunicationModelAPI>(CommunicationScenario::NORMAL_COMMUNICATION);
+
+        CommunicationEnvironment env = api->getEnvironment();
+        env.frequency = 2400.0;
+        env.bandwidth = 20.0;
+        env.transmitPower = 30.0;
+        env.noisePower = -90.0;
+        env.distance = 1.0;
+        env.environmentType = EnvironmentType::URBAN_AREA;
+        api->setEnvironment(env);
+    }
+
+    void TearDown() override {
+        api.reset();
+    }
+
+    static CommunicationTimingJammer makeJammer(JammerType type, double frequency) {
+        CommunicationTimingJammer jammer;
+        jammer.type = type;
+        jammer.frequency = frequency;
+        jammer.bandwidth = 1.0;
+        jammer.pulseWidth = 0.25;
+        jammer.pulseRepetitionRate = 1000.0;
+        jammer.sweepRate = 1000.0;
+        jammer.sweepRange = 100.0;
+        jammer.startOffset = 0.0;
+        return jammer;
+    }
+
+    static CommunicationTimingConfig makeConfig(double duration) {
+        CommunicationTimingConfig config;
+        config.duration = duration;
+        config.packetDuration = 0.1;
+        config.packetInterval = 0.37;
+        config.corruptionThreshold = 0.0;
+        return config;
+    }
+
+    std::unique_ptr<CommunicationModelAPI> api;
+};
+
+/**
+ * @brief 测试调度器按时刻出队，时刻相同时按入队先后出队
+ */
+TEST_F(CommunicationModelAPITimingTest, SchedulerOrdersByTimeThenSequence) {
+    CommunicationRandomStream stream(9, RandomStreamId::CHANNEL_SHADOWING);
+    CommunicationEventScheduler scheduler;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        scheduler.schedule(std::floor(stream.uniform(i) * 100.0), i, i % 2);
+    }
+    EXPECT_EQ(scheduler.size(), 5000u);
+
+    CommunicationEventScheduler::Event previous;
+    ASSERT_TRUE(scheduler.popNext(previous));
+    CommunicationEventScheduler::Event event;
+    size_t popped = 1;
+    while (scheduler.popNext(event)) {
+        ASSERT_TRUE(event.time > previous.time ||
+                    (event.time == previous.time && event.sequence > previous.sequence));
+        EXPECT_EQ(event.sequence, event.source);
+        previous = event;
+        ++popped;
+    }
+    EXPECT_EQ(popped, 5000u);
+    EXPECT_TRUE(scheduler.empty());
+    EXPECT_FALSE(scheduler.popNext(event));
+    EXPECT_EQ(scheduler.getScheduledCount(), 5000u);
+}
+
+/**
+ * @brief 测试脉冲干扰：受干扰时间比例等于占空比，数据包损坏概率为(脉宽 + 包长) / 脉冲周期
+ */
+TEST_F(CommunicationModelAPITimingTest, PulseJammerAgainstPackets) {
+    CommunicationTimingConfig config = makeConfig(10.0);
+    config.jammers.push_back(makeJammer(JammerType::PULSE, 2405.0));
+
+    CommunicationTimingResult result;
+    ASSERT_TRUE(api->simulateJammerTiming(config, result));
+    EXPECT_NEAR(result.jammedTimeFraction, 0.25, 1e-9);
+    EXPECT_NEAR(result.getPacketErrorRate(), 0.35, 0.01);
+    EXPECT_NEAR(result.meanPacketOverlap, 0.25, 0.01);
+    EXPECT_EQ(result.packetCount, 27027u);
+    EXPECT_GE(result.eventCount, 2u * 10000u + 2u * 27027u);
+    EXPECT_LE(result.eventCount, 2u * 10000u + 2u * 27027u + 2u);
+
+    // 第二个脉冲源错开半个脉宽，受干扰时间为两者并集
+    CommunicationTimingJammer delayed = makeJammer(JammerType::PULSE, 2400.0);
+    delayed.startOffset = 0.125;
+    config.jammers.push_back(delayed);
+    ASSERT_TRUE(api->simulateJammerTiming(config, result));
+    EXPECT_NEAR(result.jammedTimeFraction, 0.375, 1e-9);
+
+    // 容忍一半受干扰时，包长小于脉宽的数据包仍可能损坏
+    config.corruptionThreshold = 0.5;
+    CommunicationTimingResult tolerant;
+    ASSERT_TRUE(api->simulateJammerTiming(config, tolerant));
+    EXPECT_LT(tolerant.corruptedPacketCount, result.corruptedPacketCount);
+    EXPECT_GT(tolerant.corruptedPacketCount, 0u);
+}
+
+/**
+ * @brief 测试扫频、持续与频带不重叠的干扰源
+ */
+TEST_F(CommunicationModelAPITimingTest, SweepAndContinuousJammers) {
+    CommunicationTimingConfig config = makeConfig(2.0);
+    config.jammers.push_back(makeJammer(JammerType::SWEEP_FREQUENCY, 2400.0));
+
+    // 瞬时频带中心落在信道中心±10.5MHz内的时间占扫频范围100MHz的21%
+    CommunicationTimingResult result;
+    ASSERT_TRUE(api->simulateJammerTiming(config, result));
+    EXPECT_NEAR(result.jammedTimeFraction, 0.21, 1e-9);
+    EXPECT_GT(result.corruptedPacketCount, 0u);
+    EXPECT_LT(result.corruptedPacketCount, result.packetCount);
+
+    CommunicationTimingSimulator simulator(2400.0, 20.0);
+    CommunicationTimingSimulator::Window window;
+    EXPECT_EQ(simulator.calculateJammedWindow(makeJammer(JammerType::SWEEP_FREQUENCY, 2600.0), window),
+              CommunicationTimingSimulator::Activity::NEVER);
+    EXPECT_EQ(simulator.calculateJammedWindow(makeJammer(JammerType::BARRAGE, 2409.0), window),
+              CommunicationTimingSimulator::Activity::ALWAYS);
+    CommunicationTimingJammer narrowSweep = makeJammer(JammerType::SWEEP_FREQUENCY, 2400.0);
+    narrowSweep.sweepRange = 10.0;
+    EXPECT_EQ(simulator.calculateJammedWindow(narrowSweep, window), CommunicationTimingSimulator::Activity::ALWAYS);
+
+    config.jammers = {makeJammer(JammerType::SWEEP_FREQUENCY, 2600.0)};
+    ASSERT_TRUE(api->simulateJammerTiming(config, result));
+    EXPECT_EQ(result.jammedTimeFraction, 0.0);
+    EXPECT_EQ(result.corruptedPacketCount, 0u);
+
+    config.jammers = {makeJammer(JammerType::GAUSSIAN_NOISE, 2400.0)};
+    ASSERT_TRUE(api->simulateJammerTiming(config, result));
+    EXPECT_EQ(result.jammedTimeFraction, 1.0);
+    EXPECT_EQ(result.corruptedPacketCount, result.packetCount);
+    EXPECT_EQ(result.eventCount, 2 * result.packetCount);
+}
+
+/**
+ * @brief 测试未给出干扰源时取当前干扰环境与干扰模型的脉冲参数
+ */
+TEST_F(CommunicationModelAPITimingTest, DefaultsToCurrentJammer) {
+    CommunicationTimingConfig config = makeConfig(1.0);
+    CommunicationTimingResult result;
+    ASSERT_TRUE(api->simulateJammerTiming(config, result));
+    EXPECT_EQ(result.jammedTimeFraction, 0.0);
+
+    api->setScenario(CommunicationScenario::JAMMED_COMMUNICATION);
+    JammingEnvironment jamming = api->getJammingEnvironment();
+    jamming.isJammed = true;
+    jamming.jammerType = JammerType::PULSE;
+    jamming.jammerFrequency = 2400.0;
+    jamming.jammerBandwidth = 10.0;
+    api->setJammingEnvironment(jamming);
+
+    CommunicationJammerModel* model = api->getJammerModel();
+    ASSERT_NE(model, nullptr);
+    ASSERT_TRUE(model->setPulseWidth(0.1));
+    ASSERT_TRUE(model->setPulseRepetitionRate(2000.0));
+    ASSERT_TRUE(api->simulateJammerTiming(config, result));
+    EXPECT_NEAR(result.jammedTimeFraction, 0.2, 1e-9);
+}
+
+/**
+ * @brief 测试无效配置
+ */
+TEST_F(CommunicationModelAPITimingTest, InvalidConfig) {
+    CommunicationTimingResult result;
+    CommunicationTimingConfig config = makeConfig(1.0);
+    config.packetInterval = 0.05;
+    EXPECT_FALSE(api->simulateJammerTiming(config, result));
+
+    config = makeConfig(1.0);
+    config.corruptionThreshold = 1.0;
+    EXPECT_FALSE(api->simulateJammerTiming(config, result));
+
+    config = makeConfig(std::numeric_limits<double>::infinity());
+    EXPECT_FALSE(api->simulateJammerTiming(config, result));
+
+    config = makeConfig(1.0);
+    config.jammers.push_back(makeJammer(JammerType::PULSE, 2400.0));
+    config.jammers.back().pulseWidth = 0.0;
+    EXPECT_FALSE(api->simulateJammerTiming(config, result));
+
+    // 预估事件数超过上限
+    config = makeConfig(1e9);
+    config.packetInterval = 1e6;
+    config.jammers.push_back(makeJammer(JammerType::PULSE, 2400.0));
+    config.jammers.back().pulseWidth = 0.001;
+    config.jammers.back().pulseRepetitionRate = 100000.0;
+    EXPECT_FALSE(api->simulateJammerTiming(config, result));
+}